@@ -1,13 +1,39 @@
 #pragma once
 
 #include "Tactics/Components/Tile.hpp"
+#include "Tactics/Core/Rect.hpp"
+#include <cstdint>
+#include <optional>
+#include <span>
 #include <vector>
 
 namespace Tactics
 {
+    // View over one square chunk of grid tiles. Both planes hold CHUNK_SIZE * CHUNK_SIZE entries,
+    // row-major within the chunk; entries outside `bounds` (partial edge chunks) are padding.
+    template <typename TypeT, typename CostT>
+    struct BasicGridChunk
+    {
+        Vector2i coord;
+        Recti bounds;
+        std::span<TypeT> tile_types;
+        std::span<CostT> move_costs;
+    };
+
+    using GridChunk = BasicGridChunk<std::uint8_t, std::int8_t>;
+    using ConstGridChunk = BasicGridChunk<const std::uint8_t, const std::int8_t>;
+
+    // Tile storage is structure-of-arrays: one byte per tile for the type and one signed byte
+    // per tile for the move cost. Tile objects are only materialized on demand by get_tile.
+    //
+    // Both planes are laid out chunk-major: the grid is cut into CHUNK_SIZE x CHUNK_SIZE chunks,
+    // each stored contiguously, so 2D neighbourhood scans stay within a few cache lines.
     class Grid
     {
     public:
+        static constexpr int CHUNK_SIZE = 32;
+        static constexpr int CHUNK_TILE_COUNT = CHUNK_SIZE * CHUNK_SIZE;
+
         Grid();
 
         // Delete copy constructor and assignment operator
@@ -23,29 +49,87 @@ namespace Tactics
         // Destructor
         ~Grid() = default;
 
+        // Explicit deep copy (planes and revisions), e.g. for handing a snapshot to another thread
+        [[nodiscard]] auto clone() const -> Grid;
+
         // Size accessors
         [[nodiscard]] auto get_width() const -> int;
         [[nodiscard]] auto get_height() const -> int;
 
-        // Get tile at position (returns nullptr if out of bounds)
-        [[nodiscard]] auto get_tile(const Vector2i &position) -> Tile *;
-        [[nodiscard]] auto get_tile(const Vector2i &position) const -> const Tile *;
+        // Get tile at position (returns nullopt if out of bounds)
+        [[nodiscard]] auto get_tile(const Vector2i &position) const -> std::optional<Tile>;
 
-        // Set tile at position
+        // Set tile at position (move cost must fit in the int8 cost plane)
         void set_tile(const Vector2i &position, const Tile &tile);
 
+        // Chunk-major tile type plane (Tile::Type values, indexed by index_of)
+        // Writes through the mutable plane or chunk spans must be followed by mark_chunk_changed
+        [[nodiscard]] auto get_tile_types() -> std::span<std::uint8_t>;
+        [[nodiscard]] auto get_tile_types() const -> std::span<const std::uint8_t>;
+
+        // Chunk-major move cost plane (negative means blocked, indexed by index_of)
+        [[nodiscard]] auto get_move_costs() -> std::span<std::int8_t>;
+        [[nodiscard]] auto get_move_costs() const -> std::span<const std::int8_t>;
+
+        // Chunk layout accessors
+        [[nodiscard]] auto get_chunks_x() const -> int;
+        [[nodiscard]] auto get_chunks_y() const -> int;
+        [[nodiscard]] auto get_chunk_count() const -> int;
+
+        // Get the chunk at chunk coordinates (must be within get_chunks_x/get_chunks_y)
+        [[nodiscard]] auto get_chunk(int chunk_x, int chunk_y) -> GridChunk;
+        [[nodiscard]] auto get_chunk(int chunk_x, int chunk_y) const -> ConstGridChunk;
+
+        // Chunk coordinates containing a tile position
+        [[nodiscard]] static auto chunk_of(const Vector2i &position) -> Vector2i;
+
+        // Change tracking: revisions come from a process-wide counter, so a freshly resized
+        // or regenerated grid never reports a revision seen on another grid
+        [[nodiscard]] auto get_revision() const -> std::uint64_t;
+        [[nodiscard]] auto get_chunk_revision(int chunk_x, int chunk_y) const -> std::uint64_t;
+        void mark_chunk_changed(int chunk_x, int chunk_y);
+
+        // New revision for a chunk overwritten with its stored contents: caches keyed on
+        // revisions see the change, but the chunk is not marked dirty
+        void mark_chunk_loaded(int chunk_x, int chunk_y);
+
+        // Dirty tracking for delta saves: one bit per chunk, set by every change (and for all
+        // chunks on resize) and cleared once the grid matches what is stored
+        [[nodiscard]] auto is_chunk_dirty(int chunk_x, int chunk_y) const -> bool;
+        [[nodiscard]] auto has_dirty_chunks() const -> bool;
+        [[nodiscard]] auto get_dirty_chunk_count() const -> int;
+        void clear_dirty_chunks();
+
+        // Add the dirty chunks of another grid with the same layout (no-op otherwise)
+        void merge_dirty_chunks(const Grid &other);
+
         // Resize grid to specified dimensions (initializes all tiles to default)
         void resize(int width, int height);
 
         // Check if coordinates are valid
         [[nodiscard]] auto is_valid_position(const Vector2i &position) const -> bool;
 
+        // Convert 2D coordinates to 1D plane index
+        [[nodiscard]] auto index_of(int x_pos, int y_pos) const -> size_t;
+
     private:
         int m_width = 0;
         int m_height = 0;
-        std::vector<Tile> m_tiles;
+        int m_chunks_x = 0;
+        int m_chunks_y = 0;
+        std::vector<std::uint8_t> m_tile_types;
+        std::vector<std::int8_t> m_move_costs;
+        std::vector<std::uint64_t> m_chunk_revisions;
+        std::uint64_t m_revision = 0;
+        std::vector<std::uint64_t> m_dirty_chunks;
 
-        // Convert 2D coordinates to 1D index
-        [[nodiscard]] auto index_of(int x_pos, int y_pos) const -> size_t;
+        // Tile-space area of a chunk clipped to the grid
+        [[nodiscard]] auto chunk_bounds(int chunk_x, int chunk_y) const -> Recti;
+
+        // Offset of a chunk's first entry in the planes
+        [[nodiscard]] auto chunk_offset(int chunk_x, int chunk_y) const -> size_t;
+
+        // Row-major index of a chunk in the per-chunk arrays
+        [[nodiscard]] auto chunk_index(int chunk_x, int chunk_y) const -> size_t;
     };
 } // namespace Tactics
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Unit.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Tactics
+{
+    // Persistent tile -> unit index, laid out like the Grid planes (by Grid::index_of).
+    // Lookups are O(1) and moves update two entries, so nothing is rebuilt per query.
+    // Stacked units are chained per tile: lookups return the top one (the first in the list
+    // after a reset, or the last to move in), and the tile stays occupied until all have left.
+    class OccupancyGrid
+    {
+    public:
+        OccupancyGrid() = default;
+        ~OccupancyGrid() = default;
+
+        // Delete copy constructor and assignment operator
+        OccupancyGrid(const OccupancyGrid &) = delete;
+        auto operator=(const OccupancyGrid &) -> OccupancyGrid & = delete;
+
+        // Move constructor
+        OccupancyGrid(OccupancyGrid &&other) noexcept = default;
+
+        // Move assignment operator
+        auto operator=(OccupancyGrid &&other) noexcept -> OccupancyGrid & = default;
+
+        // Rebuild from scratch for a new grid or unit list
+        void reset(const Grid &grid, std::span<const Unit> units);
+
+        // Move unit_index from one tile to another
+        void move_unit(const Grid &grid, std::size_t unit_index, const Vector2i &from,
+                       const Vector2i &to);
+
+        [[nodiscard]] auto get_unit_at(const Grid &grid, const Vector2i &position) const
+            -> std::optional<std::size_t>;
+        [[nodiscard]] auto is_occupied(const Grid &grid, const Vector2i &position) const -> bool;
+
+        // Occupied flag per tile, in the form the pathfinding searches take as blocked
+        [[nodiscard]] auto get_occupied_tiles() const -> const std::vector<bool> &;
+
+        // Bumped on every change, for caches keyed on unit positions
+        [[nodiscard]] auto get_revision() const -> std::uint64_t;
+
+    private:
+        static constexpr std::uint32_t NO_UNIT = 0xFFFFFFFFU;
+
+        // Top unit per tile, and the unit below each unit on its tile
+        std::vector<std::uint32_t> m_unit_at;
+        std::vector<std::uint32_t> m_next_unit;
+        std::vector<bool> m_occupied_tiles;
+        std::uint64_t m_revision = 0;
+    };
+} // namespace Tactics
@@ -3,11 +3,19 @@
 #include "Tactics/Components/Camera.hpp"
 #include "Tactics/Components/Cursor.hpp"
 #include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/OccupancyGrid.hpp"
 #include "Tactics/Components/Unit.hpp"
 #include "Tactics/Core/EventBus.hpp"
+#include "Tactics/Core/Rect.hpp"
+#include "Tactics/Pathfinding/BatchReachability.hpp"
+#include "Tactics/Pathfinding/FlowField.hpp"
+#include "Tactics/Pathfinding/Pathfinder.hpp"
+#include "Tactics/Pathfinding/ReachabilitySearch.hpp"
 
 #include <SDL3/SDL.h>
+#include <functional>
 #include <optional>
+#include <span>
 #include <vector>
 
 namespace Tactics
@@ -15,6 +23,10 @@ namespace Tactics
     class UnitController : public Publisher
     {
     public:
+        // Receives the tile bounds a search may read, before the search runs. Returning false
+        // (the tiles could not be filled in) cancels the search
+        using SearchRegionCallback = std::function<bool(const Recti &)>;
+
         UnitController() = default;
         ~UnitController() = default;
 
@@ -34,22 +46,44 @@ namespace Tactics
         void on_grid_changed(const Grid &grid);
         void clear_selection();
 
+        // Called ahead of every search, so a grid that is still being loaded can fill in the
+        // tiles the search will read
+        void set_search_region_callback(SearchRegionCallback callback);
+
+        // Shared flow field toward goals; recomputed only when the grid or unit positions change.
+        // Left without a result if the grid could not be filled in
+        [[nodiscard]] auto get_flow_field(const Grid &grid, std::span<const Vector2i> goals)
+            -> const FlowField &;
+
+        // Reachable tiles of every unit (in get_units order), computed in parallel. Empty if the
+        // tiles the searches read could not be filled in
+        [[nodiscard]] auto compute_all_reachable_tiles(const Grid &grid)
+            -> std::span<const TileBitset>;
+
     private:
         static constexpr int DEFAULT_UNIT_MOVE_POINTS = 5;
 
         std::vector<Unit> m_units;
         std::optional<size_t> m_selected_unit;
-        std::vector<int> m_reachable_move_points;
 
-        [[nodiscard]] auto find_unit_index_at(const Vector2i &position) const
+        // Tile -> unit index, kept in sync with every position change
+        OccupancyGrid m_occupancy;
+
+        // Search state is reused across selections
+        ReachabilitySearch m_reachability;
+        Pathfinder m_pathfinder;
+        FlowField m_flow_field;
+        BatchReachability m_batch_reachability;
+        std::vector<ReachabilityQuery> m_batch_queries;
+        SearchRegionCallback m_on_search_region;
+
+        [[nodiscard]] auto find_unit_index_at(const Grid &grid, const Vector2i &position) const
             -> std::optional<size_t>;
+        void move_unit(const Grid &grid, size_t unit_index, const Vector2i &position);
         [[nodiscard]] auto is_tile_reachable(const Grid &grid, const Vector2i &position) const
             -> bool;
-        void compute_reachable_tiles(const Grid &grid, const Unit &unit);
-        [[nodiscard]] auto build_occupied_tiles(const Grid &grid, const Vector2i &start) const
-            -> std::vector<bool>;
-        void expand_reachable_tiles(const Grid &grid, const Unit &unit,
-                                    const std::vector<bool> &occupied);
+        auto compute_reachable_tiles(const Grid &grid, const Unit &unit) -> bool;
+        auto prepare_search_region(const Recti &tiles) -> bool;
         void render_reachable_tiles(SDL_Renderer *renderer, const Camera &camera, float tile_size,
                                     const Grid &grid) const;
         void clear_reachable_tiles();
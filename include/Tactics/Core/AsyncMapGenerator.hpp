@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/MapCache.hpp"
+#include "Tactics/Core/ThreadPool.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace Tactics
+{
+    // A finished background generation
+    struct GeneratedMap
+    {
+        GeneratorConfig config;
+        Grid grid;
+    };
+
+    // Runs map generation on a worker thread so the frame loop keeps going.
+    //
+    // The owner polls take_result() once per frame and swaps the grid in when it arrives, so the
+    // old map stays valid until then. One job runs at a time. The cache, if given, is only used
+    // from the worker while a job runs. Destruction waits for a running job to finish. Jobs
+    // share one generation pool instead of each starting its own; it is restarted only when a
+    // job asks for a different thread_count.
+    class AsyncMapGenerator
+    {
+    public:
+        explicit AsyncMapGenerator(MapCache *cache = nullptr);
+        ~AsyncMapGenerator() = default;
+
+        // Delete copy constructor and assignment operator
+        AsyncMapGenerator(const AsyncMapGenerator &) = delete;
+        auto operator=(const AsyncMapGenerator &) -> AsyncMapGenerator & = delete;
+
+        // Delete move constructor and assignment operator
+        AsyncMapGenerator(AsyncMapGenerator &&) = delete;
+        auto operator=(AsyncMapGenerator &&) -> AsyncMapGenerator & = delete;
+
+        // Start generating a map (false if a job is already running)
+        auto start(const GeneratorConfig &config) -> bool;
+
+        // True from start() until the result is ready
+        [[nodiscard]] auto is_running() const -> bool;
+
+        // Progress of the current or last job in [0, 1]
+        [[nodiscard]] auto get_progress() const -> float;
+
+        // Finished map, handed out once (nullopt while running or when there is none)
+        [[nodiscard]] auto take_result() -> std::optional<GeneratedMap>;
+
+    private:
+        MapCache *m_cache;
+        std::atomic<bool> m_running{false};
+        std::atomic<float> m_progress{0.0F};
+
+        std::mutex m_result_mutex;
+        std::optional<GeneratedMap> m_result;
+
+        // Only touched by the worker, one job at a time
+        std::unique_ptr<ThreadPool> m_pool;
+        int m_pool_thread_count{0};
+
+        // Declared last so the worker is joined before the state it uses is destroyed
+        std::jthread m_worker;
+    };
+} // namespace Tactics
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Tactics/Components/Tile.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Tactics
+{
+    // Multi-type cellular automaton over a row-major buffer of tile types.
+    //
+    // Each row is scanned once with a sliding 3x3 window that keeps a histogram of every tile
+    // type, so a cell's neighbour counts cost a few increments instead of one rescan per type.
+    // The new type comes from a rule table: rules are tried in order and the first whose
+    // neighbour count is set in its mask wins; cells no rule matches keep their type.
+    // Neighbours outside the map are not counted.
+    class CellularAutomaton
+    {
+    public:
+        static constexpr std::size_t TYPE_COUNT = static_cast<std::size_t>(Tile::Type::Wall) + 1;
+        static constexpr int MAX_NEIGHBORS = 8;
+        static constexpr int MAJORITY_THRESHOLD = 5;
+
+        // A cell becomes `result` when its count of `counted` neighbours has its bit set in
+        // `neighbor_counts` (bit n stands for n neighbours)
+        struct Rule
+        {
+            Tile::Type counted;
+            std::uint16_t neighbor_counts;
+            Tile::Type result;
+        };
+
+        explicit CellularAutomaton(std::vector<Rule> rules);
+
+        // Mask matching `minimum` or more neighbours
+        [[nodiscard]] static auto at_least(int minimum) -> std::uint16_t;
+
+        // Terrain smoothing: a cell joins any type holding a majority of its neighbours,
+        // checked in the order water, mountain, forest, grass, desert
+        [[nodiscard]] static auto majority_rules() -> std::vector<Rule>;
+
+        // Advance rows [row_begin, row_end) of a width x height map from source into target.
+        // Only those rows of target are written, so disjoint row ranges may run concurrently.
+        void step_rows(std::span<const Tile::Type> source, std::span<Tile::Type> target,
+                       int width, int height, int row_begin, int row_end) const;
+
+        [[nodiscard]] auto get_rules() const -> const std::vector<Rule> &;
+
+    private:
+        using Histogram = std::array<std::uint8_t, TYPE_COUNT>;
+
+        std::vector<Rule> m_rules;
+
+        // Add (delta = 1) or remove (delta = -1) column x_pos of rows y_pos - 1 .. y_pos + 1
+        static void shift_column(Histogram &window, std::span<const Tile::Type> source, int width,
+                                 int height, int x_pos, int y_pos, int delta);
+    };
+} // namespace Tactics
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Tactics/Components/Camera.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/MapGenerator.hpp"
+#include "Tactics/Core/Rect.hpp"
+#include "Tactics/Core/Vector2.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+namespace Tactics
+{
+    // One generated chunk, laid out like a Grid chunk: row-major within the chunk, with
+    // entries outside `bounds` padded as walls.
+    struct StreamedChunk
+    {
+        Vector2i coord;
+        Recti bounds;
+        std::array<std::uint8_t, Grid::CHUNK_TILE_COUNT> tile_types{};
+        std::array<std::int8_t, Grid::CHUNK_TILE_COUNT> move_costs{};
+    };
+
+    // Generates terrain chunk by chunk for maps too large to hold as one Grid.
+    //
+    // Chunks are produced on demand by MapGenerator::generate_region and kept in a
+    // least-recently-used cache of fixed capacity, so memory stays bounded however large the
+    // configured map is. update() keeps the chunks around the camera view resident.
+    class ChunkStreamer
+    {
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY = 256;
+        static constexpr int DEFAULT_MARGIN_CHUNKS = 1;
+
+        explicit ChunkStreamer(const GeneratorConfig &config,
+                               std::size_t capacity = DEFAULT_CAPACITY);
+
+        // Delete copy constructor and assignment operator
+        ChunkStreamer(const ChunkStreamer &) = delete;
+        auto operator=(const ChunkStreamer &) -> ChunkStreamer & = delete;
+
+        // Delete move constructor and assignment operator
+        ChunkStreamer(ChunkStreamer &&) = delete;
+        auto operator=(ChunkStreamer &&) -> ChunkStreamer & = delete;
+
+        ~ChunkStreamer() = default;
+
+        // Chunk at chunk coordinates, generated on a miss (nullptr outside the map)
+        [[nodiscard]] auto get_chunk(int chunk_x, int chunk_y) -> const StreamedChunk *;
+
+        // Cached chunk without generating or touching the LRU order
+        [[nodiscard]] auto find_chunk(int chunk_x, int chunk_y) const -> const StreamedChunk *;
+
+        // Tile type of a cached tile (nullopt if its chunk is not resident)
+        [[nodiscard]] auto get_tile_type(Vector2i position) const -> std::optional<Tile::Type>;
+
+        // Make every chunk within margin_chunks of the camera view resident, most recently
+        // used. Returns the number of chunks generated.
+        auto update(const Camera &camera, float tile_size,
+                    int margin_chunks = DEFAULT_MARGIN_CHUNKS) -> std::size_t;
+
+        // Chunk coordinates covering the camera view plus margin, clamped to the map
+        [[nodiscard]] auto get_chunk_range(const Camera &camera, float tile_size,
+                                           int margin_chunks) const -> Recti;
+
+        [[nodiscard]] auto get_chunks_x() const -> int;
+        [[nodiscard]] auto get_chunks_y() const -> int;
+        [[nodiscard]] auto get_cached_chunk_count() const -> std::size_t;
+        [[nodiscard]] auto get_capacity() const -> std::size_t;
+
+        // Total chunks generated so far, including evicted ones
+        [[nodiscard]] auto get_generated_count() const -> std::size_t;
+
+    private:
+        GeneratorConfig m_config;
+        MapGenerator m_generator;
+        std::size_t m_capacity;
+        std::size_t m_generated_count{0};
+
+        // Front is the most recently used chunk
+        std::list<StreamedChunk> m_chunks;
+        std::unordered_map<std::uint64_t, std::list<StreamedChunk>::iterator> m_index;
+
+        [[nodiscard]] static auto key_of(int chunk_x, int chunk_y) -> std::uint64_t;
+        void generate_chunk(StreamedChunk &chunk) const;
+    };
+} // namespace Tactics
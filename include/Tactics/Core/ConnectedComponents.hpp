@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Core/Vector2.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Tactics
+{
+    // Labels 4-connected regions of walkable tiles.
+    //
+    // A two-pass scan: the first pass hands out provisional labels row by row and merges those
+    // that touch in a union-find forest, the second resolves every tile to a dense component
+    // index and counts component sizes. Labels are row-major (y * width + x).
+    class ConnectedComponents
+    {
+    public:
+        static constexpr std::uint32_t NO_COMPONENT = 0xFFFFFFFFU;
+
+        // Label the grid and return the number of components
+        auto label(const Grid &grid) -> std::size_t;
+
+        // Component index of a tile, or nullopt for blocked or out-of-bounds tiles
+        [[nodiscard]] auto get_component_at(Vector2i position) const -> std::optional<std::size_t>;
+
+        [[nodiscard]] auto get_component_count() const -> std::size_t;
+        [[nodiscard]] auto get_component_sizes() const -> std::span<const std::size_t>;
+
+        // Index of the component with the most tiles (the lowest index on ties)
+        [[nodiscard]] auto get_largest_component() const -> std::optional<std::size_t>;
+
+        // Row-major component index per tile, NO_COMPONENT for blocked tiles
+        [[nodiscard]] auto get_labels() const -> std::span<const std::uint32_t>;
+
+    private:
+        int m_width{0};
+        int m_height{0};
+        std::vector<std::uint32_t> m_labels;
+        std::vector<std::uint32_t> m_parents;
+        std::vector<std::uint32_t> m_dense;
+        std::vector<std::size_t> m_sizes;
+
+        [[nodiscard]] auto find_root(std::uint32_t label) -> std::uint32_t;
+        void unite(std::uint32_t first, std::uint32_t second);
+    };
+} // namespace Tactics
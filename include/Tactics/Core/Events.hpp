@@ -5,6 +5,7 @@
 
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace Tactics::Events
 {
@@ -24,6 +25,8 @@ namespace Tactics::Events
         std::size_t unit_index{};
         GridPos from;
         GridPos to;
+        // Tiles walked from `from` to `to`, excluding `from`
+        std::vector<Vector2i> path;
     };
 
     struct CameraChanged
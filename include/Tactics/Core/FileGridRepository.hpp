@@ -0,0 +1,130 @@
+#pragma once
+
+#include "Tactics/Core/IGridRepository.hpp"
+#include "Tactics/Core/MappedFile.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Tactics
+{
+    // File-backed implementation of IGridRepository: one binary file per map.
+    //
+    // A map file is a fixed header, then the tile data, then an optional index of per-chunk
+    // content hashes, each section starting on a PAGE_SIZE boundary. The tile data is either
+    // the chunk-major tile type and move cost planes exactly as Grid holds them, which load_map
+    // copies into the grid in one pass, or a chunk table pointing at one encode_chunk_blob blob
+    // per chunk, which records the codec each plane was compressed with. load_map maps the file
+    // either way instead of parsing it. Files use native byte order.
+    class FileGridRepository : public IGridRepository
+    {
+    public:
+        static constexpr std::string_view DEFAULT_DIRECTORY = "maps";
+        static constexpr std::string_view MAP_EXTENSION = ".tgrid";
+        static constexpr std::string_view CONFIG_EXTENSION = ".tgen";
+        static constexpr std::uint32_t FORMAT_VERSION = 2;
+        static constexpr std::uint32_t CONFIG_FORMAT_VERSION = 1;
+        static constexpr std::uint64_t PAGE_SIZE = 4096;
+
+        // How save_map lays out tile data
+        enum class TileLayout : std::uint8_t
+        {
+            Planes,
+            EncodedChunks
+        };
+
+        // Constructor: stores maps under the directory (created on first save)
+        explicit FileGridRepository(std::filesystem::path directory, bool write_chunk_index = true,
+                                    TileLayout layout = TileLayout::EncodedChunks);
+
+        ~FileGridRepository() override = default;
+
+        // Delete copy constructor and assignment operator
+        FileGridRepository(const FileGridRepository &) = delete;
+        auto operator=(const FileGridRepository &) -> FileGridRepository & = delete;
+
+        // Move constructor
+        FileGridRepository(FileGridRepository &&other) noexcept;
+
+        // Move assignment operator
+        auto operator=(FileGridRepository &&other) noexcept -> FileGridRepository &;
+
+        // IGridRepository interface
+        [[nodiscard]] auto load_map(const std::string &map_name) -> std::optional<Grid> override;
+        auto save_map(const std::string &map_name, const Grid &grid) -> bool override;
+        auto save_map_changes(const std::string &map_name, const Grid &grid) -> bool override;
+        [[nodiscard]] auto get_map_size(const std::string &map_name)
+            -> std::optional<Vector2i> override;
+        [[nodiscard]] auto load_chunk(const std::string &map_name, const GridChunk &chunk)
+            -> bool override;
+        [[nodiscard]] auto list_maps() -> std::vector<MapMetadata> override;
+        [[nodiscard]] auto map_exists(const std::string &map_name) -> bool override;
+        auto delete_map(const std::string &map_name) -> bool override;
+        [[nodiscard]] auto load_generator_config(const std::string &map_name)
+            -> std::optional<GeneratorConfig> override;
+        auto save_generator_config(const std::string &map_name, const GeneratorConfig &config)
+            -> bool override;
+
+        // Per-chunk content hashes from the chunk index, row-major by chunk (empty if the map is
+        // missing or was saved without an index)
+        [[nodiscard]] auto load_chunk_hashes(const std::string &map_name)
+            -> std::vector<std::uint64_t>;
+
+        // Content hash of one chunk's type and cost entries, padding included
+        [[nodiscard]] static auto hash_chunk(const Grid &grid, int chunk_x, int chunk_y)
+            -> std::uint64_t;
+
+        [[nodiscard]] auto path_for(const std::string &map_name) const -> std::filesystem::path;
+        [[nodiscard]] auto get_directory() const -> const std::filesystem::path &;
+
+    private:
+        // Map file kept mapped between chunk reads
+        struct MappedMap
+        {
+            std::string name;
+            MappedFile file;
+            bool encoded_chunks{};
+            std::uint64_t types_offset{};
+            std::uint64_t costs_offset{};
+            std::uint64_t chunk_table_offset{};
+            int width{};
+            int height{};
+            int chunks_x{};
+            int chunks_y{};
+        };
+
+        std::filesystem::path m_directory;
+        bool m_write_chunk_index;
+        TileLayout m_layout;
+        std::optional<MappedMap> m_mapped;
+
+        // Helper: mapping of a map file, reused while the same map is read chunk by chunk
+        [[nodiscard]] auto open_mapped(const std::string &map_name) -> const MappedMap *;
+
+        // Helper: drop the mapping of a map that is about to be replaced or removed
+        void release_mapped(const std::string &map_name);
+
+        // Helper: copy or decode one chunk of a mapped file (chunk.coord must be in range)
+        [[nodiscard]] static auto read_chunk(const MappedMap &mapped, const GridChunk &chunk)
+            -> bool;
+
+        // Helper: map names become file names, so separators and dot files are rejected
+        [[nodiscard]] static auto is_valid_name(const std::string &map_name) -> bool;
+
+        [[nodiscard]] auto config_path_for(const std::string &map_name) const
+            -> std::filesystem::path;
+
+        // Helper: size and timestamps (unix seconds) from a map file's header
+        struct StoredMapInfo
+        {
+            int width{};
+            int height{};
+            std::int64_t created_at{};
+            std::int64_t updated_at{};
+        };
+        [[nodiscard]] static auto read_map_info(const std::filesystem::path &path)
+            -> std::optional<StoredMapInfo>;
+    };
+} // namespace Tactics
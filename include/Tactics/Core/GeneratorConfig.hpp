@@ -14,6 +14,7 @@ namespace Tactics
         static constexpr float DEFAULT_GRASS_THRESHOLD = 0.5F;
         static constexpr float DEFAULT_FOREST_THRESHOLD = 0.7F;
         static constexpr float DEFAULT_MOUNTAIN_THRESHOLD = 0.85F;
+        static constexpr int DEFAULT_THREAD_COUNT = 0;
 
         int width;
         int height;
@@ -29,6 +30,10 @@ namespace Tactics
         float forest_threshold;
         float mountain_threshold;
 
+        // Worker threads for generation (0 = one per hardware thread). Output does not
+        // depend on it, so it is a runtime setting and is not stored with the map.
+        int thread_count;
+
         [[nodiscard]] static constexpr auto default_config() -> GeneratorConfig
         {
             return GeneratorConfig{.width = DEFAULT_WIDTH,
@@ -40,7 +45,8 @@ namespace Tactics
                                    .water_threshold = DEFAULT_WATER_THRESHOLD,
                                    .grass_threshold = DEFAULT_GRASS_THRESHOLD,
                                    .forest_threshold = DEFAULT_FOREST_THRESHOLD,
-                                   .mountain_threshold = DEFAULT_MOUNTAIN_THRESHOLD};
+                                   .mountain_threshold = DEFAULT_MOUNTAIN_THRESHOLD,
+                                   .thread_count = DEFAULT_THREAD_COUNT};
         }
     };
 } // namespace Tactics
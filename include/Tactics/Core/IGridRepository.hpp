@@ -38,6 +38,20 @@ namespace Tactics
         // Save a grid with a name
         virtual auto save_map(const std::string &map_name, const Grid &grid) -> bool = 0;
 
+        // Save only the chunks marked dirty in the grid (loaded grids start clean). A new map or
+        // a size change falls back to a full save, and nothing is written if nothing changed.
+        // The caller clears the grid's dirty chunks once this succeeds
+        virtual auto save_map_changes(const std::string &map_name, const Grid &grid) -> bool = 0;
+
+        // Size of a stored map, read without its tiles
+        [[nodiscard]] virtual auto get_map_size(const std::string &map_name)
+            -> std::optional<Vector2i> = 0;
+
+        // Read the stored chunk at chunk.coord into the chunk's spans (CHUNK_TILE_COUNT entries
+        // each, laid out like a Grid chunk). Fails if the chunk is not stored
+        [[nodiscard]] virtual auto load_chunk(const std::string &map_name, const GridChunk &chunk)
+            -> bool = 0;
+
         // List all available maps
         [[nodiscard]] virtual auto list_maps() -> std::vector<MapMetadata> = 0;
 
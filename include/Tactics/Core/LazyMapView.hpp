@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Tactics/Components/Camera.hpp"
+#include "Tactics/Core/IGridRepository.hpp"
+#include "Tactics/Core/Rect.hpp"
+#include "Tactics/Core/Vector2.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace Tactics
+{
+    // Schedules the chunk-by-chunk load of a stored map. It holds no tiles itself: the caller
+    // reads each chunk with IGridRepository::load_chunk into its own storage.
+    //
+    // Opening only reads the map size, so it costs the same however large the map is. The view
+    // then says which chunks the camera covers, and which ones it is about to reach going by its
+    // recent velocity, so they can be read a few per frame before they are drawn. This spreads
+    // the load time of a large map over play; it does not by itself bound memory.
+    class LazyMapView
+    {
+    public:
+        static constexpr float DEFAULT_PREFETCH_SECONDS = 0.5F;
+        static constexpr std::size_t DEFAULT_PREFETCH_BUDGET = 4;
+
+        // Repository is only used to read the map size
+        LazyMapView(IGridRepository *repository, const std::string &map_name);
+
+        // True if the map exists in the repository
+        [[nodiscard]] auto is_open() const -> bool;
+
+        [[nodiscard]] auto get_width() const -> int;
+        [[nodiscard]] auto get_height() const -> int;
+        [[nodiscard]] auto get_chunks_x() const -> int;
+        [[nodiscard]] auto get_chunks_y() const -> int;
+
+        // Fold the camera motion since the last call into the smoothed velocity
+        void track_camera(const Camera &camera, float delta_time);
+
+        // Chunk coordinates overlapping a world-space rectangle, clamped to the map
+        [[nodiscard]] auto get_chunk_range(const Rectf &world_rect, float tile_size) const
+            -> Recti;
+
+        // Chunk coordinates of the camera view swept prefetch_seconds ahead along the camera
+        // velocity, clamped to the map (the view itself when the camera is still)
+        [[nodiscard]] auto get_prefetch_range(const Camera &camera, float tile_size,
+                                              float prefetch_seconds = DEFAULT_PREFETCH_SECONDS)
+            const -> Recti;
+
+        // Smoothed camera velocity in world units per second, as measured by track_camera()
+        [[nodiscard]] auto get_camera_velocity() const -> Vector2f;
+
+    private:
+        std::optional<Vector2i> m_size;
+        std::optional<Vector2f> m_last_camera_position;
+        Vector2f m_camera_velocity{0.0F, 0.0F};
+    };
+} // namespace Tactics
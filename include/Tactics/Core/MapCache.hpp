@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/MapGenerator.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string_view>
+
+namespace Tactics
+{
+    // On-disk cache of generated maps, addressed by a hash of the generator inputs.
+    //
+    // The key covers every GeneratorConfig field that affects the output (thread_count does
+    // not) and MapGenerator::VERSION, so changing the generator retires old entries. Entries
+    // store each chunk as an encode_chunk_blob blob, the format the grid repositories use.
+    class MapCache
+    {
+    public:
+        static constexpr std::string_view DEFAULT_DIRECTORY = "map_cache";
+        static constexpr std::uint32_t FORMAT_VERSION = 2;
+
+        explicit MapCache(std::filesystem::path directory);
+
+        // Content key for a config
+        [[nodiscard]] static auto key_of(const GeneratorConfig &config) -> std::uint64_t;
+
+        // Cached map for the config, or a freshly generated one that is then stored. A miss
+        // generates on the pool, if given (see MapGenerator)
+        [[nodiscard]] auto get_or_generate(const GeneratorConfig &config,
+                                           const MapGenerator::ProgressCallback &on_progress = {},
+                                           ThreadPool *pool = nullptr) -> Grid;
+
+        // Cached map for the config (nullopt on a miss or an unreadable entry)
+        [[nodiscard]] auto load(const GeneratorConfig &config) const -> std::optional<Grid>;
+
+        // Store a map generated from the config
+        auto store(const GeneratorConfig &config, const Grid &grid) const -> bool;
+
+        [[nodiscard]] auto path_for(std::uint64_t key) const -> std::filesystem::path;
+        [[nodiscard]] auto get_hit_count() const -> std::size_t;
+        [[nodiscard]] auto get_miss_count() const -> std::size_t;
+
+    private:
+        std::filesystem::path m_directory;
+
+        // Bumped from generation workers while the game thread may read them
+        std::atomic<std::size_t> m_hit_count{0};
+        std::atomic<std::size_t> m_miss_count{0};
+    };
+} // namespace Tactics
@@ -2,28 +2,56 @@
 
 #include "Tactics/Components/Grid.hpp"
 #include "Tactics/Components/Tile.hpp"
+#include "Tactics/Core/CellularAutomaton.hpp"
+#include "Tactics/Core/ConnectedComponents.hpp"
 #include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/ThreadPool.hpp"
+#include "Tactics/Core/ValueNoise.hpp"
 
+#include <cstdint>
+#include <functional>
+#include <memory>
 #include <vector>
 
 namespace Tactics
 {
-    // Procedural map generator using hybrid approach
+    // Procedural map generator using hybrid approach.
+    // Per-tile stages run in row bands on a worker pool. Each band only reads the previous
+    // stage's output, so the result is identical for any thread count.
     class MapGenerator
     {
     public:
-        explicit MapGenerator(const GeneratorConfig &config);
+        // Bump whenever generate() output changes for an unchanged config
+        static constexpr std::uint32_t VERSION = 1;
+
+        // Receives progress in [0, 1] on the thread running generate()
+        using ProgressCallback = std::function<void(float)>;
+
+        // A shared pool, if given, is used instead of config.thread_count and must outlive the
+        // generator. Otherwise a pool of the generator's own is started by the first generate()
+        explicit MapGenerator(const GeneratorConfig &config, ThreadPool *pool = nullptr);
+
+        // Report progress after each generation stage
+        void set_progress_callback(ProgressCallback callback);
+
+        // Replace the smoothing rule table (defaults to CellularAutomaton::majority_rules)
+        void set_smoothing_rules(std::vector<CellularAutomaton::Rule> rules);
 
         // Generate a new map
         [[nodiscard]] auto generate() -> Grid;
 
+        // Generate the terrain (stages 1-3) of a rectangle inside the map, row-major. Only the
+        // rectangle plus a cellular automata halo is computed, and the result matches the
+        // same tiles of a whole-map pass. Stage 4 needs the whole map and is not applied.
+        [[nodiscard]] auto generate_region(const Recti &region) const -> std::vector<Tile::Type>;
+
+        // Move cost the generator assigns to a tile type
+        [[nodiscard]] static auto move_cost_for(Tile::Type tile_type) -> int;
+
     private:
-        // Stage 1: Generate base heightmap using simple noise
+        // Stage 1: Generate base heightmap from fractal value noise
         [[nodiscard]] auto generate_heightmap() -> std::vector<float>;
 
-        // Simple noise function (no external dependencies)
-        [[nodiscard]] auto simple_noise(float x_pos, float y_pos) const -> float;
-
         // Stage 2: Convert heightmap to tile types
         [[nodiscard]] auto heightmap_to_tiles(const std::vector<float> &heightmap)
             -> std::vector<Tile::Type>;
@@ -34,26 +62,32 @@ namespace Tactics
         // Stage 4: Post-process for tactical features
         auto add_tactical_features(Grid &grid) -> void;
 
-        // Utility: Check if all walkable tiles are connected
+        // Utility: Connect every walkable region to the largest one
         auto ensure_connectivity(Grid &grid) -> void;
 
-        // Helper: Convert 2D coordinates to 1D index
-        [[nodiscard]] auto index_of(int x_pos, int y_pos) const -> size_t;
+        // Helper: Open the fewest blocked tiles linking each component to the largest one
+        void carve_corridors(Grid &grid, const ConnectedComponents &components) const;
 
-        // Helper: Count neighbors of a specific type
-        [[nodiscard]] auto count_neighbors(const std::vector<Tile::Type> &tiles, Vector2i position,
-                                           Tile::Type type) const -> int;
+        // Helper: Tile type for a height sample at a map position
+        [[nodiscard]] auto classify_height(int x_pos, int y_pos, float height) const -> Tile::Type;
 
-        // Helper: Flood fill to check connectivity
-        [[nodiscard]] auto flood_fill_count(const Grid &grid, Vector2i start) const -> int;
+        // Helper: Forward progress to the callback, if any
+        void report_progress(float progress) const;
 
-        // Helper: Count walkable neighbors on a grid
-        [[nodiscard]] static auto count_walkable_neighbors(const Grid &grid, Vector2i position)
-            -> int;
+        // Helper: Run body(row_begin, row_end) over one-chunk-tall row bands on the pool
+        void for_each_row_band(const std::function<void(int, int)> &body);
 
-        // Helper: Generate a deterministic hash value for noise
-        [[nodiscard]] auto hash_noise(int x_pos, int y_pos) const -> float;
+        // Helper: The shared pool, or the generator's own (started on first use)
+        [[nodiscard]] auto get_pool() -> ThreadPool &;
+
+        // Helper: Convert 2D coordinates to 1D index
+        [[nodiscard]] auto index_of(int x_pos, int y_pos) const -> size_t;
 
         GeneratorConfig m_config;
+        ProgressCallback m_on_progress;
+        ValueNoise m_noise;
+        CellularAutomaton m_automaton;
+        ThreadPool *m_shared_pool;
+        std::unique_ptr<ThreadPool> m_owned_pool;
     };
 } // namespace Tactics
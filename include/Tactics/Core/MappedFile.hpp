@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Tactics
+{
+    // Read-only view of a whole file.
+    //
+    // On POSIX systems the file is memory-mapped, so bytes are paged in on first touch. Other
+    // platforms read the file into memory instead; callers see the same span either way.
+    class MappedFile
+    {
+    public:
+        // Map a file (nullopt if it cannot be opened or mapped)
+        [[nodiscard]] static auto open(const std::filesystem::path &path)
+            -> std::optional<MappedFile>;
+
+        ~MappedFile();
+
+        // Delete copy constructor and assignment operator
+        MappedFile(const MappedFile &) = delete;
+        auto operator=(const MappedFile &) -> MappedFile & = delete;
+
+        MappedFile(MappedFile &&other) noexcept;
+        auto operator=(MappedFile &&other) noexcept -> MappedFile &;
+
+        [[nodiscard]] auto get_bytes() const -> std::span<const std::uint8_t>;
+        [[nodiscard]] auto get_size() const -> std::size_t;
+
+    private:
+        MappedFile() = default;
+
+        const std::uint8_t *m_data = nullptr;
+        std::size_t m_size = 0;
+
+        // Fallback storage when the file is read rather than mapped
+        std::vector<std::uint8_t> m_buffer;
+
+        void unmap();
+    };
+} // namespace Tactics
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Unit.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/SQLiteDatabase.hpp"
+#include "Tactics/Core/SQLiteGridRepository.hpp"
+#include "Tactics/Core/SQLiteUnitRepository.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Tactics
+{
+    // Write-behind persistence on a dedicated thread with its own SQLite connection.
+    //
+    // Saves take an immutable snapshot of their data and return at once with a future that
+    // resolves to the repository's result. Each map name has at most one queued job, and a
+    // save for a name that is still queued is coalesced into it: newer snapshots replace the
+    // queued ones they overlap, the job is written in one transaction and every caller shares
+    // its future. Saves for one map therefore never overtake each other. Destruction writes
+    // everything still queued before the thread exits.
+    class PersistenceWorker
+    {
+    public:
+        explicit PersistenceWorker(const std::string &db_path);
+        ~PersistenceWorker();
+
+        // Delete copy constructor and assignment operator
+        PersistenceWorker(const PersistenceWorker &) = delete;
+        auto operator=(const PersistenceWorker &) -> PersistenceWorker & = delete;
+
+        // Delete move constructor and assignment operator
+        PersistenceWorker(PersistenceWorker &&) = delete;
+        auto operator=(PersistenceWorker &&) -> PersistenceWorker & = delete;
+
+        // Queue saves (grid and units are copied before these return)
+        auto save_map(const std::string &map_name, const Grid &grid) -> std::shared_future<bool>;
+        auto save_units(const std::string &map_name, const std::vector<Unit> &units)
+            -> std::shared_future<bool>;
+        auto save_generator_config(const std::string &map_name, const GeneratorConfig &config)
+            -> std::shared_future<bool>;
+
+        // Queue map, units and optionally the generator config as one unit of work: they are
+        // committed in a single transaction, so a crash never leaves them out of step. Only the
+        // grid's dirty chunks are written; the caller may clear them once this returns, since
+        // the chunks of a write that fails are carried into the next grid save for the map
+        auto save_scene(const std::string &map_name, const Grid &grid,
+                        const std::vector<Unit> &units,
+                        const std::optional<GeneratorConfig> &config = std::nullopt)
+            -> std::shared_future<bool>;
+
+        // Block until every save queued so far has been written
+        void flush();
+
+        // Saves queued and not yet started
+        [[nodiscard]] auto get_pending_count() const -> std::size_t;
+
+        // Saves merged into an already queued one
+        [[nodiscard]] auto get_coalesced_count() const -> std::size_t;
+
+    private:
+        // Everything queued for one map; unset parts are left as they are in the database
+        struct Job
+        {
+            std::optional<Grid> grid;
+            // Write every chunk of the grid rather than only its dirty ones
+            bool full_map{false};
+            std::optional<std::vector<Unit>> units;
+            std::optional<GeneratorConfig> config;
+            std::promise<bool> promise;
+            std::shared_future<bool> future;
+        };
+
+        // Both repositories share the worker's connection so a scene commits in one transaction
+        std::shared_ptr<SQLiteDatabase> m_database;
+        SQLiteGridRepository m_grid_repository;
+        SQLiteUnitRepository m_unit_repository;
+
+        mutable std::mutex m_mutex;
+        std::condition_variable m_work_ready;
+        std::condition_variable m_idle;
+        std::deque<std::string> m_order;
+        std::map<std::string, Job> m_pending;
+        // Grids whose last write failed, dirty where the database is behind them
+        std::map<std::string, Grid> m_unsaved_grids;
+        bool m_busy{false};
+        bool m_stopping{false};
+        std::size_t m_coalesced_count{0};
+
+        // Declared last so the worker is joined before the state it uses is destroyed
+        std::jthread m_worker;
+
+        // Find or create the queued job for a map; the caller merges in its snapshot
+        auto enqueue(const std::string &map_name, const std::function<void(Job &)> &fill)
+            -> std::shared_future<bool>;
+        void run();
+        auto write(const std::string &map_name, Job &job) -> bool;
+        // Called with the lock held after a job's grid failed to write
+        void keep_unsaved_grid(const std::string &map_name, Job &job);
+    };
+} // namespace Tactics
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Tactics/Core/SQLiteStatementCache.hpp"
+#include <cstddef>
+#include <sqlite3.h>
+#include <string>
+
+namespace Tactics
+{
+    // One SQLite connection shared by the repositories built on it.
+    //
+    // Owns the connection's statement cache and tracks transaction depth, so repository writes
+    // join a caller's unit of work: only the outermost transaction commits, inner ones become
+    // savepoints. A connection belongs to one thread; other threads open their own.
+    class SQLiteDatabase
+    {
+    public:
+        // Opens or creates the database file and applies the connection pragmas
+        explicit SQLiteDatabase(const std::string &db_path);
+        ~SQLiteDatabase();
+
+        // Delete copy constructor and assignment operator
+        SQLiteDatabase(const SQLiteDatabase &) = delete;
+        auto operator=(const SQLiteDatabase &) -> SQLiteDatabase & = delete;
+
+        // Delete move constructor and assignment operator (shared through std::shared_ptr)
+        SQLiteDatabase(SQLiteDatabase &&) = delete;
+        auto operator=(SQLiteDatabase &&) -> SQLiteDatabase & = delete;
+
+        [[nodiscard]] auto is_open() const -> bool;
+        [[nodiscard]] auto get_handle() const -> sqlite3 *;
+        [[nodiscard]] auto get_path() const -> const std::string &;
+
+        // Most recent error reported by the connection
+        [[nodiscard]] auto get_error_message() const -> std::string;
+
+        // Cached prepared statement for the SQL text
+        [[nodiscard]] auto acquire(const std::string &sql) -> CachedStatement;
+
+        // Execute SQL that returns no rows
+        auto execute(const std::string &sql) -> bool;
+
+        // Transaction control; prefer SQLiteTransaction, which pairs these automatically
+        auto begin_transaction() -> bool;
+        auto commit_transaction() -> bool;
+        void rollback_transaction();
+
+        [[nodiscard]] auto get_transaction_depth() const -> int;
+
+        // Outermost transactions committed so far (each one is a single journal sync)
+        [[nodiscard]] auto get_commit_count() const -> std::size_t;
+
+        [[nodiscard]] auto get_statement_cache() const -> const SQLiteStatementCache &;
+
+    private:
+        std::string m_path;
+        sqlite3 *m_db = nullptr;
+
+        // Declared after m_db; the destructor finalizes it before closing the connection
+        SQLiteStatementCache m_statements;
+
+        int m_transaction_depth{0};
+        std::size_t m_commit_count{0};
+    };
+
+    // Unit of work on a SQLiteDatabase, rolled back on destruction unless committed.
+    //
+    // Transactions nest: one opened while another is active on the same database becomes a
+    // savepoint inside it, so several repository writes commit or fail together.
+    class SQLiteTransaction
+    {
+    public:
+        explicit SQLiteTransaction(SQLiteDatabase &database);
+        ~SQLiteTransaction();
+
+        // Delete copy constructor and assignment operator
+        SQLiteTransaction(const SQLiteTransaction &) = delete;
+        auto operator=(const SQLiteTransaction &) -> SQLiteTransaction & = delete;
+
+        // Delete move constructor and assignment operator
+        SQLiteTransaction(SQLiteTransaction &&) = delete;
+        auto operator=(SQLiteTransaction &&) -> SQLiteTransaction & = delete;
+
+        // False if the transaction failed to begin or has already finished
+        [[nodiscard]] auto is_active() const -> bool;
+
+        auto commit() -> bool;
+        void rollback();
+
+    private:
+        SQLiteDatabase &m_database;
+        bool m_active{false};
+    };
+} // namespace Tactics
@@ -1,19 +1,51 @@
 #pragma once
 
 #include "Tactics/Core/IGridRepository.hpp"
-#include <sqlite3.h>
+#include "Tactics/Core/SQLiteDatabase.hpp"
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
 
 namespace Tactics
 {
+    // One recorded version of a map
+    struct MapVersion
+    {
+        int version{};
+        std::string label;
+        int width{};
+        int height{};
+
+        // Chunks this version recorded: every chunk for the first version or after a resize,
+        // otherwise only those that changed since the previous version
+        int stored_chunk_count{};
+
+        std::string created_at;
+    };
+
+    // Chunks that differ between two versions of a map
+    struct MapVersionDiff
+    {
+        Vector2i from_size;
+        Vector2i to_size;
+
+        // Chunk coordinates, row-major over both versions' chunk ranges
+        std::vector<Vector2i> changed_chunks;
+    };
+
     // SQLite-backed implementation of IGridRepository
     class SQLiteGridRepository : public IGridRepository
     {
     public:
-        // Constructor: opens or creates the database file
+        // Constructor: opens or creates the database file on a connection of its own
         explicit SQLiteGridRepository(const std::string &db_path);
 
-        // Destructor: closes the database connection
-        ~SQLiteGridRepository() override;
+        // Constructor: works on a connection shared with other repositories
+        explicit SQLiteGridRepository(std::shared_ptr<SQLiteDatabase> database);
+
+        ~SQLiteGridRepository() override = default;
 
         // Delete copy constructor and assignment operator
         SQLiteGridRepository(const SQLiteGridRepository &) = delete;
@@ -28,6 +60,11 @@ namespace Tactics
         // IGridRepository interface
         [[nodiscard]] auto load_map(const std::string &map_name) -> std::optional<Grid> override;
         auto save_map(const std::string &map_name, const Grid &grid) -> bool override;
+        auto save_map_changes(const std::string &map_name, const Grid &grid) -> bool override;
+        [[nodiscard]] auto get_map_size(const std::string &map_name)
+            -> std::optional<Vector2i> override;
+        [[nodiscard]] auto load_chunk(const std::string &map_name, const GridChunk &chunk)
+            -> bool override;
         [[nodiscard]] auto list_maps() -> std::vector<MapMetadata> override;
         [[nodiscard]] auto map_exists(const std::string &map_name) -> bool override;
         auto delete_map(const std::string &map_name) -> bool override;
@@ -36,19 +73,94 @@ namespace Tactics
         auto save_generator_config(const std::string &map_name, const GeneratorConfig &config)
             -> bool override;
 
+        // Versioned snapshots of a stored map. Chunk contents are stored once per distinct
+        // content and shared by every version that uses them, and a version only records the
+        // chunks that changed since the previous one, so history grows with edits rather than
+        // with map size. Versions are numbered from 1 and kept until the map is deleted
+
+        // Record the grid as the next version of a saved map; returns the new version number
+        auto create_version(const std::string &map_name, const Grid &grid,
+                            const std::string &label = "") -> std::optional<int>;
+
+        // Versions of a map, oldest first
+        [[nodiscard]] auto list_versions(const std::string &map_name) -> std::vector<MapVersion>;
+
+        // The grid as of a version. All chunks are left dirty, since they may differ from the
+        // current map
+        [[nodiscard]] auto load_version(const std::string &map_name, int version)
+            -> std::optional<Grid>;
+
+        // Chunks that differ between two versions, compared by stored content without decoding
+        [[nodiscard]] auto diff_versions(const std::string &map_name, int from_version,
+                                         int to_version) -> std::optional<MapVersionDiff>;
+
+        // Overwrite the current map with a version; later versions are kept
+        auto restore_version(const std::string &map_name, int version) -> bool;
+
+        // Version of the per-chunk tile blob layout written by save_map (2: codec-tagged blobs
+        // from encode_chunk_blob; version 1 raw blobs are still read)
+        static constexpr int CHUNK_FORMAT_VERSION = 2;
+
+        // Version of the older whole-map tile blob, only read to migrate existing databases
+        static constexpr int TILE_BLOB_FORMAT_VERSION = 1;
+
     private:
-        sqlite3 *m_db = nullptr;
+        enum class BlobLoadResult : std::uint8_t
+        {
+            Loaded,
+            Missing,
+            Corrupt
+        };
+
+        std::shared_ptr<SQLiteDatabase> m_database;
 
         // Initialize database schema (creates tables if they don't exist)
         auto initialize_schema() -> bool;
 
-        // Helper: execute a SQL statement
-        auto execute_statement(const std::string &sql) -> bool;
+        // Helper: true while the connection is usable
+        [[nodiscard]] auto is_open() const -> bool;
 
         // Helper: get map ID by name
         [[nodiscard]] auto get_map_id(const std::string &map_name) -> std::optional<int>;
 
         // Helper: create or update map metadata
         auto upsert_map_metadata(const std::string &map_name, Vector2i size) -> std::optional<int>;
+
+        // Helper: stored map size and number of stored chunks
+        [[nodiscard]] auto load_map_size(int map_id) -> std::optional<Vector2i>;
+        [[nodiscard]] auto count_chunks(int map_id) -> int;
+
+        // Helper: read the per-chunk tile blobs of a map into an already sized grid
+        [[nodiscard]] auto load_chunks(int map_id, Grid &grid) -> BlobLoadResult;
+
+        // Helper: read the older whole-map tile blob into an already sized grid
+        [[nodiscard]] auto load_tile_blob(int map_id, Grid &grid) -> BlobLoadResult;
+
+        // Helper: read legacy per-tile rows into an already sized grid (false if any row cannot
+        // be read or holds an invalid tile type)
+        [[nodiscard]] auto load_tile_rows(int map_id, Grid &grid) -> bool;
+
+        // Helper: rewrite a map loaded from an older layout as chunks
+        [[nodiscard]] auto migrate_to_chunks(int map_id, const Grid &grid) -> bool;
+
+        // Helper: write every chunk, or only the dirty ones (caller owns the transaction)
+        auto write_chunks(int map_id, const Grid &grid, bool dirty_only) -> bool;
+
+        // Helper: drop the older whole-map blob and per-tile rows of a map
+        auto drop_legacy_tiles(int map_id) -> bool;
+
+        // Helper: stored size of one version of a map
+        [[nodiscard]] auto load_version_size(int map_id, int version) -> std::optional<Vector2i>;
+
+        // Helper: content id of every chunk as of a version, row-major (0 where none is stored)
+        [[nodiscard]] auto load_version_manifest(int map_id, int version, Vector2i size)
+            -> std::optional<std::vector<std::int64_t>>;
+
+        // Helper: id of a stored chunk blob with the same content, inserting it if there is none
+        [[nodiscard]] auto find_or_insert_content(std::span<const std::uint8_t> blob)
+            -> std::optional<std::int64_t>;
+
+        // Helper: drop the versions of a map and any chunk content no version uses any more
+        auto drop_versions(int map_id) -> bool;
     };
 } // namespace Tactics
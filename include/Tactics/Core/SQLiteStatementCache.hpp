@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <sqlite3.h>
+#include <string>
+#include <unordered_map>
+
+namespace Tactics
+{
+    // Borrowed handle to a statement owned by a SQLiteStatementCache.
+    //
+    // The statement is reset and its bindings cleared when the handle goes out of scope, so a
+    // read left mid-result never keeps a snapshot open between calls. Releasing the handle also
+    // returns the statement to its cache.
+    class CachedStatement
+    {
+    public:
+        CachedStatement() = default;
+        CachedStatement(sqlite3_stmt *stmt, bool *checked_out);
+        ~CachedStatement();
+
+        // Delete copy constructor and assignment operator
+        CachedStatement(const CachedStatement &) = delete;
+        auto operator=(const CachedStatement &) -> CachedStatement & = delete;
+
+        CachedStatement(CachedStatement &&other) noexcept;
+        auto operator=(CachedStatement &&other) noexcept -> CachedStatement &;
+
+        [[nodiscard]] auto get() const -> sqlite3_stmt *;
+        [[nodiscard]] explicit operator bool() const;
+
+    private:
+        sqlite3_stmt *m_stmt = nullptr;
+        bool *m_checked_out = nullptr;
+
+        void release();
+    };
+
+    // Prepared statements of one connection, keyed by their SQL text.
+    //
+    // A statement is prepared the first time its text is acquired and reused afterwards. Only
+    // one handle per SQL text may be live at a time: acquiring a statement that is still checked
+    // out logs an error and yields an empty handle rather than resetting it under its holder.
+    // clear() must run before the connection is closed, since sqlite3_close refuses to close
+    // with statements still prepared.
+    class SQLiteStatementCache
+    {
+    public:
+        SQLiteStatementCache() = default;
+        explicit SQLiteStatementCache(sqlite3 *db);
+        ~SQLiteStatementCache();
+
+        // Delete copy constructor and assignment operator
+        SQLiteStatementCache(const SQLiteStatementCache &) = delete;
+        auto operator=(const SQLiteStatementCache &) -> SQLiteStatementCache & = delete;
+
+        SQLiteStatementCache(SQLiteStatementCache &&other) noexcept;
+        auto operator=(SQLiteStatementCache &&other) noexcept -> SQLiteStatementCache &;
+
+        // Statement for the SQL text (empty handle, logged, if it fails to prepare or is
+        // already checked out)
+        [[nodiscard]] auto acquire(const std::string &sql) -> CachedStatement;
+
+        // Finalize every cached statement
+        void clear();
+
+        [[nodiscard]] auto get_statement_count() const -> std::size_t;
+
+        // Number of sqlite3_prepare_v2 calls made so far
+        [[nodiscard]] auto get_prepare_count() const -> std::size_t;
+
+    private:
+        struct Entry
+        {
+            sqlite3_stmt *stmt = nullptr;
+            // Set while a handle is live; map nodes never move, so handles can point at it
+            bool checked_out = false;
+        };
+
+        sqlite3 *m_db = nullptr;
+        std::unordered_map<std::string, Entry> m_statements;
+        std::size_t m_prepare_count{0};
+    };
+} // namespace Tactics
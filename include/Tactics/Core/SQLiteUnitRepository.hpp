@@ -1,7 +1,8 @@
 #pragma once
 
 #include "Tactics/Core/IUnitRepository.hpp"
-#include <sqlite3.h>
+#include "Tactics/Core/SQLiteDatabase.hpp"
+#include <memory>
 
 namespace Tactics
 {
@@ -9,7 +10,8 @@ namespace Tactics
     {
     public:
         explicit SQLiteUnitRepository(const std::string &db_path);
-        ~SQLiteUnitRepository() override;
+        explicit SQLiteUnitRepository(std::shared_ptr<SQLiteDatabase> database);
+        ~SQLiteUnitRepository() override = default;
 
         SQLiteUnitRepository(const SQLiteUnitRepository &) = delete;
         auto operator=(const SQLiteUnitRepository &) -> SQLiteUnitRepository & = delete;
@@ -22,9 +24,9 @@ namespace Tactics
             -> bool override;
 
     private:
-        sqlite3 *m_db = nullptr;
+        std::shared_ptr<SQLiteDatabase> m_database;
 
         auto initialize_schema() -> bool;
-        auto execute_statement(const std::string &sql) -> bool;
+        [[nodiscard]] auto is_open() const -> bool;
     };
 } // namespace Tactics
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tactics
+{
+    // Fixed set of worker threads for data-parallel loops. Workers sleep between jobs and pull
+    // item indices from a shared counter, so uneven items balance themselves out.
+    class ThreadPool
+    {
+    public:
+        // Task receives the item index and the index of the worker running it
+        using Task = std::function<void(std::size_t item, std::size_t worker)>;
+
+        // Zero picks one worker per hardware thread
+        explicit ThreadPool(std::size_t worker_count = 0);
+        ~ThreadPool();
+
+        // Delete copy constructor and assignment operator
+        ThreadPool(const ThreadPool &) = delete;
+        auto operator=(const ThreadPool &) -> ThreadPool & = delete;
+
+        // Delete move constructor and assignment operator
+        ThreadPool(ThreadPool &&) = delete;
+        auto operator=(ThreadPool &&) -> ThreadPool & = delete;
+
+        // Run task for every item in [0, item_count) and block until all are done.
+        // Call from one thread at a time; tasks must not call back into the pool.
+        void parallel_for(std::size_t item_count, const Task &task);
+
+        [[nodiscard]] auto get_worker_count() const -> std::size_t;
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_job_ready;
+        std::condition_variable m_job_done;
+
+        // Current job, guarded by m_mutex
+        const Task *m_task = nullptr;
+        std::size_t m_item_count = 0;
+        std::size_t m_next_item = 0;
+        std::size_t m_busy_workers = 0;
+        std::uint64_t m_job_generation = 0;
+        bool m_stopping = false;
+
+        // Declared last so workers are joined before the state they use is destroyed
+        std::vector<std::jthread> m_workers;
+
+        void worker_loop(std::size_t worker);
+    };
+} // namespace Tactics
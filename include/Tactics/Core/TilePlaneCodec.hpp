@@ -0,0 +1,129 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Tactics
+{
+    // Stored identifier of a tile plane codec (values are persisted; never renumber)
+    enum class TileCodecId : std::uint8_t
+    {
+        Raw = 0,
+        RunLength = 1,
+        Palette = 2
+    };
+
+    // Kernels for the run scan and palette expansion: AVX2 (32 bytes at a time), SSE4.1 (16) or
+    // scalar. Every kernel produces the same bytes, so stored data never depends on the CPU
+    enum class TileCodecBackend : std::uint8_t
+    {
+        Scalar,
+        SSE41,
+        AVX2
+    };
+
+    // Best backend available on this CPU
+    [[nodiscard]] auto detect_tile_codec_backend() -> TileCodecBackend;
+
+    // Encoding of one byte plane (tile types, or move costs as bytes)
+    class ITilePlaneCodec
+    {
+    public:
+        ITilePlaneCodec() = default;
+        virtual ~ITilePlaneCodec() = default;
+
+        ITilePlaneCodec(const ITilePlaneCodec &) = delete;
+        auto operator=(const ITilePlaneCodec &) -> ITilePlaneCodec & = delete;
+
+        ITilePlaneCodec(ITilePlaneCodec &&) = delete;
+        auto operator=(ITilePlaneCodec &&) -> ITilePlaneCodec & = delete;
+
+        [[nodiscard]] virtual auto get_id() const -> TileCodecId = 0;
+
+        // Append the encoded plane to out (false, with out unchanged, if the codec cannot
+        // represent the plane)
+        virtual auto encode(std::span<const std::uint8_t> plane,
+                            std::vector<std::uint8_t> &out) const -> bool = 0;
+
+        // Decode into plane, which must be exactly the size that was encoded (false if the
+        // encoded bytes are malformed or do not fill the plane)
+        [[nodiscard]] virtual auto decode(std::span<const std::uint8_t> encoded,
+                                          std::span<std::uint8_t> plane) const -> bool = 0;
+    };
+
+    // Bytes stored verbatim
+    class RawCodec final : public ITilePlaneCodec
+    {
+    public:
+        [[nodiscard]] auto get_id() const -> TileCodecId override;
+        auto encode(std::span<const std::uint8_t> plane, std::vector<std::uint8_t> &out) const
+            -> bool override;
+        [[nodiscard]] auto decode(std::span<const std::uint8_t> encoded,
+                                  std::span<std::uint8_t> plane) const -> bool override;
+    };
+
+    // Runs of one value as (value, 16-bit little-endian length) triples. Runs are found a vector
+    // (or, in scalar code, eight bytes) at a time, so long homogeneous regions cost one
+    // comparison per block
+    class RunLengthCodec final : public ITilePlaneCodec
+    {
+    public:
+        RunLengthCodec();
+
+        [[nodiscard]] auto get_id() const -> TileCodecId override;
+        auto encode(std::span<const std::uint8_t> plane, std::vector<std::uint8_t> &out) const
+            -> bool override;
+        [[nodiscard]] auto decode(std::span<const std::uint8_t> encoded,
+                                  std::span<std::uint8_t> plane) const -> bool override;
+
+        // Force a backend (unsupported ones fall back to the best supported one)
+        void set_backend(TileCodecBackend backend);
+        [[nodiscard]] auto get_backend() const -> TileCodecBackend;
+
+    private:
+        TileCodecBackend m_backend;
+    };
+
+    // Up to MAX_PALETTE distinct values: the palette, then one 0/1/2/4-bit index per entry packed
+    // low bits first. Decoding shuffles 4-bit indices through the palette a vector at a time and
+    // expands narrower ones a packed byte at a time through a lookup table
+    class PaletteCodec final : public ITilePlaneCodec
+    {
+    public:
+        static constexpr int MAX_PALETTE = 16;
+
+        PaletteCodec();
+
+        [[nodiscard]] auto get_id() const -> TileCodecId override;
+        auto encode(std::span<const std::uint8_t> plane, std::vector<std::uint8_t> &out) const
+            -> bool override;
+        [[nodiscard]] auto decode(std::span<const std::uint8_t> encoded,
+                                  std::span<std::uint8_t> plane) const -> bool override;
+
+        // Force a backend (unsupported ones fall back to the best supported one)
+        void set_backend(TileCodecBackend backend);
+        [[nodiscard]] auto get_backend() const -> TileCodecBackend;
+
+    private:
+        TileCodecBackend m_backend;
+    };
+
+    // Codec registered under an id (nullptr for unknown ids, e.g. from a corrupt file)
+    [[nodiscard]] auto find_tile_codec(TileCodecId codec_id) -> const ITilePlaneCodec *;
+
+    // Encode with whichever registered codec gives the smallest output; returns its id
+    auto encode_tile_plane(std::span<const std::uint8_t> plane, std::vector<std::uint8_t> &out)
+        -> TileCodecId;
+
+    // Chunk blob shared by the grid repositories, both planes of one chunk in chunk-local
+    // order (padding included):
+    //   [1 byte] tile type codec id, [1 byte] move cost codec id
+    //   [4 bytes] encoded tile type size, little-endian
+    //   [encoded tile types][encoded move costs]
+    // Decoding fails on a malformed blob or a tile type past Tile::Type::Wall
+    void encode_chunk_blob(const ConstGridChunk &chunk, std::vector<std::uint8_t> &out);
+    [[nodiscard]] auto decode_chunk_blob(std::span<const std::uint8_t> blob,
+                                         const GridChunk &chunk) -> bool;
+} // namespace Tactics
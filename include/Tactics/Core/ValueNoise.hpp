@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+namespace Tactics
+{
+    // Seeded 2D value noise with fractal (octave) sums for heightmaps.
+    //
+    // Rows are evaluated with the widest kernel the CPU supports (AVX2 with 8 lanes, SSE4.1 with
+    // 4 lanes, or scalar). Every kernel performs the same float operations in the same order as
+    // the scalar path, so output is bit-identical whichever backend runs.
+    class ValueNoise
+    {
+    public:
+        enum class Backend : std::uint8_t
+        {
+            Scalar,
+            SSE41,
+            AVX2
+        };
+
+        explicit ValueNoise(int seed);
+
+        // Smoothly interpolated noise in [0, 1] at a sample position
+        [[nodiscard]] auto sample(float x_pos, float y_pos) const -> float;
+
+        // Lattice value in [0, 1] for an integer position
+        [[nodiscard]] auto hash(int x_pos, int y_pos) const -> float;
+
+        // Fractal noise for tiles (x_begin + i, y_pos), normalised and clamped to [0, 1].
+        // Octave frequencies start at base_frequency and double; amplitudes halve.
+        void fractal_row(int y_pos, int x_begin, std::span<float> out, float base_frequency,
+                         int octaves) const;
+
+        // Best backend available on this CPU
+        [[nodiscard]] static auto detect_backend() -> Backend;
+
+        // Force a backend (unsupported ones fall back to the best supported one)
+        void set_backend(Backend backend);
+        [[nodiscard]] auto get_backend() const -> Backend;
+
+    private:
+        std::uint32_t m_seed;
+        Backend m_backend;
+
+        // Row kernels; SIMD kernels hand any remainder shorter than a vector to the scalar one
+        void fractal_row_scalar(int y_pos, int x_begin, std::span<float> out,
+                                float base_frequency, int octaves) const;
+        void fractal_row_sse41(int y_pos, int x_begin, std::span<float> out, float base_frequency,
+                               int octaves) const;
+        void fractal_row_avx2(int y_pos, int x_begin, std::span<float> out, float base_frequency,
+                              int octaves) const;
+    };
+} // namespace Tactics
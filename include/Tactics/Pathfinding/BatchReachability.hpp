@@ -0,0 +1,75 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Core/ThreadPool.hpp"
+#include "Tactics/Pathfinding/ReachabilitySearch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Tactics
+{
+    // One bit per tile, indexed by Grid::index_of
+    class TileBitset
+    {
+    public:
+        // Resize to tile_count bits, all cleared (word storage is kept)
+        void reset(std::size_t tile_count);
+
+        void set(std::size_t index);
+        [[nodiscard]] auto test(std::size_t index) const -> bool;
+
+        // Number of set bits
+        [[nodiscard]] auto count() const -> std::size_t;
+        [[nodiscard]] auto size() const -> std::size_t;
+
+    private:
+        std::vector<std::uint64_t> m_words;
+        std::size_t m_size = 0;
+    };
+
+    // Start tile and budget of one unit in a batch
+    struct ReachabilityQuery
+    {
+        Vector2i start;
+        int move_points{0};
+    };
+
+    // Reachable sets for many units at once, spread over a thread pool. Every worker owns a
+    // ReachabilitySearch, so the per-tile buffers are reused and never shared between threads.
+    class BatchReachability
+    {
+    public:
+        // Zero picks one worker per hardware thread. The pool is started by the first compute()
+        explicit BatchReachability(std::size_t worker_count = 0);
+        ~BatchReachability() = default;
+
+        // Delete copy constructor and assignment operator
+        BatchReachability(const BatchReachability &) = delete;
+        auto operator=(const BatchReachability &) -> BatchReachability & = delete;
+
+        // Delete move constructor and assignment operator
+        BatchReachability(BatchReachability &&) = delete;
+        auto operator=(BatchReachability &&) -> BatchReachability & = delete;
+
+        // Compute one reachable set per query; tiles flagged in blocked are never entered.
+        // A query's own start tile may be flagged (all units can share one occupancy mask).
+        void compute(const Grid &grid, std::span<const ReachabilityQuery> queries,
+                     const std::vector<bool> &blocked);
+
+        // Reachable tiles per query, in query order
+        [[nodiscard]] auto get_results() const -> std::span<const TileBitset>;
+
+        [[nodiscard]] auto is_reachable(const Grid &grid, std::size_t query,
+                                        const Vector2i &position) const -> bool;
+
+    private:
+        std::size_t m_worker_count;
+        std::unique_ptr<ThreadPool> m_pool;
+        std::vector<ReachabilitySearch> m_worker_searches;
+        std::vector<TileBitset> m_results;
+    };
+} // namespace Tactics
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace Tactics
+{
+    // Priority queue for small non-negative integer priorities (move costs, path lengths).
+    // One bucket per priority; push is O(1) and pop scans forward from the lowest non-empty
+    // bucket. Bucket storage is kept across reset() calls so repeated searches don't allocate.
+    template <typename T>
+    class BucketQueue
+    {
+    public:
+        struct Entry
+        {
+            T value;
+            int priority;
+        };
+
+        // Empty the queue and pre-size buckets for priorities in [0, max_priority]
+        void reset(int max_priority);
+
+        // Push a value (negative priorities are ignored, larger ones grow the bucket array)
+        void push(const T &value, int priority);
+
+        // Pop a value with the lowest priority (nullopt when empty)
+        [[nodiscard]] auto pop() -> std::optional<Entry>;
+
+        [[nodiscard]] auto empty() const -> bool;
+        [[nodiscard]] auto size() const -> std::size_t;
+
+    private:
+        std::vector<std::vector<T>> m_buckets;
+        int m_current = 0;
+        std::size_t m_size = 0;
+    };
+} // namespace Tactics
+
+// Template implementation
+namespace Tactics
+{
+    template <typename T>
+    void BucketQueue<T>::reset(int max_priority)
+    {
+        const auto bucket_count = static_cast<std::size_t>(max_priority + 1);
+        if (m_buckets.size() < bucket_count)
+        {
+            m_buckets.resize(bucket_count);
+        }
+
+        for (auto &bucket : m_buckets)
+        {
+            bucket.clear();
+        }
+
+        m_current = 0;
+        m_size = 0;
+    }
+
+    template <typename T>
+    void BucketQueue<T>::push(const T &value, int priority)
+    {
+        if (priority < 0)
+        {
+            return;
+        }
+
+        if (static_cast<std::size_t>(priority) >= m_buckets.size())
+        {
+            m_buckets.resize(static_cast<std::size_t>(priority + 1));
+        }
+
+        m_buckets[static_cast<std::size_t>(priority)].push_back(value);
+        m_current = priority < m_current ? priority : m_current;
+        ++m_size;
+    }
+
+    template <typename T>
+    auto BucketQueue<T>::pop() -> std::optional<Entry>
+    {
+        if (m_size == 0)
+        {
+            return std::nullopt;
+        }
+
+        while (m_buckets[static_cast<std::size_t>(m_current)].empty())
+        {
+            ++m_current;
+        }
+
+        auto &bucket = m_buckets[static_cast<std::size_t>(m_current)];
+        Entry entry{.value = bucket.back(), .priority = m_current};
+        bucket.pop_back();
+        --m_size;
+        return entry;
+    }
+
+    template <typename T>
+    auto BucketQueue<T>::empty() const -> bool
+    {
+        return m_size == 0;
+    }
+
+    template <typename T>
+    auto BucketQueue<T>::size() const -> std::size_t
+    {
+        return m_size;
+    }
+} // namespace Tactics
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Pathfinding/BucketQueue.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Tactics
+{
+    // Distance and direction fields toward one or more goal tiles, shared by every unit heading
+    // for the same objective. A single reverse Dijkstra pass over the move-cost plane gives each
+    // tile its cost to the nearest goal and the first step to take; lookups are then O(1).
+    //
+    // Move cost rules match ReachabilitySearch: a step costs the move cost of the tile entered,
+    // walls are never entered and blocked tiles are never passed through. Blocked tiles still get
+    // a distance and direction, so a unit standing on an occupied tile can read its own step.
+    class FlowField
+    {
+    public:
+        FlowField() = default;
+        ~FlowField() = default;
+
+        FlowField(const FlowField &) = delete;
+        auto operator=(const FlowField &) -> FlowField & = delete;
+
+        FlowField(FlowField &&) noexcept = default;
+        auto operator=(FlowField &&) noexcept -> FlowField & = default;
+
+        // Recompute only if the grid revision, goals or occupancy revision differ from the cached
+        // field. Tiles flagged in blocked (by Grid::index_of) are never passed through; a mask
+        // that does not cover the grid, such as an empty one, blocks nothing.
+        // Returns true if the field was recomputed.
+        auto update(const Grid &grid, std::span<const Vector2i> goals,
+                    const std::vector<bool> &blocked, std::uint64_t occupancy_revision) -> bool;
+
+        // Unconditionally recompute the field
+        void compute(const Grid &grid, std::span<const Vector2i> goals,
+                     const std::vector<bool> &blocked);
+
+        // Drop the cached field so the next update recomputes
+        void invalidate();
+
+        // Cost to the nearest goal (-1 if no goal can be reached)
+        [[nodiscard]] auto get_distance(const Grid &grid, const Vector2i &position) const -> int;
+
+        // Next tile to enter toward the nearest goal (nullopt at a goal or if unreachable)
+        [[nodiscard]] auto get_next_step(const Grid &grid, const Vector2i &position) const
+            -> std::optional<Vector2i>;
+
+        // Distance per tile by Grid::index_of (-1 if unreachable)
+        [[nodiscard]] auto get_distances() const -> std::span<const int>;
+
+        [[nodiscard]] auto has_result() const -> bool;
+
+    private:
+        static constexpr std::uint8_t NO_DIRECTION = 0xFF;
+
+        std::vector<int> m_distances;
+        std::vector<std::uint8_t> m_directions;
+        BucketQueue<Vector2i> m_frontier;
+
+        // Cache key of the current field
+        std::vector<Vector2i> m_goals;
+        std::uint64_t m_grid_revision = 0;
+        std::uint64_t m_occupancy_revision = 0;
+        bool m_valid = false;
+    };
+} // namespace Tactics
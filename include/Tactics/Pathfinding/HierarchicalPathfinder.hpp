@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Pathfinding/BucketQueue.hpp"
+#include "Tactics/Pathfinding/Pathfinder.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Tactics
+{
+    // Hierarchical pathfinding (HPA*) for long-distance queries on large grids.
+    //
+    // The grid is cut into clusters that match the grid chunks. Walkable stretches along each
+    // cluster border become entrances with one abstract node per side; nodes of a cluster are
+    // linked by precomputed intra-cluster path costs. Queries search this abstract graph and only
+    // refine the segments that are asked for. Clusters are rebuilt lazily from the grid's chunk
+    // revisions, so a set_tile only rebuilds the touched cluster and its direct neighbours.
+    //
+    // Routing is terrain-only: unit occupancy is left to the short-range Pathfinder.
+    class HierarchicalPathfinder
+    {
+    public:
+        static constexpr int CLUSTER_SIZE = Grid::CHUNK_SIZE;
+
+        HierarchicalPathfinder() = default;
+        ~HierarchicalPathfinder() = default;
+
+        HierarchicalPathfinder(const HierarchicalPathfinder &) = delete;
+        auto operator=(const HierarchicalPathfinder &) -> HierarchicalPathfinder & = delete;
+
+        HierarchicalPathfinder(HierarchicalPathfinder &&) noexcept = default;
+        auto operator=(HierarchicalPathfinder &&) noexcept -> HierarchicalPathfinder & = default;
+
+        // Bring the abstract graph up to date with the grid (called by every query)
+        void update(const Grid &grid);
+
+        // Waypoints from start to goal (inclusive) through cluster entrances
+        [[nodiscard]] auto find_abstract_path(const Grid &grid, const Vector2i &start,
+                                              const Vector2i &goal)
+            -> std::optional<std::vector<Vector2i>>;
+
+        // Concrete tiles between two consecutive waypoints of an abstract path
+        [[nodiscard]] auto refine_segment(const Grid &grid, const Vector2i &from,
+                                          const Vector2i &to) -> std::optional<Path>;
+
+        // Abstract search followed by refinement of every segment
+        [[nodiscard]] auto find_path(const Grid &grid, const Vector2i &start,
+                                     const Vector2i &goal) -> std::optional<Path>;
+
+        [[nodiscard]] auto get_abstract_node_count() const -> int;
+
+        // Number of clusters rebuilt by the last update
+        [[nodiscard]] auto get_rebuilt_cluster_count() const -> int;
+
+    private:
+        struct Edge
+        {
+            Vector2i target;
+            int cost;
+        };
+
+        struct Cluster
+        {
+            std::vector<Vector2i> nodes;
+            std::vector<std::vector<Edge>> edges;
+            std::uint64_t revision = 0;
+        };
+
+        int m_width = 0;
+        int m_height = 0;
+        int m_clusters_x = 0;
+        int m_clusters_y = 0;
+        std::vector<Cluster> m_clusters;
+        int m_rebuilt_cluster_count = 0;
+
+        // Cluster-local search scratch, indexed by local tile index within m_search_bounds
+        Recti m_search_bounds;
+        std::vector<int> m_local_cost;
+        std::vector<std::uint8_t> m_local_parent;
+        BucketQueue<Vector2i> m_local_open;
+
+        // Abstract search scratch, indexed by Grid::index_of and reset by generation stamp
+        std::vector<std::uint32_t> m_abstract_open_stamp;
+        std::vector<std::uint32_t> m_abstract_closed_stamp;
+        std::vector<int> m_abstract_cost;
+        std::vector<Vector2i> m_abstract_parent;
+        std::uint32_t m_generation = 0;
+        BucketQueue<Vector2i> m_abstract_open;
+        std::vector<Edge> m_start_edges;
+        std::vector<Edge> m_goal_edges;
+
+        [[nodiscard]] auto cluster_at(int cluster_x, int cluster_y) -> Cluster &;
+
+        // Outgoing edges of the abstract node at position (nullptr if it is not a node)
+        [[nodiscard]] auto node_edges(const Vector2i &position) -> const std::vector<Edge> *;
+
+        // Recompute entrance nodes and inter-cluster edges of one cluster
+        void rebuild_cluster_nodes(const Grid &grid, int cluster_x, int cluster_y);
+
+        // Recompute intra-cluster edges between the nodes of one cluster
+        void rebuild_cluster_edges(const Grid &grid, int cluster_x, int cluster_y);
+
+        // Add the entrances of one cluster border facing direction
+        void add_border_entrances(const Grid &grid, Cluster &cluster, const Recti &bounds,
+                                  const Vector2i &direction);
+
+        // Dijkstra restricted to the cluster containing source. Forward costs are paid on entry;
+        // reverse costs give the price of walking from each tile to source. Stops once stop_at
+        // is settled.
+        void search_cluster(const Grid &grid, const Vector2i &source, bool reverse,
+                            const std::optional<Vector2i> &stop_at);
+
+        // Cost from the last cluster search (-1 if unreached or outside the searched cluster)
+        [[nodiscard]] auto local_cost_at(const Vector2i &position) const -> int;
+
+        // Start a new abstract search generation
+        void prepare_abstract_search(const Grid &grid);
+    };
+} // namespace Tactics
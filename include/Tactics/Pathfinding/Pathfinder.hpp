@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Pathfinding/BucketQueue.hpp"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace Tactics
+{
+    // Result of a path query
+    struct Path
+    {
+        // Tiles entered from start to goal; excludes start, ends with goal
+        std::vector<Vector2i> steps;
+        // Sum of move costs of the entered tiles
+        int cost{0};
+    };
+
+    // A* shortest-path queries over a Grid's move-cost plane with a Manhattan heuristic.
+    // Open and closed sets are flat arrays indexed by Grid::index_of; they are sized once per
+    // grid and invalidated between queries by bumping a generation stamp instead of clearing.
+    // The heuristic assumes walkable tiles cost at least 1.
+    class Pathfinder
+    {
+    public:
+        Pathfinder() = default;
+        ~Pathfinder() = default;
+
+        Pathfinder(const Pathfinder &) = delete;
+        auto operator=(const Pathfinder &) -> Pathfinder & = delete;
+
+        Pathfinder(Pathfinder &&) noexcept = default;
+        auto operator=(Pathfinder &&) noexcept -> Pathfinder & = default;
+
+        // Find the cheapest path; tiles flagged in blocked (by Grid::index_of) are never entered,
+        // and a mask that does not cover the grid blocks nothing. Returns nullopt if the goal
+        // cannot be reached.
+        [[nodiscard]] auto find_path(const Grid &grid, const Vector2i &start, const Vector2i &goal,
+                                     const std::vector<bool> &blocked) -> std::optional<Path>;
+
+        // Number of nodes expanded by the last query
+        [[nodiscard]] auto get_expanded_count() const -> int;
+
+    private:
+        static constexpr std::uint8_t NO_PARENT = 0xFF;
+
+        std::vector<std::uint32_t> m_open_stamp;
+        std::vector<std::uint32_t> m_closed_stamp;
+        std::vector<int> m_cost_so_far;
+        std::vector<std::uint8_t> m_parent_direction;
+        std::uint32_t m_generation = 0;
+        BucketQueue<Vector2i> m_open;
+        int m_expanded_count = 0;
+
+        // Size buffers to the grid and start a new generation
+        void prepare(const Grid &grid);
+
+        // Walk parent directions back from goal to start
+        [[nodiscard]] auto reconstruct_path(const Grid &grid, const Vector2i &start,
+                                            const Vector2i &goal) const -> Path;
+    };
+} // namespace Tactics
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Pathfinding/BucketQueue.hpp"
+
+#include <span>
+#include <vector>
+
+namespace Tactics
+{
+    // Cost-ordered (Dijkstra) search for every tile a unit can reach with a move point budget.
+    // Each tile is expanded at most once. Work buffers are indexed by Grid::index_of and kept
+    // between searches, so repeated selections on the same grid do not allocate.
+    class ReachabilitySearch
+    {
+    public:
+        ReachabilitySearch() = default;
+        ~ReachabilitySearch() = default;
+
+        ReachabilitySearch(const ReachabilitySearch &) = delete;
+        auto operator=(const ReachabilitySearch &) -> ReachabilitySearch & = delete;
+
+        ReachabilitySearch(ReachabilitySearch &&) noexcept = default;
+        auto operator=(ReachabilitySearch &&) noexcept -> ReachabilitySearch & = default;
+
+        // Run the search from start; tiles flagged in blocked (by Grid::index_of) are never entered.
+        // A mask that does not cover the grid, such as an empty one, blocks nothing.
+        void compute(const Grid &grid, const Vector2i &start, int move_points,
+                     const std::vector<bool> &blocked);
+
+        // Forget the last result (buffers keep their capacity)
+        void clear();
+
+        // Remaining move points per tile after the last search (-1 if unreachable)
+        [[nodiscard]] auto get_remaining_move_points() const -> std::span<const int>;
+
+        // Check a position against the last search
+        [[nodiscard]] auto is_reachable(const Grid &grid, const Vector2i &position) const -> bool;
+
+        [[nodiscard]] auto has_result() const -> bool;
+
+        // Number of tiles expanded by the last search
+        [[nodiscard]] auto get_expanded_count() const -> int;
+
+    private:
+        std::vector<int> m_remaining_move_points;
+        BucketQueue<Vector2i> m_frontier;
+        int m_expanded_count = 0;
+    };
+} // namespace Tactics
@@ -4,9 +4,15 @@
 #include "Tactics/Components/Grid.hpp"
 
 #include <SDL3/SDL.h>
+#include <cstddef>
+#include <vector>
 
 namespace Tactics
 {
+    // Draws the visible tiles as two batched geometry submissions per frame: one quad per tile
+    // with its type colour baked into the vertices, then the tile borders as thin quads along
+    // each grid line. Vertex and index buffers are kept between frames, so a steady view
+    // allocates nothing
     class GridRenderer
     {
     public:
@@ -19,7 +25,21 @@ namespace Tactics
         GridRenderer(GridRenderer &&) = delete;
         auto operator=(GridRenderer &&) -> GridRenderer & = delete;
 
-        [[nodiscard]] static auto render(SDL_Renderer *renderer, const Grid &grid,
-                                         const Camera &camera, float tile_size) -> bool;
+        [[nodiscard]] auto render(SDL_Renderer *renderer, const Grid &grid, const Camera &camera,
+                                  float tile_size) -> bool;
+
+    private:
+        std::vector<SDL_Vertex> m_tile_vertices;
+        std::vector<SDL_Vertex> m_border_vertices;
+
+        // Shared by both passes: every quad uses the same two triangles
+        std::vector<int> m_quad_indices;
+
+        // Helper: grow the index buffer to cover quad_count quads
+        void grow_quad_indices(std::size_t quad_count);
+
+        // Helper: submit a vertex buffer of quads in one call
+        [[nodiscard]] auto submit_quads(SDL_Renderer *renderer,
+                                        const std::vector<SDL_Vertex> &vertices) const -> bool;
     };
 } // namespace Tactics
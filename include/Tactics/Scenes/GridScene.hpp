@@ -8,21 +8,34 @@
 #include "Tactics/Components/Grid.hpp"
 #include "Tactics/Components/UnitController.hpp"
 #include "Tactics/Components/ZoomController.hpp"
+#include "Tactics/Core/AsyncMapGenerator.hpp"
 #include "Tactics/Core/EventBus.hpp"
 #include "Tactics/Core/GameConfig.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
 #include "Tactics/Core/IGridRepository.hpp"
 #include "Tactics/Core/IUnitRepository.hpp"
+#include "Tactics/Core/LazyMapView.hpp"
+#include "Tactics/Core/MapCache.hpp"
+#include "Tactics/Core/PersistenceWorker.hpp"
 #include "Tactics/Core/Scene.hpp"
+#include "Tactics/Renderers/GridRenderer.hpp"
 
 #include <SDL3/SDL.h>
+#include <cstddef>
+#include <limits>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace Tactics
 {
     class GridScene : public Scene, public Publisher, public Subscriber
     {
     public:
+        // Saves go through the persistence worker when one is given, else straight to the
+        // repositories on the calling thread
         explicit GridScene(IGridRepository *repository, IUnitRepository *unit_repository,
+                           PersistenceWorker *persistence = nullptr,
                            std::string map_name = "default");
         ~GridScene() override = default;
 
@@ -51,12 +64,55 @@ namespace Tactics
         CursorController m_cursor_controller;
         UnitController m_unit_controller;
         ZoomController m_zoom_controller;
+        GridRenderer m_grid_renderer;
 
         IGridRepository *m_grid_repository = nullptr;
         IUnitRepository *m_unit_repository = nullptr;
+        PersistenceWorker *m_persistence = nullptr;
         std::string m_map_name;
+
+        // The config the current map came from, kept here because the repository copy may
+        // still be queued behind the persistence worker
+        GeneratorConfig m_generator_config = GeneratorConfig::default_config();
+        MapCache m_map_cache{MapCache::DEFAULT_DIRECTORY};
+        AsyncMapGenerator m_map_generator{&m_map_cache};
         bool m_running = false;
 
         SubscriptionId m_map_regenerated_subscription_id{0U};
+
+        // Chunk-by-chunk load of the stored map, set until every chunk has been visited. Chunks
+        // are only read once they come into view or a unit search reaches them, straight into
+        // m_grid; the view picks the chunks to read ahead of the camera. m_grid holds planes for
+        // the whole map from the start, since the renderer and the searches index them, so this
+        // spreads the load time of a large map over play but does not save memory
+        std::optional<LazyMapView> m_map_view;
+        std::vector<bool> m_filled_chunks;
+        std::size_t m_unfilled_chunk_count{0};
+
+        // Replace the map with a finished background generation and announce it
+        void swap_in_map(GeneratedMap generated);
+
+        // Read the chunks in view, and a few ahead of a moving camera, into the grid
+        auto fill_in_view(float delta_time) -> bool;
+
+        // Read the chunks overlapping a tile region into the grid, e.g. ahead of a unit search
+        auto fill_region(const Recti &tiles) -> bool;
+
+        // Read a range of chunks into the grid, stopping after budget reads. Falls back to
+        // loading the whole map if a chunk cannot be read on its own; if that fails too, ends
+        // the scene and returns false
+        auto fill_chunk_range(const Recti &chunks,
+                              std::size_t budget = std::numeric_limits<std::size_t>::max())
+            -> bool;
+
+        // Helper: read one chunk from the repository into the grid (false if it cannot be read)
+        auto fill_chunk(int chunk_x, int chunk_y) -> bool;
+
+        // Helper: fill every chunk not filled in yet from a full repository load, keeping the
+        // chunks already filled in or edited
+        auto load_whole_map() -> bool;
+
+        // Helper: drop the map view once the grid holds every chunk
+        void finish_fill_in();
     };
 } // namespace Tactics
@@ -1,11 +1,52 @@
 #include "Tactics/Components/Grid.hpp"
 #include "Tactics/Components/Tile.hpp"
 #include "Tactics/Core/Logger.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
 
 namespace Tactics
 {
+    namespace
+    {
+        constexpr int DEFAULT_MOVE_COST = 1;
+        constexpr int PADDING_MOVE_COST = -1;
+        constexpr int CHUNK_SHIFT = 5;
+        constexpr int CHUNK_MASK = Grid::CHUNK_SIZE - 1;
+        constexpr size_t DIRTY_WORD_BITS = 64;
+
+        static_assert(1 << CHUNK_SHIFT == Grid::CHUNK_SIZE, "CHUNK_SHIFT must match CHUNK_SIZE");
+
+        auto next_revision() -> std::uint64_t
+        {
+            static std::atomic<std::uint64_t> revision_counter{0U};
+            return ++revision_counter;
+        }
+
+        auto chunks_for(int tiles) -> int
+        {
+            return (tiles + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE;
+        }
+    } // namespace
+
     Grid::Grid() = default;
 
+    auto Grid::clone() const -> Grid
+    {
+        Grid copy;
+        copy.m_width = m_width;
+        copy.m_height = m_height;
+        copy.m_chunks_x = m_chunks_x;
+        copy.m_chunks_y = m_chunks_y;
+        copy.m_tile_types = m_tile_types;
+        copy.m_move_costs = m_move_costs;
+        copy.m_chunk_revisions = m_chunk_revisions;
+        copy.m_revision = m_revision;
+        copy.m_dirty_chunks = m_dirty_chunks;
+        return copy;
+    }
+
     auto Grid::get_width() const -> int
     {
         return m_width;
@@ -16,41 +57,167 @@ namespace Tactics
         return m_height;
     }
 
+    auto Grid::get_tile(const Vector2i &position) const -> std::optional<Tile>
+    {
+        if (!is_valid_position(position))
+        {
+            return std::nullopt;
+        }
+
+        const size_t index = index_of(position.x, position.y);
+        return Tile(position, static_cast<Tile::Type>(m_tile_types[index]), m_move_costs[index]);
+    }
+
     // NOLINTNEXTLINE(readability-make-member-function-const)
-    auto Grid::get_tile(const Vector2i &position) -> Tile *
+    void Grid::set_tile(const Vector2i &position, const Tile &tile)
     {
         if (!is_valid_position(position))
         {
-            log_warning("Attempted to get tile at invalid position: (" +
+            log_warning("Attempted to set tile at invalid position: (" +
                         std::to_string(position.x) + ", " + std::to_string(position.y) + ")");
-            return nullptr;
+            return;
+        }
+
+        const int move_cost = tile.get_move_cost();
+        if (move_cost < std::numeric_limits<std::int8_t>::min() ||
+            move_cost > std::numeric_limits<std::int8_t>::max())
+        {
+            log_warning("Attempted to set out of range move cost: " + std::to_string(move_cost));
+            return;
         }
 
-        return &m_tiles[index_of(position.x, position.y)];
+        const size_t index = index_of(position.x, position.y);
+        m_tile_types[index] = static_cast<std::uint8_t>(tile.get_type());
+        m_move_costs[index] = static_cast<std::int8_t>(move_cost);
+
+        const Vector2i chunk = chunk_of(position);
+        mark_chunk_changed(chunk.x, chunk.y);
     }
 
-    auto Grid::get_tile(const Vector2i &position) const -> const Tile *
+    auto Grid::get_tile_types() -> std::span<std::uint8_t>
     {
-        if (!is_valid_position(position))
+        return m_tile_types;
+    }
+
+    auto Grid::get_tile_types() const -> std::span<const std::uint8_t>
+    {
+        return m_tile_types;
+    }
+
+    auto Grid::get_move_costs() -> std::span<std::int8_t>
+    {
+        return m_move_costs;
+    }
+
+    auto Grid::get_move_costs() const -> std::span<const std::int8_t>
+    {
+        return m_move_costs;
+    }
+
+    auto Grid::get_chunks_x() const -> int
+    {
+        return m_chunks_x;
+    }
+
+    auto Grid::get_chunks_y() const -> int
+    {
+        return m_chunks_y;
+    }
+
+    auto Grid::get_chunk_count() const -> int
+    {
+        return m_chunks_x * m_chunks_y;
+    }
+
+    auto Grid::get_chunk(int chunk_x, int chunk_y) -> GridChunk
+    {
+        const size_t offset = chunk_offset(chunk_x, chunk_y);
+        return GridChunk{
+            .coord = Vector2i(chunk_x, chunk_y),
+            .bounds = chunk_bounds(chunk_x, chunk_y),
+            .tile_types = std::span<std::uint8_t>(m_tile_types).subspan(offset, CHUNK_TILE_COUNT),
+            .move_costs = std::span<std::int8_t>(m_move_costs).subspan(offset, CHUNK_TILE_COUNT)};
+    }
+
+    auto Grid::get_chunk(int chunk_x, int chunk_y) const -> ConstGridChunk
+    {
+        const size_t offset = chunk_offset(chunk_x, chunk_y);
+        return ConstGridChunk{
+            .coord = Vector2i(chunk_x, chunk_y),
+            .bounds = chunk_bounds(chunk_x, chunk_y),
+            .tile_types =
+                std::span<const std::uint8_t>(m_tile_types).subspan(offset, CHUNK_TILE_COUNT),
+            .move_costs =
+                std::span<const std::int8_t>(m_move_costs).subspan(offset, CHUNK_TILE_COUNT)};
+    }
+
+    auto Grid::chunk_of(const Vector2i &position) -> Vector2i
+    {
+        return Vector2i(position.x >> CHUNK_SHIFT, position.y >> CHUNK_SHIFT);
+    }
+
+    auto Grid::get_revision() const -> std::uint64_t
+    {
+        return m_revision;
+    }
+
+    auto Grid::get_chunk_revision(int chunk_x, int chunk_y) const -> std::uint64_t
+    {
+        return m_chunk_revisions[chunk_index(chunk_x, chunk_y)];
+    }
+
+    void Grid::mark_chunk_changed(int chunk_x, int chunk_y)
+    {
+        const size_t index = chunk_index(chunk_x, chunk_y);
+        m_revision = next_revision();
+        m_chunk_revisions[index] = m_revision;
+        m_dirty_chunks[index / DIRTY_WORD_BITS] |= std::uint64_t{1} << (index % DIRTY_WORD_BITS);
+    }
+
+    void Grid::mark_chunk_loaded(int chunk_x, int chunk_y)
+    {
+        const size_t index = chunk_index(chunk_x, chunk_y);
+        m_revision = next_revision();
+        m_chunk_revisions[index] = m_revision;
+    }
+
+    auto Grid::is_chunk_dirty(int chunk_x, int chunk_y) const -> bool
+    {
+        const size_t index = chunk_index(chunk_x, chunk_y);
+        return ((m_dirty_chunks[index / DIRTY_WORD_BITS] >> (index % DIRTY_WORD_BITS)) & 1U) != 0;
+    }
+
+    auto Grid::has_dirty_chunks() const -> bool
+    {
+        return std::ranges::any_of(m_dirty_chunks, [](std::uint64_t word) { return word != 0; });
+    }
+
+    auto Grid::get_dirty_chunk_count() const -> int
+    {
+        int count = 0;
+        for (const std::uint64_t word : m_dirty_chunks)
         {
-            return nullptr;
+            count += std::popcount(word);
         }
+        return count;
+    }
 
-        return &m_tiles[index_of(position.x, position.y)];
+    void Grid::clear_dirty_chunks()
+    {
+        std::ranges::fill(m_dirty_chunks, 0U);
     }
 
-    // NOLINTNEXTLINE(readability-make-member-function-const)
-    void Grid::set_tile(const Vector2i &position, const Tile &tile)
+    void Grid::merge_dirty_chunks(const Grid &other)
     {
-        if (!is_valid_position(position))
+        if (other.m_chunks_x != m_chunks_x || other.m_chunks_y != m_chunks_y)
         {
-            log_warning("Attempted to set tile at invalid position: (" +
-                        std::to_string(position.x) + ", " + std::to_string(position.y) + ")");
             return;
         }
 
-        m_tiles[index_of(position.x, position.y)] = tile;
-        m_tiles[index_of(position.x, position.y)].set_position(position);
+        for (size_t word = 0; word < m_dirty_chunks.size(); ++word)
+        {
+            m_dirty_chunks[word] |= other.m_dirty_chunks[word];
+        }
     }
 
     void Grid::resize(int width, int height)
@@ -64,19 +231,56 @@ namespace Tactics
 
         m_width = width;
         m_height = height;
-        m_tiles.clear();
-        m_tiles.resize(static_cast<size_t>(width) * static_cast<size_t>(height));
+        m_chunks_x = chunks_for(width);
+        m_chunks_y = chunks_for(height);
 
         // Initialize all tiles with default values
-        for (int y_pos = 0; y_pos < height; ++y_pos)
+        const size_t plane_size =
+            static_cast<size_t>(get_chunk_count()) * static_cast<size_t>(CHUNK_TILE_COUNT);
+        m_tile_types.assign(plane_size, static_cast<std::uint8_t>(Tile::Type::Grass));
+        m_move_costs.assign(plane_size, static_cast<std::int8_t>(DEFAULT_MOVE_COST));
+
+        // Padding in partial edge chunks is blocked so linear plane scans never treat it as land
+        for (int chunk_y = 0; chunk_y < m_chunks_y; ++chunk_y)
         {
-            for (int x_pos = 0; x_pos < width; ++x_pos)
+            for (int chunk_x = 0; chunk_x < m_chunks_x; ++chunk_x)
             {
-                const Vector2i position(x_pos, y_pos);
-                m_tiles[index_of(x_pos, y_pos)] = Tile(position, Tile::Type::Grass, 1);
+                const GridChunk chunk = get_chunk(chunk_x, chunk_y);
+                if (chunk.bounds.width == CHUNK_SIZE && chunk.bounds.height == CHUNK_SIZE)
+                {
+                    continue;
+                }
+
+                for (int local_y = 0; local_y < CHUNK_SIZE; ++local_y)
+                {
+                    for (int local_x = 0; local_x < CHUNK_SIZE; ++local_x)
+                    {
+                        if (local_x < chunk.bounds.width && local_y < chunk.bounds.height)
+                        {
+                            continue;
+                        }
+
+                        const auto local_index = static_cast<size_t>((local_y * CHUNK_SIZE) +
+                                                                     local_x);
+                        chunk.tile_types[local_index] = static_cast<std::uint8_t>(Tile::Type::Wall);
+                        chunk.move_costs[local_index] =
+                            static_cast<std::int8_t>(PADDING_MOVE_COST);
+                    }
+                }
             }
         }
 
+        m_revision = next_revision();
+        m_chunk_revisions.assign(static_cast<size_t>(get_chunk_count()), m_revision);
+
+        // Every chunk is new, so all of them are dirty (bits past the last chunk stay clear)
+        const auto chunk_count = static_cast<size_t>(get_chunk_count());
+        m_dirty_chunks.assign((chunk_count + DIRTY_WORD_BITS - 1) / DIRTY_WORD_BITS, ~0ULL);
+        if (chunk_count % DIRTY_WORD_BITS != 0)
+        {
+            m_dirty_chunks.back() = (std::uint64_t{1} << (chunk_count % DIRTY_WORD_BITS)) - 1;
+        }
+
         log_debug("Grid resized to: " + std::to_string(width) + "x" + std::to_string(height));
     }
 
@@ -87,7 +291,30 @@ namespace Tactics
 
     auto Grid::index_of(int x_pos, int y_pos) const -> size_t
     {
-        return (static_cast<size_t>(y_pos) * static_cast<size_t>(m_width)) +
-               static_cast<size_t>(x_pos);
+        const size_t chunk_index =
+            (static_cast<size_t>(y_pos >> CHUNK_SHIFT) * static_cast<size_t>(m_chunks_x)) +
+            static_cast<size_t>(x_pos >> CHUNK_SHIFT);
+        const auto local_index =
+            static_cast<size_t>(((y_pos & CHUNK_MASK) * CHUNK_SIZE) + (x_pos & CHUNK_MASK));
+        return (chunk_index * static_cast<size_t>(CHUNK_TILE_COUNT)) + local_index;
+    }
+
+    auto Grid::chunk_bounds(int chunk_x, int chunk_y) const -> Recti
+    {
+        const int left = chunk_x * CHUNK_SIZE;
+        const int top = chunk_y * CHUNK_SIZE;
+        return Recti(left, top, std::min(CHUNK_SIZE, m_width - left),
+                     std::min(CHUNK_SIZE, m_height - top));
+    }
+
+    auto Grid::chunk_offset(int chunk_x, int chunk_y) const -> size_t
+    {
+        return chunk_index(chunk_x, chunk_y) * static_cast<size_t>(CHUNK_TILE_COUNT);
+    }
+
+    auto Grid::chunk_index(int chunk_x, int chunk_y) const -> size_t
+    {
+        return (static_cast<size_t>(chunk_y) * static_cast<size_t>(m_chunks_x)) +
+               static_cast<size_t>(chunk_x);
     }
 } // namespace Tactics
@@ -0,0 +1,98 @@
+#include "Tactics/Components/OccupancyGrid.hpp"
+
+namespace Tactics
+{
+    void OccupancyGrid::reset(const Grid &grid, std::span<const Unit> units)
+    {
+        const size_t tile_count = grid.get_move_costs().size();
+        m_unit_at.assign(tile_count, NO_UNIT);
+        m_next_unit.assign(units.size(), NO_UNIT);
+        m_occupied_tiles.assign(tile_count, false);
+        ++m_revision;
+
+        // Pushed in reverse so the first unit in the list ends up on top of its stack
+        for (size_t unit_index = units.size(); unit_index-- > 0;)
+        {
+            const Vector2i position = units[unit_index].get_position();
+            if (!grid.is_valid_position(position))
+            {
+                continue;
+            }
+
+            const size_t index = grid.index_of(position.x, position.y);
+            m_next_unit[unit_index] = m_unit_at[index];
+            m_unit_at[index] = static_cast<std::uint32_t>(unit_index);
+            m_occupied_tiles[index] = true;
+        }
+    }
+
+    void OccupancyGrid::move_unit(const Grid &grid, std::size_t unit_index, const Vector2i &from,
+                                  const Vector2i &to)
+    {
+        if (m_unit_at.empty() || unit_index >= m_next_unit.size())
+        {
+            return;
+        }
+
+        const auto unit = static_cast<std::uint32_t>(unit_index);
+        if (grid.is_valid_position(from))
+        {
+            // Unlink the unit from its stack; whoever was below it is now on top
+            const size_t from_index = grid.index_of(from.x, from.y);
+            std::uint32_t *link = &m_unit_at[from_index];
+            while (*link != NO_UNIT && *link != unit)
+            {
+                link = &m_next_unit[*link];
+            }
+
+            if (*link == unit)
+            {
+                *link = m_next_unit[unit];
+                m_next_unit[unit] = NO_UNIT;
+            }
+            m_occupied_tiles[from_index] = m_unit_at[from_index] != NO_UNIT;
+        }
+
+        if (grid.is_valid_position(to))
+        {
+            const size_t to_index = grid.index_of(to.x, to.y);
+            m_next_unit[unit] = m_unit_at[to_index];
+            m_unit_at[to_index] = unit;
+            m_occupied_tiles[to_index] = true;
+        }
+
+        ++m_revision;
+    }
+
+    auto OccupancyGrid::get_unit_at(const Grid &grid, const Vector2i &position) const
+        -> std::optional<std::size_t>
+    {
+        if (m_unit_at.empty() || !grid.is_valid_position(position))
+        {
+            return std::nullopt;
+        }
+
+        const std::uint32_t unit_index = m_unit_at[grid.index_of(position.x, position.y)];
+        if (unit_index == NO_UNIT)
+        {
+            return std::nullopt;
+        }
+
+        return unit_index;
+    }
+
+    auto OccupancyGrid::is_occupied(const Grid &grid, const Vector2i &position) const -> bool
+    {
+        return get_unit_at(grid, position).has_value();
+    }
+
+    auto OccupancyGrid::get_occupied_tiles() const -> const std::vector<bool> &
+    {
+        return m_occupied_tiles;
+    }
+
+    auto OccupancyGrid::get_revision() const -> std::uint64_t
+    {
+        return m_revision;
+    }
+} // namespace Tactics
@@ -4,23 +4,26 @@
 #include "Tactics/Core/InputManager.hpp"
 #include "Tactics/Renderers/UnitRenderer.hpp"
 #include <algorithm>
-#include <array>
-#include <queue>
+#include <span>
 
 namespace Tactics
 {
     namespace
     {
-        auto index_of(const Vector2i &position, int width) -> size_t
-        {
-            return (static_cast<size_t>(position.y) * static_cast<size_t>(width)) +
-                   static_cast<size_t>(position.x);
-        }
-
         constexpr uint8_t REACHABLE_COLOR_R = 80;
         constexpr uint8_t REACHABLE_COLOR_G = 160;
         constexpr uint8_t REACHABLE_COLOR_B = 255;
         constexpr uint8_t REACHABLE_COLOR_A = 120;
+
+        // Tiles a search from the unit may read: every move costs at least one point (tiles
+        // filled in lazily are loaded that way), so it never enters a tile more than move_points
+        // away and only looks one tile past that
+        auto search_bounds(const Unit &unit) -> Recti
+        {
+            const int reach = std::max(unit.get_move_points(), 0) + 1;
+            const Vector2i position = unit.get_position();
+            return {position.x - reach, position.y - reach, (2 * reach) + 1, (2 * reach) + 1};
+        }
     } // namespace
 
     void UnitController::update(const Grid &grid, const Cursor &cursor)
@@ -34,11 +37,11 @@ namespace Tactics
         const Vector2i cursor_pos = cursor.get_position();
         if (!m_selected_unit.has_value())
         {
-            auto unit_index = find_unit_index_at(cursor_pos);
-            if (unit_index.has_value())
+            auto unit_index = find_unit_index_at(grid, cursor_pos);
+            if (unit_index.has_value() &&
+                compute_reachable_tiles(grid, m_units[unit_index.value()]))
             {
                 m_selected_unit = unit_index;
-                compute_reachable_tiles(grid, m_units[unit_index.value()]);
                 publish(Events::UnitSelected{std::optional<std::size_t>(unit_index)});
             }
 
@@ -60,15 +63,31 @@ namespace Tactics
             return;
         }
 
-        auto target_unit = find_unit_index_at(cursor_pos);
+        auto target_unit = find_unit_index_at(grid, cursor_pos);
         if (target_unit.has_value() && target_unit.value() != selected_index)
         {
             return;
         }
 
-        m_units[selected_index].set_position(cursor_pos);
-        publish(Events::UnitMoved{
-            .unit_index = selected_index, .from = GridPos{unit_pos}, .to = GridPos{cursor_pos}});
+        // The goal is reachable, so the cheapest path stays within the unit's search bounds
+        if (!prepare_search_region(search_bounds(m_units[selected_index])))
+        {
+            return;
+        }
+
+        // The unit's own tile is flagged too, but searches never re-enter their start
+        auto path = m_pathfinder.find_path(grid, unit_pos, cursor_pos,
+                                           m_occupancy.get_occupied_tiles());
+        if (!path.has_value())
+        {
+            return;
+        }
+
+        move_unit(grid, selected_index, cursor_pos);
+        publish(Events::UnitMoved{.unit_index = selected_index,
+                                  .from = GridPos{unit_pos},
+                                  .to = GridPos{cursor_pos},
+                                  .path = std::move(path->steps)});
         clear_reachable_tiles();
         m_selected_unit.reset();
     }
@@ -90,6 +109,7 @@ namespace Tactics
     {
         m_units = std::move(units);
         clamp_units_to_grid(grid);
+        m_occupancy.reset(grid, m_units);
         clear_selection();
     }
 
@@ -101,6 +121,7 @@ namespace Tactics
     void UnitController::on_grid_changed(const Grid &grid)
     {
         clamp_units_to_grid(grid);
+        m_occupancy.reset(grid, m_units);
         clear_selection();
     }
 
@@ -110,150 +131,87 @@ namespace Tactics
         m_selected_unit.reset();
     }
 
-    auto UnitController::find_unit_index_at(const Vector2i &position) const -> std::optional<size_t>
+    void UnitController::set_search_region_callback(SearchRegionCallback callback)
     {
-        const auto unit = std::ranges::find_if(m_units, [&position](const Unit &unit) -> bool
-                                               { return unit.get_position() == position; });
-
-        if (unit == m_units.end())
-        {
-            return std::nullopt;
-        }
-
-        return static_cast<size_t>(std::distance(m_units.begin(), unit));
+        m_on_search_region = std::move(callback);
     }
 
-    auto UnitController::is_tile_reachable(const Grid &grid, const Vector2i &position) const -> bool
+    auto UnitController::get_flow_field(const Grid &grid, std::span<const Vector2i> goals)
+        -> const FlowField &
     {
-        if (!grid.is_valid_position(position))
+        // The field spreads over the whole grid
+        if (!prepare_search_region(Recti(0, 0, grid.get_width(), grid.get_height())))
         {
-            return false;
+            m_flow_field.invalidate();
+            return m_flow_field;
         }
 
-        if (m_reachable_move_points.empty())
-        {
-            return false;
-        }
-
-        const size_t index = index_of(position, grid.get_width());
-        return m_reachable_move_points[index] >= 0;
+        // Every unit blocks passage; units can still read the step off their own tile
+        m_flow_field.update(grid, goals, m_occupancy.get_occupied_tiles(),
+                            m_occupancy.get_revision());
+        return m_flow_field;
     }
 
-    void UnitController::compute_reachable_tiles(const Grid &grid, const Unit &unit)
+    auto UnitController::compute_all_reachable_tiles(const Grid &grid)
+        -> std::span<const TileBitset>
     {
-        const int width = grid.get_width();
-        const int height = grid.get_height();
-        const int total_tiles = width * height;
-        if (width <= 0 || height <= 0 || total_tiles <= 0)
-        {
-            clear_reachable_tiles();
-            return;
-        }
-
-        m_reachable_move_points.assign(static_cast<size_t>(total_tiles), -1);
-
-        const Vector2i start = unit.get_position();
-        if (!grid.is_valid_position(start))
+        m_batch_queries.clear();
+        for (const auto &unit : m_units)
         {
-            return;
+            if (!prepare_search_region(search_bounds(unit)))
+            {
+                return {};
+            }
+            m_batch_queries.push_back(ReachabilityQuery{.start = unit.get_position(),
+                                                        .move_points = unit.get_move_points()});
         }
 
-        const size_t start_index = index_of(start, width);
-        m_reachable_move_points[start_index] = unit.get_move_points();
-        const std::vector<bool> occupied = build_occupied_tiles(grid, start);
-        expand_reachable_tiles(grid, unit, occupied);
+        // A unit's own tile is never re-entered, so one mask serves every search
+        m_batch_reachability.compute(grid, m_batch_queries, m_occupancy.get_occupied_tiles());
+        return m_batch_reachability.get_results();
     }
 
-    auto UnitController::build_occupied_tiles(const Grid &grid, const Vector2i &start) const
-        -> std::vector<bool>
+    auto UnitController::find_unit_index_at(const Grid &grid, const Vector2i &position) const
+        -> std::optional<size_t>
     {
-        const int width = grid.get_width();
-        const int height = grid.get_height();
-        const int total_tiles = width * height;
-
-        std::vector<bool> occupied(static_cast<size_t>(total_tiles), false);
-        for (const auto &other_unit : m_units)
-        {
-            const Vector2i position = other_unit.get_position();
-            if (position == start || !grid.is_valid_position(position))
-            {
-                continue;
-            }
+        return m_occupancy.get_unit_at(grid, position);
+    }
 
-            const size_t occupied_index = index_of(position, width);
-            occupied[occupied_index] = true;
-        }
+    void UnitController::move_unit(const Grid &grid, size_t unit_index, const Vector2i &position)
+    {
+        const Vector2i from = m_units[unit_index].get_position();
+        m_units[unit_index].set_position(position);
+        m_occupancy.move_unit(grid, unit_index, from, position);
+    }
 
-        return occupied;
+    auto UnitController::is_tile_reachable(const Grid &grid, const Vector2i &position) const -> bool
+    {
+        return m_reachability.is_reachable(grid, position);
     }
 
-    void UnitController::expand_reachable_tiles(const Grid &grid, const Unit &unit,
-                                                const std::vector<bool> &occupied)
+    auto UnitController::compute_reachable_tiles(const Grid &grid, const Unit &unit) -> bool
     {
-        const int width = grid.get_width();
-        const int height = grid.get_height();
-        if (width <= 0 || height <= 0)
+        if (grid.get_width() <= 0 || grid.get_height() <= 0 ||
+            !prepare_search_region(search_bounds(unit)))
         {
-            return;
+            clear_reachable_tiles();
+            return false;
         }
 
-        struct Node
-        {
-            Vector2i position;
-            int remaining;
-        };
-
-        std::queue<Node> frontier;
-        frontier.push(Node{.position = unit.get_position(), .remaining = unit.get_move_points()});
-
-        const std::array<Vector2i, 4> directions = {Vector2i{0, -1}, Vector2i{0, 1},
-                                                    Vector2i{-1, 0}, Vector2i{1, 0}};
-
-        while (!frontier.empty())
-        {
-            const Node current = frontier.front();
-            frontier.pop();
-
-            for (const auto &direction : directions)
-            {
-                const Vector2i neighbor = current.position + direction;
-                if (!grid.is_valid_position(neighbor))
-                {
-                    continue;
-                }
-
-                const size_t neighbor_index = index_of(neighbor, width);
-                if (occupied[neighbor_index])
-                {
-                    continue;
-                }
-
-                const Tile *tile = grid.get_tile(neighbor);
-                if (tile == nullptr || !tile->is_walkable())
-                {
-                    continue;
-                }
-
-                const int cost = tile->get_move_cost();
-                if (cost > current.remaining)
-                {
-                    continue;
-                }
+        m_reachability.compute(grid, unit.get_position(), unit.get_move_points(),
+                               m_occupancy.get_occupied_tiles());
+        return true;
+    }
 
-                const int remaining = current.remaining - cost;
-                if (remaining > m_reachable_move_points[neighbor_index])
-                {
-                    m_reachable_move_points[neighbor_index] = remaining;
-                    frontier.push(Node{.position = neighbor, .remaining = remaining});
-                }
-            }
-        }
+    auto UnitController::prepare_search_region(const Recti &tiles) -> bool
+    {
+        return !m_on_search_region || m_on_search_region(tiles);
     }
 
     void UnitController::render_reachable_tiles(SDL_Renderer *renderer, const Camera &camera,
                                                 float tile_size, const Grid &grid) const
     {
-        if (renderer == nullptr || m_reachable_move_points.empty())
+        if (renderer == nullptr || !m_reachability.has_result())
         {
             return;
         }
@@ -265,6 +223,8 @@ namespace Tactics
             return;
         }
 
+        const std::span<const int> remaining_move_points =
+            m_reachability.get_remaining_move_points();
         const float screen_tile_size = tile_size * camera.get_zoom();
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
 
@@ -272,9 +232,8 @@ namespace Tactics
         {
             for (int col = 0; col < width; ++col)
             {
-                const Vector2i position{col, row};
-                const size_t index = index_of(position, width);
-                if (m_reachable_move_points[index] < 0)
+                const size_t index = grid.index_of(col, row);
+                if (remaining_move_points[index] < 0)
                 {
                     continue;
                 }
@@ -305,7 +264,7 @@ namespace Tactics
 
     void UnitController::clear_reachable_tiles()
     {
-        m_reachable_move_points.clear();
+        m_reachability.clear();
     }
 
     void UnitController::clamp_units_to_grid(const Grid &grid)
@@ -0,0 +1,74 @@
+#include "Tactics/Core/AsyncMapGenerator.hpp"
+#include "Tactics/Core/MapGenerator.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace Tactics
+{
+    AsyncMapGenerator::AsyncMapGenerator(MapCache *cache) : m_cache(cache) {}
+
+    auto AsyncMapGenerator::start(const GeneratorConfig &config) -> bool
+    {
+        if (m_running.exchange(true))
+        {
+            return false;
+        }
+
+        // The previous worker has published its result and is about to exit
+        if (m_worker.joinable())
+        {
+            m_worker.join();
+        }
+
+        m_progress.store(0.0F);
+        m_worker = std::jthread(
+            [this, config]
+            {
+                const auto on_progress = [this](float progress) { m_progress.store(progress); };
+                if (m_pool == nullptr || m_pool_thread_count != config.thread_count)
+                {
+                    // Join the old workers before starting the new ones
+                    m_pool.reset();
+                    m_pool = std::make_unique<ThreadPool>(
+                        static_cast<std::size_t>(std::max(config.thread_count, 0)));
+                    m_pool_thread_count = config.thread_count;
+                }
+
+                Grid grid;
+                if (m_cache != nullptr)
+                {
+                    grid = m_cache->get_or_generate(config, on_progress, m_pool.get());
+                }
+                else
+                {
+                    MapGenerator generator(config, m_pool.get());
+                    generator.set_progress_callback(on_progress);
+                    grid = generator.generate();
+                }
+
+                // Once a caller sees the result the job is finished and a new one may start
+                m_progress.store(1.0F);
+                const std::lock_guard lock(m_result_mutex);
+                m_result = GeneratedMap{.config = config, .grid = std::move(grid)};
+                m_running.store(false);
+            });
+
+        return true;
+    }
+
+    auto AsyncMapGenerator::is_running() const -> bool
+    {
+        return m_running.load();
+    }
+
+    auto AsyncMapGenerator::get_progress() const -> float
+    {
+        return m_progress.load();
+    }
+
+    auto AsyncMapGenerator::take_result() -> std::optional<GeneratedMap>
+    {
+        const std::lock_guard lock(m_result_mutex);
+        return std::exchange(m_result, std::nullopt);
+    }
+} // namespace Tactics
@@ -0,0 +1,107 @@
+#include "Tactics/Core/CellularAutomaton.hpp"
+#include <initializer_list>
+#include <utility>
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr std::uint16_t ALL_COUNTS = (1U << (CellularAutomaton::MAX_NEIGHBORS + 1)) - 1U;
+    } // namespace
+
+    CellularAutomaton::CellularAutomaton(std::vector<Rule> rules) : m_rules(std::move(rules))
+    {
+    }
+
+    auto CellularAutomaton::at_least(int minimum) -> std::uint16_t
+    {
+        if (minimum <= 0)
+        {
+            return ALL_COUNTS;
+        }
+        if (minimum > MAX_NEIGHBORS)
+        {
+            return 0;
+        }
+        return static_cast<std::uint16_t>(ALL_COUNTS & ~((1U << minimum) - 1U));
+    }
+
+    auto CellularAutomaton::majority_rules() -> std::vector<Rule>
+    {
+        const std::uint16_t majority = at_least(MAJORITY_THRESHOLD);
+
+        std::vector<Rule> rules;
+        for (const auto type : {Tile::Type::Water, Tile::Type::Mountain, Tile::Type::Forest,
+                                Tile::Type::Grass, Tile::Type::Desert})
+        {
+            rules.push_back({.counted = type, .neighbor_counts = majority, .result = type});
+        }
+        return rules;
+    }
+
+    void CellularAutomaton::step_rows(std::span<const Tile::Type> source,
+                                      std::span<Tile::Type> target, int width, int height,
+                                      int row_begin, int row_end) const
+    {
+        for (int y_pos = row_begin; y_pos < row_end; ++y_pos)
+        {
+            const std::size_t row_start = static_cast<std::size_t>(y_pos) *
+                                          static_cast<std::size_t>(width);
+
+            // Window covers columns x - 1 .. x + 1; column -1 is outside the map
+            Histogram window{};
+            shift_column(window, source, width, height, 0, y_pos, 1);
+
+            for (int x_pos = 0; x_pos < width; ++x_pos)
+            {
+                if (x_pos + 1 < width)
+                {
+                    shift_column(window, source, width, height, x_pos + 1, y_pos, 1);
+                }
+
+                const std::size_t idx = row_start + static_cast<std::size_t>(x_pos);
+                const Tile::Type current = source[idx];
+                Tile::Type next = current;
+                for (const Rule &rule : m_rules)
+                {
+                    // The window includes the cell itself
+                    const int neighbors = window[static_cast<std::size_t>(rule.counted)] -
+                                          (current == rule.counted ? 1 : 0);
+                    if ((rule.neighbor_counts >> neighbors) & 1U)
+                    {
+                        next = rule.result;
+                        break;
+                    }
+                }
+                target[idx] = next;
+
+                if (x_pos >= 1)
+                {
+                    shift_column(window, source, width, height, x_pos - 1, y_pos, -1);
+                }
+            }
+        }
+    }
+
+    auto CellularAutomaton::get_rules() const -> const std::vector<Rule> &
+    {
+        return m_rules;
+    }
+
+    void CellularAutomaton::shift_column(Histogram &window, std::span<const Tile::Type> source,
+                                         int width, int height, int x_pos, int y_pos, int delta)
+    {
+        for (int row = y_pos - 1; row <= y_pos + 1; ++row)
+        {
+            if (row < 0 || row >= height)
+            {
+                continue;
+            }
+            const std::size_t idx = (static_cast<std::size_t>(row) *
+                                     static_cast<std::size_t>(width)) +
+                                    static_cast<std::size_t>(x_pos);
+            auto &count = window[static_cast<std::size_t>(source[idx])];
+            count = static_cast<std::uint8_t>(count + delta);
+        }
+    }
+} // namespace Tactics
@@ -0,0 +1,168 @@
+#include "Tactics/Core/ChunkStreamer.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+namespace Tactics
+{
+    ChunkStreamer::ChunkStreamer(const GeneratorConfig &config, std::size_t capacity)
+        : m_config(config), m_generator(config), m_capacity(std::max<std::size_t>(capacity, 1))
+    {
+    }
+
+    auto ChunkStreamer::get_chunk(int chunk_x, int chunk_y) -> const StreamedChunk *
+    {
+        if (chunk_x < 0 || chunk_x >= get_chunks_x() || chunk_y < 0 || chunk_y >= get_chunks_y())
+        {
+            return nullptr;
+        }
+
+        const std::uint64_t key = key_of(chunk_x, chunk_y);
+        if (auto found = m_index.find(key); found != m_index.end())
+        {
+            m_chunks.splice(m_chunks.begin(), m_chunks, found->second);
+            return &m_chunks.front();
+        }
+
+        // Reuse the least recently used chunk's storage once the cache is full
+        if (m_chunks.size() >= m_capacity)
+        {
+            m_index.erase(key_of(m_chunks.back().coord.x, m_chunks.back().coord.y));
+            m_chunks.splice(m_chunks.begin(), m_chunks, std::prev(m_chunks.end()));
+        }
+        else
+        {
+            m_chunks.emplace_front();
+        }
+
+        StreamedChunk &chunk = m_chunks.front();
+        chunk.coord = Vector2i(chunk_x, chunk_y);
+        generate_chunk(chunk);
+        m_index[key] = m_chunks.begin();
+        ++m_generated_count;
+        return &chunk;
+    }
+
+    auto ChunkStreamer::find_chunk(int chunk_x, int chunk_y) const -> const StreamedChunk *
+    {
+        const auto found = m_index.find(key_of(chunk_x, chunk_y));
+        return found != m_index.end() ? &*found->second : nullptr;
+    }
+
+    auto ChunkStreamer::get_tile_type(Vector2i position) const -> std::optional<Tile::Type>
+    {
+        if (position.x < 0 || position.x >= m_config.width || position.y < 0 ||
+            position.y >= m_config.height)
+        {
+            return std::nullopt;
+        }
+
+        const StreamedChunk *chunk =
+            find_chunk(position.x / Grid::CHUNK_SIZE, position.y / Grid::CHUNK_SIZE);
+        if (chunk == nullptr)
+        {
+            return std::nullopt;
+        }
+
+        const int local_x = position.x % Grid::CHUNK_SIZE;
+        const int local_y = position.y % Grid::CHUNK_SIZE;
+        return static_cast<Tile::Type>(
+            chunk->tile_types[static_cast<std::size_t>((local_y * Grid::CHUNK_SIZE) + local_x)]);
+    }
+
+    auto ChunkStreamer::update(const Camera &camera, float tile_size, int margin_chunks)
+        -> std::size_t
+    {
+        const Recti range = get_chunk_range(camera, tile_size, margin_chunks);
+        const std::size_t generated_before = m_generated_count;
+
+        for (int chunk_y = range.y; chunk_y < range.bottom(); ++chunk_y)
+        {
+            for (int chunk_x = range.x; chunk_x < range.right(); ++chunk_x)
+            {
+                static_cast<void>(get_chunk(chunk_x, chunk_y));
+            }
+        }
+
+        return m_generated_count - generated_before;
+    }
+
+    auto ChunkStreamer::get_chunk_range(const Camera &camera, float tile_size,
+                                        int margin_chunks) const -> Recti
+    {
+        // Tiles are centred on their world position, so pad the view by one tile
+        const Rectf view_rect = camera.get_view_rect();
+        const auto chunk_world_size = tile_size * static_cast<float>(Grid::CHUNK_SIZE);
+        const auto to_chunk = [&](float world) -> int
+        { return static_cast<int>(std::floor(world / chunk_world_size)); };
+
+        const int start_x = std::max(to_chunk(view_rect.left() - tile_size) - margin_chunks, 0);
+        const int start_y = std::max(to_chunk(view_rect.top() - tile_size) - margin_chunks, 0);
+        const int end_x =
+            std::min(to_chunk(view_rect.right() + tile_size) + margin_chunks + 1, get_chunks_x());
+        const int end_y =
+            std::min(to_chunk(view_rect.bottom() + tile_size) + margin_chunks + 1, get_chunks_y());
+
+        return {start_x, start_y, std::max(end_x - start_x, 0), std::max(end_y - start_y, 0)};
+    }
+
+    auto ChunkStreamer::get_chunks_x() const -> int
+    {
+        return (std::max(m_config.width, 0) + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE;
+    }
+
+    auto ChunkStreamer::get_chunks_y() const -> int
+    {
+        return (std::max(m_config.height, 0) + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE;
+    }
+
+    auto ChunkStreamer::get_cached_chunk_count() const -> std::size_t
+    {
+        return m_chunks.size();
+    }
+
+    auto ChunkStreamer::get_capacity() const -> std::size_t
+    {
+        return m_capacity;
+    }
+
+    auto ChunkStreamer::get_generated_count() const -> std::size_t
+    {
+        return m_generated_count;
+    }
+
+    auto ChunkStreamer::key_of(int chunk_x, int chunk_y) -> std::uint64_t
+    {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(chunk_y)) << 32U) |
+               static_cast<std::uint32_t>(chunk_x);
+    }
+
+    void ChunkStreamer::generate_chunk(StreamedChunk &chunk) const
+    {
+        const int origin_x = chunk.coord.x * Grid::CHUNK_SIZE;
+        const int origin_y = chunk.coord.y * Grid::CHUNK_SIZE;
+        chunk.bounds = Recti(origin_x, origin_y,
+                             std::min(Grid::CHUNK_SIZE, m_config.width - origin_x),
+                             std::min(Grid::CHUNK_SIZE, m_config.height - origin_y));
+
+        chunk.tile_types.fill(static_cast<std::uint8_t>(Tile::Type::Wall));
+        chunk.move_costs.fill(
+            static_cast<std::int8_t>(MapGenerator::move_cost_for(Tile::Type::Wall)));
+
+        const auto tiles = m_generator.generate_region(chunk.bounds);
+        for (int local_y = 0; local_y < chunk.bounds.height; ++local_y)
+        {
+            for (int local_x = 0; local_x < chunk.bounds.width; ++local_x)
+            {
+                const Tile::Type tile_type =
+                    tiles[static_cast<std::size_t>((local_y * chunk.bounds.width) + local_x)];
+                const auto local_index = static_cast<std::size_t>((local_y * Grid::CHUNK_SIZE) +
+                                                                  local_x);
+                chunk.tile_types[local_index] = static_cast<std::uint8_t>(tile_type);
+                chunk.move_costs[local_index] =
+                    static_cast<std::int8_t>(MapGenerator::move_cost_for(tile_type));
+            }
+        }
+    }
+} // namespace Tactics
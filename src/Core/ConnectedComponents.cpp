@@ -0,0 +1,146 @@
+#include "Tactics/Core/ConnectedComponents.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace Tactics
+{
+    auto ConnectedComponents::label(const Grid &grid) -> std::size_t
+    {
+        m_width = grid.get_width();
+        m_height = grid.get_height();
+        const auto width = static_cast<std::size_t>(std::max(m_width, 0));
+        const auto height = static_cast<std::size_t>(std::max(m_height, 0));
+        const auto move_costs = grid.get_move_costs();
+
+        m_labels.assign(width * height, NO_COMPONENT);
+        m_parents.clear();
+        m_sizes.clear();
+
+        // Pass 1: provisional labels from the left and upper neighbours
+        for (int y_pos = 0; y_pos < m_height; ++y_pos)
+        {
+            const std::size_t row = static_cast<std::size_t>(y_pos) * width;
+            for (int x_pos = 0; x_pos < m_width; ++x_pos)
+            {
+                if (move_costs[grid.index_of(x_pos, y_pos)] < 0)
+                {
+                    continue;
+                }
+
+                const std::size_t idx = row + static_cast<std::size_t>(x_pos);
+                const std::uint32_t left = x_pos > 0 ? m_labels[idx - 1] : NO_COMPONENT;
+                const std::uint32_t up = y_pos > 0 ? m_labels[idx - width] : NO_COMPONENT;
+
+                if (left == NO_COMPONENT && up == NO_COMPONENT)
+                {
+                    const auto fresh = static_cast<std::uint32_t>(m_parents.size());
+                    m_parents.push_back(fresh);
+                    m_labels[idx] = fresh;
+                }
+                else if (left == NO_COMPONENT)
+                {
+                    m_labels[idx] = up;
+                }
+                else
+                {
+                    m_labels[idx] = left;
+                    if (up != NO_COMPONENT && up != left)
+                    {
+                        unite(left, up);
+                    }
+                }
+            }
+        }
+
+        // Pass 2: resolve roots to dense component indices in scan order
+        m_dense.assign(m_parents.size(), NO_COMPONENT);
+        for (auto &label : m_labels)
+        {
+            if (label == NO_COMPONENT)
+            {
+                continue;
+            }
+
+            const std::uint32_t root = find_root(label);
+            if (m_dense[root] == NO_COMPONENT)
+            {
+                m_dense[root] = static_cast<std::uint32_t>(m_sizes.size());
+                m_sizes.push_back(0);
+            }
+            label = m_dense[root];
+            ++m_sizes[label];
+        }
+
+        return m_sizes.size();
+    }
+
+    auto ConnectedComponents::get_component_at(Vector2i position) const
+        -> std::optional<std::size_t>
+    {
+        if (position.x < 0 || position.x >= m_width || position.y < 0 || position.y >= m_height)
+        {
+            return std::nullopt;
+        }
+
+        const std::uint32_t label =
+            m_labels[(static_cast<std::size_t>(position.y) * static_cast<std::size_t>(m_width)) +
+                     static_cast<std::size_t>(position.x)];
+        if (label == NO_COMPONENT)
+        {
+            return std::nullopt;
+        }
+        return label;
+    }
+
+    auto ConnectedComponents::get_component_count() const -> std::size_t
+    {
+        return m_sizes.size();
+    }
+
+    auto ConnectedComponents::get_component_sizes() const -> std::span<const std::size_t>
+    {
+        return m_sizes;
+    }
+
+    auto ConnectedComponents::get_largest_component() const -> std::optional<std::size_t>
+    {
+        if (m_sizes.empty())
+        {
+            return std::nullopt;
+        }
+        return static_cast<std::size_t>(std::ranges::max_element(m_sizes) - m_sizes.begin());
+    }
+
+    auto ConnectedComponents::get_labels() const -> std::span<const std::uint32_t>
+    {
+        return m_labels;
+    }
+
+    auto ConnectedComponents::find_root(std::uint32_t label) -> std::uint32_t
+    {
+        // Path halving keeps the trees shallow without recursion
+        while (m_parents[label] != label)
+        {
+            m_parents[label] = m_parents[m_parents[label]];
+            label = m_parents[label];
+        }
+        return label;
+    }
+
+    void ConnectedComponents::unite(std::uint32_t first, std::uint32_t second)
+    {
+        std::uint32_t first_root = find_root(first);
+        std::uint32_t second_root = find_root(second);
+        if (first_root == second_root)
+        {
+            return;
+        }
+
+        // The older label becomes the root
+        if (second_root < first_root)
+        {
+            std::swap(first_root, second_root);
+        }
+        m_parents[second_root] = first_root;
+    }
+} // namespace Tactics
@@ -0,0 +1,836 @@
+#include "Tactics/Core/FileGridRepository.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Core/Logger.hpp"
+#include "Tactics/Core/MappedFile.hpp"
+#include "Tactics/Core/TilePlaneCodec.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr std::array<char, 4> MAP_MAGIC = {'T', 'G', 'R', 'D'};
+        constexpr std::array<char, 4> CONFIG_MAGIC = {'T', 'G', 'E', 'N'};
+        constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ULL;
+        constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+        // Header flags: a chunk index follows the tile data; chunks are stored as encoded blobs
+        // through a chunk table instead of as raw planes
+        constexpr std::uint32_t FLAG_CHUNK_INDEX = 1U;
+        constexpr std::uint32_t FLAG_ENCODED_CHUNKS = 2U;
+
+        // Files written before the encoded layout existed (raw planes only)
+        constexpr std::uint32_t PLANES_FORMAT_VERSION = 1;
+
+        // Every field is naturally aligned, so the header has no padding and is written and
+        // read as one block
+        struct FileHeader
+        {
+            std::array<char, 4> magic;
+            std::uint32_t format_version;
+            std::int32_t width;
+            std::int32_t height;
+            std::uint32_t chunk_size;
+            std::uint32_t flags;
+            std::uint64_t plane_size;
+            std::uint64_t types_offset;
+            std::uint64_t costs_offset;
+            std::uint64_t chunk_index_offset;
+            std::uint32_t chunk_count;
+            std::uint32_t reserved;
+            std::int64_t created_at;
+            std::int64_t updated_at;
+            std::uint64_t chunk_table_offset;
+        };
+        static_assert(std::has_unique_object_representations_v<FileHeader>);
+        static_assert(sizeof(FileHeader) <= FileGridRepository::PAGE_SIZE);
+
+        // Location of one encoded chunk blob, in row-major chunk order
+        struct ChunkTableEntry
+        {
+            std::uint64_t offset;
+            std::uint32_t size;
+            std::uint32_t reserved;
+        };
+        static_assert(std::has_unique_object_representations_v<ChunkTableEntry>);
+
+        auto is_supported_version(std::uint32_t format_version) -> bool
+        {
+            return format_version == PLANES_FORMAT_VERSION ||
+                   format_version == FileGridRepository::FORMAT_VERSION;
+        }
+
+        auto has_encoded_chunks(const FileHeader &header) -> bool
+        {
+            return header.format_version != PLANES_FORMAT_VERSION &&
+                   (header.flags & FLAG_ENCODED_CHUNKS) != 0;
+        }
+
+        auto align_to_page(std::uint64_t offset) -> std::uint64_t
+        {
+            const std::uint64_t page = FileGridRepository::PAGE_SIZE;
+            return (offset + page - 1) / page * page;
+        }
+
+        template <typename T> void write_value(std::ofstream &stream, const T &value)
+        {
+            stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        template <typename T> auto read_value(std::ifstream &stream, T &value) -> bool
+        {
+            return static_cast<bool>(stream.read(reinterpret_cast<char *>(&value), sizeof(T)));
+        }
+
+        template <typename T> void write_plane(std::ofstream &stream, std::span<const T> plane)
+        {
+            stream.write(reinterpret_cast<const char *>(plane.data()),
+                         static_cast<std::streamsize>(plane.size_bytes()));
+        }
+
+        // Zero-fill up to the next section offset
+        void pad_to(std::ofstream &stream, std::uint64_t offset)
+        {
+            static constexpr std::array<char, FileGridRepository::PAGE_SIZE> ZEROS{};
+            const auto position = static_cast<std::uint64_t>(stream.tellp());
+            if (position < offset)
+            {
+                stream.write(ZEROS.data(), static_cast<std::streamsize>(offset - position));
+            }
+        }
+
+        void hash_span(std::uint64_t &hash, std::span<const std::byte> bytes)
+        {
+            for (const std::byte byte : bytes)
+            {
+                hash ^= std::to_integer<std::uint64_t>(byte);
+                hash *= FNV_PRIME;
+            }
+        }
+
+        auto current_time() -> std::int64_t
+        {
+            return static_cast<std::int64_t>(std::time(nullptr));
+        }
+
+        // Same text form as SQLite's datetime('now'), so both repositories list alike
+        auto format_time(std::int64_t seconds) -> std::string
+        {
+            // std::gmtime returns a shared buffer; listings may run on several threads
+            const auto time = static_cast<std::time_t>(seconds);
+            std::tm utc{};
+#if defined(_WIN32)
+            gmtime_s(&utc, &time);
+#else
+            gmtime_r(&time, &utc);
+#endif
+            std::stringstream stream;
+            stream << std::put_time(&utc, "%Y-%m-%d %H:%M:%S");
+            return stream.str();
+        }
+
+        auto read_header(std::ifstream &stream, FileHeader &header) -> bool
+        {
+            return read_value(stream, header) && header.magic == MAP_MAGIC &&
+                   is_supported_version(header.format_version);
+        }
+
+        // Check that the header describes a grid Grid can hold and that every section it
+        // points at lies inside the file
+        auto is_valid_layout(const FileHeader &header, std::uint64_t file_size) -> bool
+        {
+            if (header.width < 0 || header.height < 0 ||
+                header.chunk_size != static_cast<std::uint32_t>(Grid::CHUNK_SIZE))
+            {
+                return false;
+            }
+
+            const auto chunks_x = static_cast<std::uint64_t>(
+                (header.width + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE);
+            const auto chunks_y = static_cast<std::uint64_t>(
+                (header.height + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE);
+            const std::uint64_t chunk_count = chunks_x * chunks_y;
+            if (header.chunk_count != chunk_count ||
+                header.plane_size != chunk_count * Grid::CHUNK_TILE_COUNT)
+            {
+                return false;
+            }
+
+            const auto section_fits = [file_size](std::uint64_t offset, std::uint64_t size)
+            {
+                return offset % FileGridRepository::PAGE_SIZE == 0 && offset <= file_size &&
+                       size <= file_size - offset;
+            };
+
+            if (has_encoded_chunks(header))
+            {
+                // Blob bounds are checked as each chunk is read
+                if (!section_fits(header.chunk_table_offset,
+                                  chunk_count * sizeof(ChunkTableEntry)))
+                {
+                    return false;
+                }
+            }
+            else if (!section_fits(header.types_offset, header.plane_size) ||
+                     !section_fits(header.costs_offset, header.plane_size))
+            {
+                return false;
+            }
+
+            return (header.flags & FLAG_CHUNK_INDEX) == 0 ||
+                   section_fits(header.chunk_index_offset, chunk_count * sizeof(std::uint64_t));
+        }
+
+        // Map a file and validate its header (nullopt, logged, if it is not a usable map file)
+        auto open_map_file(const std::filesystem::path &path)
+            -> std::optional<std::pair<MappedFile, FileHeader>>
+        {
+            auto file = MappedFile::open(path);
+            if (!file.has_value())
+            {
+                return std::nullopt;
+            }
+
+            FileHeader header{};
+            const auto bytes = file->get_bytes();
+            if (bytes.size() < sizeof(FileHeader))
+            {
+                log_warning("Truncated map file: " + path.string());
+                return std::nullopt;
+            }
+            std::memcpy(&header, bytes.data(), sizeof(FileHeader));
+
+            if (header.magic != MAP_MAGIC || !is_supported_version(header.format_version))
+            {
+                log_warning("Unsupported map file format: " + path.string());
+                return std::nullopt;
+            }
+
+            if (!is_valid_layout(header, bytes.size()))
+            {
+                log_warning("Corrupt map file layout: " + path.string());
+                return std::nullopt;
+            }
+
+            return std::make_pair(std::move(*file), header);
+        }
+    } // namespace
+
+    FileGridRepository::FileGridRepository(std::filesystem::path directory, bool write_chunk_index,
+                                           TileLayout layout)
+        : m_directory(std::move(directory)), m_write_chunk_index(write_chunk_index),
+          m_layout(layout)
+    {
+    }
+
+    FileGridRepository::FileGridRepository(FileGridRepository &&other) noexcept
+        : m_directory(std::move(other.m_directory)),
+          m_write_chunk_index(other.m_write_chunk_index), m_layout(other.m_layout),
+          m_mapped(std::move(other.m_mapped))
+    {
+    }
+
+    auto FileGridRepository::operator=(FileGridRepository &&other) noexcept
+        -> FileGridRepository &
+    {
+        if (this != &other)
+        {
+            m_directory = std::move(other.m_directory);
+            m_write_chunk_index = other.m_write_chunk_index;
+            m_layout = other.m_layout;
+            m_mapped = std::move(other.m_mapped);
+        }
+        return *this;
+    }
+
+    auto FileGridRepository::load_map(const std::string &map_name) -> std::optional<Grid>
+    {
+        if (!is_valid_name(map_name))
+        {
+            log_error("Invalid map name: " + map_name);
+            return std::nullopt;
+        }
+
+        // Map afresh, in case the file was replaced since the last chunk read
+        release_mapped(map_name);
+        const MappedMap *mapped = open_mapped(map_name);
+        if (mapped == nullptr)
+        {
+            log_error("Map not found: " + map_name);
+            return std::nullopt;
+        }
+
+        const std::filesystem::path path = path_for(map_name);
+        const auto bytes = mapped->file.get_bytes();
+
+        Grid grid;
+        grid.resize(mapped->width, mapped->height);
+        auto tile_types = grid.get_tile_types();
+        auto move_costs = grid.get_move_costs();
+
+        if (mapped->encoded_chunks)
+        {
+            for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+            {
+                for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+                {
+                    if (!read_chunk(*mapped, grid.get_chunk(chunk_x, chunk_y)))
+                    {
+                        log_error("Corrupt chunk data in map file: " + path.string());
+                        return std::nullopt;
+                    }
+                }
+            }
+        }
+        else
+        {
+            // Raw planes are stored in Grid's own chunk-major layout, padding included
+            std::memcpy(tile_types.data(), bytes.subspan(mapped->types_offset).data(),
+                        tile_types.size());
+            std::memcpy(move_costs.data(), bytes.subspan(mapped->costs_offset).data(),
+                        move_costs.size());
+        }
+
+        if (!tile_types.empty() &&
+            std::ranges::max(tile_types) > static_cast<std::uint8_t>(Tile::Type::Wall))
+        {
+            log_error("Corrupt tile data in map file: " + path.string());
+            return std::nullopt;
+        }
+
+        for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+        {
+            for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+            {
+                grid.mark_chunk_changed(chunk_x, chunk_y);
+            }
+        }
+
+        // Freshly loaded, the grid matches what is stored
+        grid.clear_dirty_chunks();
+
+        log_info("Loaded map '" + map_name + "' (" + std::to_string(mapped->width) + "x" +
+                 std::to_string(mapped->height) + ")");
+        return grid;
+    }
+
+    auto FileGridRepository::save_map(const std::string &map_name, const Grid &grid) -> bool
+    {
+        if (!is_valid_name(map_name))
+        {
+            log_error("Invalid map name: " + map_name);
+            return false;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(m_directory, error);
+        if (error)
+        {
+            log_error("Failed to create map directory: " + error.message());
+            return false;
+        }
+
+        const std::filesystem::path path = path_for(map_name);
+        const std::int64_t now = current_time();
+        const auto existing = read_map_info(path);
+
+        const auto tile_types = grid.get_tile_types();
+        const auto move_costs = grid.get_move_costs();
+        const auto chunk_count = static_cast<std::uint32_t>(grid.get_chunk_count());
+        const auto plane_size = static_cast<std::uint64_t>(tile_types.size());
+
+        const bool encoded = m_layout == TileLayout::EncodedChunks;
+        FileHeader header{.magic = MAP_MAGIC,
+                          .format_version = FORMAT_VERSION,
+                          .width = grid.get_width(),
+                          .height = grid.get_height(),
+                          .chunk_size = static_cast<std::uint32_t>(Grid::CHUNK_SIZE),
+                          .flags = (m_write_chunk_index ? FLAG_CHUNK_INDEX : 0U) |
+                                   (encoded ? FLAG_ENCODED_CHUNKS : 0U),
+                          .plane_size = plane_size,
+                          .types_offset = 0,
+                          .costs_offset = 0,
+                          .chunk_index_offset = 0,
+                          .chunk_count = chunk_count,
+                          .reserved = 0,
+                          .created_at = existing.has_value() ? existing->created_at : now,
+                          .updated_at = now,
+                          .chunk_table_offset = 0};
+
+        // Encoded chunks are packed back to back after the chunk table
+        std::vector<ChunkTableEntry> chunk_table;
+        std::vector<std::uint8_t> chunk_data;
+        std::uint64_t data_offset = 0;
+        std::uint64_t data_end = 0;
+        if (encoded)
+        {
+            chunk_table.reserve(chunk_count);
+            for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+            {
+                for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+                {
+                    const std::size_t blob_start = chunk_data.size();
+                    encode_chunk_blob(grid.get_chunk(chunk_x, chunk_y), chunk_data);
+                    chunk_table.push_back(ChunkTableEntry{
+                        .offset = blob_start,
+                        .size = static_cast<std::uint32_t>(chunk_data.size() - blob_start),
+                        .reserved = 0});
+                }
+            }
+
+            header.chunk_table_offset = PAGE_SIZE;
+            data_offset = align_to_page(PAGE_SIZE + (chunk_table.size() * sizeof(ChunkTableEntry)));
+            for (ChunkTableEntry &entry : chunk_table)
+            {
+                entry.offset += data_offset;
+            }
+            data_end = data_offset + chunk_data.size();
+        }
+        else
+        {
+            header.types_offset = PAGE_SIZE;
+            header.costs_offset = align_to_page(PAGE_SIZE + plane_size);
+            data_end = header.costs_offset + plane_size;
+        }
+
+        if (m_write_chunk_index)
+        {
+            header.chunk_index_offset = align_to_page(data_end);
+        }
+
+        // Write beside the map and rename, so readers never map a partial file
+        std::filesystem::path temp_path = path;
+        temp_path += ".tmp";
+        {
+            std::ofstream stream(temp_path, std::ios::binary | std::ios::trunc);
+            if (!stream)
+            {
+                log_error("Failed to open map file: " + temp_path.string());
+                return false;
+            }
+
+            write_value(stream, header);
+            if (encoded)
+            {
+                pad_to(stream, header.chunk_table_offset);
+                write_plane(stream, std::span<const ChunkTableEntry>(chunk_table));
+                pad_to(stream, data_offset);
+                write_plane(stream, std::span<const std::uint8_t>(chunk_data));
+            }
+            else
+            {
+                pad_to(stream, header.types_offset);
+                write_plane(stream, tile_types);
+                pad_to(stream, header.costs_offset);
+                write_plane(stream, move_costs);
+            }
+
+            if (m_write_chunk_index)
+            {
+                pad_to(stream, header.chunk_index_offset);
+                for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+                {
+                    for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+                    {
+                        write_value(stream, hash_chunk(grid, chunk_x, chunk_y));
+                    }
+                }
+            }
+
+            if (!stream.flush())
+            {
+                log_error("Failed to write map file: " + temp_path.string());
+                return false;
+            }
+        }
+
+        release_mapped(map_name);
+        std::filesystem::rename(temp_path, path, error);
+        if (error)
+        {
+            log_error("Failed to commit map file: " + error.message());
+            std::filesystem::remove(temp_path, error);
+            return false;
+        }
+
+        log_info("Saved map '" + map_name + "' (" + std::to_string(grid.get_width()) + "x" +
+                 std::to_string(grid.get_height()) + ")");
+        return true;
+    }
+
+    auto FileGridRepository::save_map_changes(const std::string &map_name, const Grid &grid)
+        -> bool
+    {
+        if (!grid.has_dirty_chunks())
+        {
+            log_debug("No changes to save for map: " + map_name);
+            return true;
+        }
+
+        // The file is replaced atomically, so any change rewrites it whole, re-encoding every
+        // chunk (or, with the Planes layout, copying the planes straight from the grid)
+        return save_map(map_name, grid);
+    }
+
+    auto FileGridRepository::get_map_size(const std::string &map_name)
+        -> std::optional<Vector2i>
+    {
+        if (!is_valid_name(map_name))
+        {
+            return std::nullopt;
+        }
+
+        const auto info = read_map_info(path_for(map_name));
+        if (!info.has_value())
+        {
+            return std::nullopt;
+        }
+        return Vector2i(info->width, info->height);
+    }
+
+    auto FileGridRepository::load_chunk(const std::string &map_name, const GridChunk &chunk)
+        -> bool
+    {
+        const MappedMap *mapped = open_mapped(map_name);
+        if (mapped == nullptr || chunk.coord.x < 0 || chunk.coord.x >= mapped->chunks_x ||
+            chunk.coord.y < 0 || chunk.coord.y >= mapped->chunks_y)
+        {
+            return false;
+        }
+
+        return read_chunk(*mapped, chunk);
+    }
+
+    auto FileGridRepository::list_maps() -> std::vector<MapMetadata>
+    {
+        std::vector<MapMetadata> maps;
+
+        std::error_code error;
+        std::filesystem::directory_iterator entries(m_directory, error);
+        if (error)
+        {
+            return maps;
+        }
+
+        for (const auto &entry : entries)
+        {
+            const std::filesystem::path &path = entry.path();
+            if (!entry.is_regular_file(error) || path.extension() != MAP_EXTENSION)
+            {
+                continue;
+            }
+
+            const auto info = read_map_info(path);
+            if (!info.has_value())
+            {
+                continue;
+            }
+
+            MapMetadata metadata;
+            metadata.name = path.stem().string();
+            metadata.width = info->width;
+            metadata.height = info->height;
+            metadata.created_at = format_time(info->created_at);
+            metadata.updated_at = format_time(info->updated_at);
+            maps.push_back(std::move(metadata));
+        }
+
+        std::ranges::sort(maps, {}, &MapMetadata::name);
+
+        // There is no database key; ids are positions in the sorted listing
+        int next_id = 1;
+        for (MapMetadata &metadata : maps)
+        {
+            metadata.id = next_id++;
+        }
+
+        return maps;
+    }
+
+    auto FileGridRepository::map_exists(const std::string &map_name) -> bool
+    {
+        return is_valid_name(map_name) && read_map_info(path_for(map_name)).has_value();
+    }
+
+    auto FileGridRepository::delete_map(const std::string &map_name) -> bool
+    {
+        if (!is_valid_name(map_name))
+        {
+            log_error("Invalid map name: " + map_name);
+            return false;
+        }
+
+        release_mapped(map_name);
+        std::error_code error;
+        if (!std::filesystem::remove(path_for(map_name), error))
+        {
+            log_error("Map not found: " + map_name);
+            return false;
+        }
+
+        std::filesystem::remove(config_path_for(map_name), error);
+
+        log_info("Deleted map '" + map_name + "'");
+        return true;
+    }
+
+    auto FileGridRepository::load_generator_config(const std::string &map_name)
+        -> std::optional<GeneratorConfig>
+    {
+        if (!is_valid_name(map_name))
+        {
+            return std::nullopt;
+        }
+
+        // Size comes from the map itself, as with the SQLite repository
+        const auto info = read_map_info(path_for(map_name));
+        if (!info.has_value())
+        {
+            return std::nullopt;
+        }
+
+        std::ifstream stream(config_path_for(map_name), std::ios::binary);
+        if (!stream)
+        {
+            return std::nullopt;
+        }
+
+        std::array<char, 4> magic{};
+        std::uint32_t format_version = 0;
+        if (!read_value(stream, magic) || !read_value(stream, format_version) ||
+            magic != CONFIG_MAGIC || format_version != CONFIG_FORMAT_VERSION)
+        {
+            log_warning("Unsupported generator config file: " +
+                        config_path_for(map_name).string());
+            return std::nullopt;
+        }
+
+        // Fields that are not stored (thread count) keep their defaults
+        GeneratorConfig config = GeneratorConfig::default_config();
+        config.width = info->width;
+        config.height = info->height;
+        if (!read_value(stream, config.seed) || !read_value(stream, config.noise_scale) ||
+            !read_value(stream, config.noise_octaves) ||
+            !read_value(stream, config.ca_iterations) ||
+            !read_value(stream, config.water_threshold) ||
+            !read_value(stream, config.grass_threshold) ||
+            !read_value(stream, config.forest_threshold) ||
+            !read_value(stream, config.mountain_threshold))
+        {
+            log_warning("Truncated generator config file: " + config_path_for(map_name).string());
+            return std::nullopt;
+        }
+
+        return config;
+    }
+
+    auto FileGridRepository::save_generator_config(const std::string &map_name,
+                                                   const GeneratorConfig &config) -> bool
+    {
+        if (!is_valid_name(map_name))
+        {
+            log_error("Invalid map name: " + map_name);
+            return false;
+        }
+
+        std::error_code error;
+        std::filesystem::create_directories(m_directory, error);
+        if (error)
+        {
+            log_error("Failed to create map directory: " + error.message());
+            return false;
+        }
+
+        const std::filesystem::path path = config_path_for(map_name);
+        std::filesystem::path temp_path = path;
+        temp_path += ".tmp";
+        {
+            std::ofstream stream(temp_path, std::ios::binary | std::ios::trunc);
+            if (!stream)
+            {
+                log_error("Failed to open generator config file: " + temp_path.string());
+                return false;
+            }
+
+            // Fields are written one by one so struct padding never reaches the file
+            write_value(stream, CONFIG_MAGIC);
+            write_value(stream, CONFIG_FORMAT_VERSION);
+            write_value(stream, config.seed);
+            write_value(stream, config.noise_scale);
+            write_value(stream, config.noise_octaves);
+            write_value(stream, config.ca_iterations);
+            write_value(stream, config.water_threshold);
+            write_value(stream, config.grass_threshold);
+            write_value(stream, config.forest_threshold);
+            write_value(stream, config.mountain_threshold);
+
+            if (!stream.flush())
+            {
+                log_error("Failed to write generator config file: " + temp_path.string());
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temp_path, path, error);
+        if (error)
+        {
+            log_error("Failed to commit generator config file: " + error.message());
+            std::filesystem::remove(temp_path, error);
+            return false;
+        }
+        return true;
+    }
+
+    auto FileGridRepository::load_chunk_hashes(const std::string &map_name)
+        -> std::vector<std::uint64_t>
+    {
+        std::vector<std::uint64_t> hashes;
+        if (!is_valid_name(map_name))
+        {
+            return hashes;
+        }
+
+        const auto opened = open_map_file(path_for(map_name));
+        if (!opened.has_value() || (opened->second.flags & FLAG_CHUNK_INDEX) == 0)
+        {
+            return hashes;
+        }
+        const auto &[file, header] = *opened;
+
+        hashes.resize(header.chunk_count);
+        std::memcpy(hashes.data(), file.get_bytes().subspan(header.chunk_index_offset).data(),
+                    hashes.size() * sizeof(std::uint64_t));
+        return hashes;
+    }
+
+    auto FileGridRepository::hash_chunk(const Grid &grid, int chunk_x, int chunk_y)
+        -> std::uint64_t
+    {
+        const ConstGridChunk chunk = grid.get_chunk(chunk_x, chunk_y);
+        std::uint64_t hash = FNV_OFFSET;
+        hash_span(hash, std::as_bytes(chunk.tile_types));
+        hash_span(hash, std::as_bytes(chunk.move_costs));
+        return hash;
+    }
+
+    auto FileGridRepository::path_for(const std::string &map_name) const -> std::filesystem::path
+    {
+        return m_directory / (map_name + std::string(MAP_EXTENSION));
+    }
+
+    auto FileGridRepository::get_directory() const -> const std::filesystem::path &
+    {
+        return m_directory;
+    }
+
+    auto FileGridRepository::is_valid_name(const std::string &map_name) -> bool
+    {
+        return !map_name.empty() && map_name.front() != '.' &&
+               map_name.find_first_of("/\\") == std::string::npos;
+    }
+
+    auto FileGridRepository::config_path_for(const std::string &map_name) const
+        -> std::filesystem::path
+    {
+        return m_directory / (map_name + std::string(CONFIG_EXTENSION));
+    }
+
+    auto FileGridRepository::open_mapped(const std::string &map_name) -> const MappedMap *
+    {
+        if (m_mapped.has_value() && m_mapped->name == map_name)
+        {
+            return &*m_mapped;
+        }
+
+        m_mapped.reset();
+        if (!is_valid_name(map_name))
+        {
+            return nullptr;
+        }
+
+        auto opened = open_map_file(path_for(map_name));
+        if (!opened.has_value())
+        {
+            return nullptr;
+        }
+
+        auto &[file, header] = *opened;
+        m_mapped = MappedMap{
+            .name = map_name,
+            .file = std::move(file),
+            .encoded_chunks = has_encoded_chunks(header),
+            .types_offset = header.types_offset,
+            .costs_offset = header.costs_offset,
+            .chunk_table_offset = header.chunk_table_offset,
+            .width = header.width,
+            .height = header.height,
+            .chunks_x = (header.width + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE,
+            .chunks_y = (header.height + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE};
+        return &*m_mapped;
+    }
+
+    auto FileGridRepository::read_chunk(const MappedMap &mapped, const GridChunk &chunk) -> bool
+    {
+        const auto chunk_index =
+            static_cast<std::uint64_t>((chunk.coord.y * mapped.chunks_x) + chunk.coord.x);
+        const auto bytes = mapped.file.get_bytes();
+
+        if (!mapped.encoded_chunks)
+        {
+            // Chunks are stored whole and row-major in both planes, as in Grid
+            const std::uint64_t offset = chunk_index * Grid::CHUNK_TILE_COUNT;
+            std::memcpy(chunk.tile_types.data(), bytes.subspan(mapped.types_offset + offset).data(),
+                        Grid::CHUNK_TILE_COUNT);
+            std::memcpy(chunk.move_costs.data(), bytes.subspan(mapped.costs_offset + offset).data(),
+                        Grid::CHUNK_TILE_COUNT);
+            return std::ranges::max(chunk.tile_types) <=
+                   static_cast<std::uint8_t>(Tile::Type::Wall);
+        }
+
+        ChunkTableEntry entry{};
+        std::memcpy(&entry,
+                    bytes.subspan(mapped.chunk_table_offset + (chunk_index * sizeof(entry))).data(),
+                    sizeof(entry));
+        if (entry.offset > bytes.size() || entry.size > bytes.size() - entry.offset)
+        {
+            return false;
+        }
+
+        return decode_chunk_blob(bytes.subspan(entry.offset, entry.size), chunk);
+    }
+
+    void FileGridRepository::release_mapped(const std::string &map_name)
+    {
+        if (m_mapped.has_value() && m_mapped->name == map_name)
+        {
+            m_mapped.reset();
+        }
+    }
+
+    auto FileGridRepository::read_map_info(const std::filesystem::path &path)
+        -> std::optional<StoredMapInfo>
+    {
+        // Only the header is needed, so read it rather than mapping the whole file
+        std::ifstream stream(path, std::ios::binary);
+        FileHeader header{};
+        if (!stream || !read_header(stream, header))
+        {
+            return std::nullopt;
+        }
+
+        return StoredMapInfo{.width = header.width,
+                             .height = header.height,
+                             .created_at = header.created_at,
+                             .updated_at = header.updated_at};
+    }
+} // namespace Tactics
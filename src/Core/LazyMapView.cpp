@@ -0,0 +1,95 @@
+#include "Tactics/Core/LazyMapView.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Core/Logger.hpp"
+#include <algorithm>
+#include <cmath>
+
+namespace Tactics
+{
+    namespace
+    {
+        // Weight of the newest camera motion sample in the smoothed velocity
+        constexpr float VELOCITY_SMOOTHING = 0.5F;
+    } // namespace
+
+    LazyMapView::LazyMapView(IGridRepository *repository, const std::string &map_name)
+    {
+        if (repository != nullptr)
+        {
+            m_size = repository->get_map_size(map_name);
+        }
+
+        if (!m_size.has_value())
+        {
+            log_error("Map not found: " + map_name);
+        }
+    }
+
+    auto LazyMapView::is_open() const -> bool
+    {
+        return m_size.has_value();
+    }
+
+    auto LazyMapView::get_width() const -> int
+    {
+        return m_size.has_value() ? m_size->x : 0;
+    }
+
+    auto LazyMapView::get_height() const -> int
+    {
+        return m_size.has_value() ? m_size->y : 0;
+    }
+
+    auto LazyMapView::get_chunks_x() const -> int
+    {
+        return (std::max(get_width(), 0) + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE;
+    }
+
+    auto LazyMapView::get_chunks_y() const -> int
+    {
+        return (std::max(get_height(), 0) + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE;
+    }
+
+    void LazyMapView::track_camera(const Camera &camera, float delta_time)
+    {
+        const Vector2f position = camera.get_position();
+        if (m_last_camera_position.has_value() && delta_time > 0.0F)
+        {
+            const Vector2f measured = (position - *m_last_camera_position) / delta_time;
+            m_camera_velocity += (measured - m_camera_velocity) * VELOCITY_SMOOTHING;
+        }
+        m_last_camera_position = position;
+    }
+
+    auto LazyMapView::get_chunk_range(const Rectf &world_rect, float tile_size) const -> Recti
+    {
+        // Tiles are centred on their world position, so pad the rectangle by one tile
+        const auto chunk_world_size = tile_size * static_cast<float>(Grid::CHUNK_SIZE);
+        const auto to_chunk = [&](float world) -> int
+        { return static_cast<int>(std::floor(world / chunk_world_size)); };
+
+        const int start_x = std::max(to_chunk(world_rect.left() - tile_size), 0);
+        const int start_y = std::max(to_chunk(world_rect.top() - tile_size), 0);
+        const int end_x = std::min(to_chunk(world_rect.right() + tile_size) + 1, get_chunks_x());
+        const int end_y = std::min(to_chunk(world_rect.bottom() + tile_size) + 1, get_chunks_y());
+
+        return {start_x, start_y, std::max(end_x - start_x, 0), std::max(end_y - start_y, 0)};
+    }
+
+    auto LazyMapView::get_prefetch_range(const Camera &camera, float tile_size,
+                                         float prefetch_seconds) const -> Recti
+    {
+        const Rectf view_rect = camera.get_view_rect();
+        const Vector2f lead = m_camera_velocity * prefetch_seconds;
+        const float left = std::min(view_rect.left(), view_rect.left() + lead.x);
+        const float top = std::min(view_rect.top(), view_rect.top() + lead.y);
+        const float right = std::max(view_rect.right(), view_rect.right() + lead.x);
+        const float bottom = std::max(view_rect.bottom(), view_rect.bottom() + lead.y);
+        return get_chunk_range(Rectf(left, top, right - left, bottom - top), tile_size);
+    }
+
+    auto LazyMapView::get_camera_velocity() const -> Vector2f
+    {
+        return m_camera_velocity;
+    }
+} // namespace Tactics
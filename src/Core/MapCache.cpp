@@ -0,0 +1,273 @@
+#include "Tactics/Core/MapCache.hpp"
+#include "Tactics/Core/Logger.hpp"
+#include "Tactics/Core/MapGenerator.hpp"
+#include "Tactics/Core/TilePlaneCodec.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr std::array<char, 4> MAGIC = {'T', 'M', 'A', 'P'};
+        constexpr std::uint64_t FNV_OFFSET = 14695981039346656037ULL;
+        constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+        // Largest chunk blob a valid entry can hold: both planes stored raw plus the blob header
+        constexpr std::uint32_t MAX_CHUNK_BLOB_SIZE = (2U * Grid::CHUNK_TILE_COUNT) + 16U;
+
+        struct Header
+        {
+            std::array<char, 4> magic;
+            std::uint32_t format_version;
+            std::uint64_t key;
+            std::int32_t width;
+            std::int32_t height;
+            std::uint32_t chunk_count;
+        };
+
+        // Suffix for a temporary entry file, unique within the process so concurrent stores of
+        // one key never write into the same file
+        auto next_temp_suffix() -> std::string
+        {
+            static std::atomic<std::uint64_t> temp_count{0};
+            return "." + std::to_string(temp_count.fetch_add(1)) + ".tmp";
+        }
+
+        void hash_bytes(std::uint64_t &hash, std::uint32_t value)
+        {
+            for (int byte = 0; byte < 4; ++byte)
+            {
+                hash ^= (value >> (byte * 8)) & 0xFFU;
+                hash *= FNV_PRIME;
+            }
+        }
+
+        void hash_int(std::uint64_t &hash, int value)
+        {
+            hash_bytes(hash, static_cast<std::uint32_t>(value));
+        }
+
+        void hash_float(std::uint64_t &hash, float value)
+        {
+            hash_bytes(hash, std::bit_cast<std::uint32_t>(value));
+        }
+
+        template <typename T> void write_value(std::ofstream &stream, const T &value)
+        {
+            stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        template <typename T> auto read_value(std::ifstream &stream, T &value) -> bool
+        {
+            return static_cast<bool>(stream.read(reinterpret_cast<char *>(&value), sizeof(T)));
+        }
+
+        // Fields are written one by one so struct padding never reaches the file
+        void write_header(std::ofstream &stream, const Header &header)
+        {
+            write_value(stream, header.magic);
+            write_value(stream, header.format_version);
+            write_value(stream, header.key);
+            write_value(stream, header.width);
+            write_value(stream, header.height);
+            write_value(stream, header.chunk_count);
+        }
+
+        auto read_header(std::ifstream &stream, Header &header) -> bool
+        {
+            return read_value(stream, header.magic) && read_value(stream, header.format_version) &&
+                   read_value(stream, header.key) && read_value(stream, header.width) &&
+                   read_value(stream, header.height) && read_value(stream, header.chunk_count);
+        }
+    } // namespace
+
+    MapCache::MapCache(std::filesystem::path directory) : m_directory(std::move(directory)) {}
+
+    auto MapCache::key_of(const GeneratorConfig &config) -> std::uint64_t
+    {
+        std::uint64_t hash = FNV_OFFSET;
+        hash_bytes(hash, MapGenerator::VERSION);
+        hash_int(hash, config.width);
+        hash_int(hash, config.height);
+        hash_int(hash, config.seed);
+        hash_float(hash, config.noise_scale);
+        hash_int(hash, config.noise_octaves);
+        hash_int(hash, config.ca_iterations);
+        hash_float(hash, config.water_threshold);
+        hash_float(hash, config.grass_threshold);
+        hash_float(hash, config.forest_threshold);
+        hash_float(hash, config.mountain_threshold);
+        return hash;
+    }
+
+    auto MapCache::get_or_generate(const GeneratorConfig &config,
+                                   const MapGenerator::ProgressCallback &on_progress,
+                                   ThreadPool *pool) -> Grid
+    {
+        if (auto cached = load(config))
+        {
+            ++m_hit_count;
+            log_debug("Map cache hit: " + path_for(key_of(config)).string());
+            if (on_progress)
+            {
+                on_progress(1.0F);
+            }
+            return std::move(*cached);
+        }
+
+        ++m_miss_count;
+        MapGenerator generator(config, pool);
+        generator.set_progress_callback(on_progress);
+        Grid grid = generator.generate();
+        if (!store(config, grid))
+        {
+            log_warning("Failed to store generated map in cache");
+        }
+        return grid;
+    }
+
+    auto MapCache::load(const GeneratorConfig &config) const -> std::optional<Grid>
+    {
+        const std::uint64_t key = key_of(config);
+        std::ifstream stream(path_for(key), std::ios::binary);
+        if (!stream)
+        {
+            return std::nullopt;
+        }
+
+        Header header{};
+        if (!read_header(stream, header) || header.magic != MAGIC ||
+            header.format_version != FORMAT_VERSION || header.key != key ||
+            header.width != config.width || header.height != config.height)
+        {
+            log_warning("Ignoring stale or corrupt map cache entry: " + path_for(key).string());
+            return std::nullopt;
+        }
+
+        Grid grid;
+        grid.resize(header.width, header.height);
+        if (header.chunk_count != static_cast<std::uint32_t>(grid.get_chunk_count()))
+        {
+            log_warning("Ignoring stale or corrupt map cache entry: " + path_for(key).string());
+            return std::nullopt;
+        }
+
+        // Chunk blobs follow in row-major chunk order, each after its 32-bit size
+        std::vector<std::uint8_t> blob;
+        for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+        {
+            for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+            {
+                std::uint32_t blob_size = 0;
+                if (!read_value(stream, blob_size) || blob_size > MAX_CHUNK_BLOB_SIZE)
+                {
+                    log_warning("Truncated map cache entry: " + path_for(key).string());
+                    return std::nullopt;
+                }
+
+                blob.resize(blob_size);
+                if (!stream.read(reinterpret_cast<char *>(blob.data()),
+                                 static_cast<std::streamsize>(blob_size)) ||
+                    !decode_chunk_blob(blob, grid.get_chunk(chunk_x, chunk_y)))
+                {
+                    log_warning("Truncated map cache entry: " + path_for(key).string());
+                    return std::nullopt;
+                }
+            }
+        }
+
+        for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+        {
+            for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+            {
+                grid.mark_chunk_changed(chunk_x, chunk_y);
+            }
+        }
+
+        return grid;
+    }
+
+    auto MapCache::store(const GeneratorConfig &config, const Grid &grid) const -> bool
+    {
+        std::error_code error;
+        std::filesystem::create_directories(m_directory, error);
+        if (error)
+        {
+            log_error("Failed to create map cache directory: " + error.message());
+            return false;
+        }
+
+        const std::uint64_t key = key_of(config);
+        const Header header{.magic = MAGIC,
+                            .format_version = FORMAT_VERSION,
+                            .key = key,
+                            .width = grid.get_width(),
+                            .height = grid.get_height(),
+                            .chunk_count = static_cast<std::uint32_t>(grid.get_chunk_count())};
+
+        // Write beside the entry and rename, so readers never see a partial file
+        const std::filesystem::path path = path_for(key);
+        std::filesystem::path temp_path = path;
+        temp_path += next_temp_suffix();
+        {
+            std::ofstream stream(temp_path, std::ios::binary | std::ios::trunc);
+            if (!stream)
+            {
+                log_error("Failed to open map cache entry: " + temp_path.string());
+                return false;
+            }
+            write_header(stream, header);
+            std::vector<std::uint8_t> blob;
+            for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+            {
+                for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+                {
+                    blob.clear();
+                    encode_chunk_blob(grid.get_chunk(chunk_x, chunk_y), blob);
+                    write_value(stream, static_cast<std::uint32_t>(blob.size()));
+                    stream.write(reinterpret_cast<const char *>(blob.data()),
+                                 static_cast<std::streamsize>(blob.size()));
+                }
+            }
+            if (!stream.flush())
+            {
+                log_error("Failed to write map cache entry: " + temp_path.string());
+                return false;
+            }
+        }
+
+        std::filesystem::rename(temp_path, path, error);
+        if (error)
+        {
+            log_error("Failed to commit map cache entry: " + error.message());
+            std::filesystem::remove(temp_path, error);
+            return false;
+        }
+        return true;
+    }
+
+    auto MapCache::path_for(std::uint64_t key) const -> std::filesystem::path
+    {
+        std::array<char, 17> name{};
+        std::snprintf(name.data(), name.size(), "%016llx", static_cast<unsigned long long>(key));
+        return m_directory / (std::string(name.data()) + ".map");
+    }
+
+    auto MapCache::get_hit_count() const -> std::size_t
+    {
+        return m_hit_count.load();
+    }
+
+    auto MapCache::get_miss_count() const -> std::size_t
+    {
+        return m_miss_count.load();
+    }
+} // namespace Tactics
@@ -4,47 +4,51 @@
 #include "Tactics/Core/Vector2.hpp"
 #include <algorithm>
 #include <array>
-#include <cmath>
-#include <queue>
+#include <deque>
+#include <functional>
+#include <limits>
 #include <random>
-#include <unordered_set>
+#include <span>
+#include <utility>
 
 namespace
 {
-    constexpr float k_octave_persistence = 0.5F;
-    constexpr float k_octave_lacunarity = 2.0F;
-    constexpr float k_heightmap_min = 0.0F;
-    constexpr float k_heightmap_max = 1.0F;
-    constexpr float k_min_amplitude = 0.0001F;
     constexpr float k_selector_scale = 2.0F;
     constexpr float k_selector_offset_x = 17.0F;
     constexpr float k_selector_offset_y = 31.0F;
     constexpr float k_selector_threshold = 0.5F;
     constexpr float k_road_density = 0.03F;
-    constexpr float k_hash_normalizer = 16777215.0F;
-    constexpr float k_smoothstep_a = 3.0F;
-    constexpr float k_smoothstep_b = 2.0F;
 
     constexpr int k_move_cost_walkable = 1;
     constexpr int k_move_cost_slow = 2;
     constexpr int k_move_cost_blocked = -1;
     constexpr int k_min_road_count = 1;
-    constexpr int k_walkable_neighbor_threshold = 3;
-
-    constexpr uint32_t k_hash_prime_x = 374761393U;
-    constexpr uint32_t k_hash_prime_y = 668265263U;
-    constexpr uint32_t k_hash_seed_mix = 0x9E3779B9U;
-    constexpr uint32_t k_hash_shift_left = 6U;
-    constexpr uint32_t k_hash_shift_right = 2U;
-    constexpr uint32_t k_hash_xor_shift = 13U;
-    constexpr uint32_t k_hash_multiplier = 1274126177U;
-    constexpr uint32_t k_hash_final_shift = 16U;
-    constexpr uint32_t k_hash_mask = 0x00FFFFFFU;
+
+    // Share of generate() finished after each stage
+    constexpr float k_progress_heightmap = 0.3F;
+    constexpr float k_progress_tiles = 0.4F;
+    constexpr float k_progress_smoothing = 0.6F;
+    constexpr float k_progress_grid = 0.7F;
+    constexpr float k_progress_done = 1.0F;
 } // namespace
 
 namespace Tactics
 {
-    MapGenerator::MapGenerator(const GeneratorConfig &config) : m_config(config) {}
+    MapGenerator::MapGenerator(const GeneratorConfig &config, ThreadPool *pool)
+        : m_config(config), m_noise(config.seed),
+          m_automaton(CellularAutomaton::majority_rules()), m_shared_pool(pool)
+    {
+    }
+
+    void MapGenerator::set_smoothing_rules(std::vector<CellularAutomaton::Rule> rules)
+    {
+        m_automaton = CellularAutomaton(std::move(rules));
+    }
+
+    void MapGenerator::set_progress_callback(ProgressCallback callback)
+    {
+        m_on_progress = std::move(callback);
+    }
 
     auto MapGenerator::generate() -> Grid
     {
@@ -53,123 +57,157 @@ namespace Tactics
 
         // Stage 1: Generate heightmap using simple noise
         auto heightmap = generate_heightmap();
+        report_progress(k_progress_heightmap);
 
         // Stage 2: Convert heightmap to tile types
         auto tile_types = heightmap_to_tiles(heightmap);
+        report_progress(k_progress_tiles);
 
         // Stage 3: Apply cellular automata smoothing
         apply_cellular_automata(tile_types);
+        report_progress(k_progress_smoothing);
 
         // Create grid and populate with tiles
         Grid grid;
         grid.resize(m_config.width, m_config.height);
 
-        for (int y_pos = 0; y_pos < m_config.height; ++y_pos)
-        {
-            for (int x_pos = 0; x_pos < m_config.width; ++x_pos)
+        // Write tile types and move costs straight into the grid. Bands are one chunk row tall,
+        // so every chunk is written by exactly one worker.
+        for_each_row_band(
+            [&](int row_begin, int /*row_end*/)
             {
-                const size_t idx = index_of(x_pos, y_pos);
-                const Tile::Type tile_type = tile_types[idx];
-
-                int move_cost = k_move_cost_walkable;
-                switch (tile_type)
+                const int chunk_y = row_begin / Grid::CHUNK_SIZE;
+                for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
                 {
-                case Tile::Type::Grass:
-                case Tile::Type::Road:
-                    move_cost = k_move_cost_walkable;
-                    break;
-                case Tile::Type::Desert:
-                case Tile::Type::Forest:
-                    move_cost = k_move_cost_slow;
-                    break;
-                case Tile::Type::Water:
-                case Tile::Type::Mountain:
-                case Tile::Type::Wall:
-                    move_cost = k_move_cost_blocked;
-                    break;
+                    const GridChunk chunk = grid.get_chunk(chunk_x, chunk_y);
+
+                    for (int local_y = 0; local_y < chunk.bounds.height; ++local_y)
+                    {
+                        for (int local_x = 0; local_x < chunk.bounds.width; ++local_x)
+                        {
+                            const Tile::Type tile_type = tile_types[index_of(
+                                chunk.bounds.x + local_x, chunk.bounds.y + local_y)];
+                            const auto local_index =
+                                static_cast<size_t>((local_y * Grid::CHUNK_SIZE) + local_x);
+
+                            chunk.tile_types[local_index] = static_cast<std::uint8_t>(tile_type);
+                            chunk.move_costs[local_index] =
+                                static_cast<std::int8_t>(move_cost_for(tile_type));
+                        }
+                    }
                 }
+            });
 
-                const Vector2i position(x_pos, y_pos);
-                const Tile tile(position, tile_type, move_cost);
-                grid.set_tile(position, tile);
+        // Revisions are bumped on this thread once the workers are done
+        for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+        {
+            for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+            {
+                grid.mark_chunk_changed(chunk_x, chunk_y);
             }
         }
+        report_progress(k_progress_grid);
 
         // Stage 4: Post-process for tactical features
         add_tactical_features(grid);
+        report_progress(k_progress_done);
 
         log_info("Map generation complete");
         return grid;
     }
 
-    auto MapGenerator::generate_heightmap() -> std::vector<float>
+    auto MapGenerator::generate_region(const Recti &region) const -> std::vector<Tile::Type>
     {
-        std::vector<float> heightmap(static_cast<size_t>(m_config.width * m_config.height));
+        if (region.width <= 0 || region.height <= 0 || region.x < 0 || region.y < 0 ||
+            region.right() > m_config.width || region.bottom() > m_config.height)
+        {
+            log_warning("Region is empty or outside the map");
+            return {};
+        }
 
-        for (int y_pos = 0; y_pos < m_config.height; ++y_pos)
+        // Smoothing reads one tile further per iteration, so a halo of ca_iterations tiles
+        // makes the region exact. The halo stops at the map edge, where generate() also stops.
+        const int halo = std::max(m_config.ca_iterations, 0);
+        const int outer_x = std::max(region.x - halo, 0);
+        const int outer_y = std::max(region.y - halo, 0);
+        const int outer_width = std::min(region.right() + halo, m_config.width) - outer_x;
+        const int outer_height = std::min(region.bottom() + halo, m_config.height) - outer_y;
+
+        const auto outer_stride = static_cast<size_t>(outer_width);
+        std::vector<Tile::Type> tiles(outer_stride * static_cast<size_t>(outer_height));
+        std::vector<float> heights(outer_stride);
+        for (int row = 0; row < outer_height; ++row)
         {
-            for (int x_pos = 0; x_pos < m_config.width; ++x_pos)
+            m_noise.fractal_row(outer_y + row, outer_x, heights, m_config.noise_scale,
+                                m_config.noise_octaves);
+            for (int column = 0; column < outer_width; ++column)
             {
-                float frequency = m_config.noise_scale;
-                float amplitude = 1.0F;
-                float value = 0.0F;
-                float max_amplitude = 0.0F;
-
-                for (int octave = 0; octave < m_config.noise_octaves; ++octave)
-                {
-                    const float sample_x = static_cast<float>(x_pos) * frequency;
-                    const float sample_y = static_cast<float>(y_pos) * frequency;
-
-                    value += simple_noise(sample_x, sample_y) * amplitude;
-                    max_amplitude += amplitude;
-
-                    amplitude *= k_octave_persistence;
-                    frequency *= k_octave_lacunarity;
-                }
-
-                value = value / std::max(max_amplitude, k_min_amplitude);
-                heightmap[index_of(x_pos, y_pos)] =
-                    std::clamp(value, k_heightmap_min, k_heightmap_max);
+                tiles[(static_cast<size_t>(row) * outer_stride) + static_cast<size_t>(column)] =
+                    classify_height(outer_x + column, outer_y + row,
+                                    heights[static_cast<size_t>(column)]);
             }
         }
 
-        return heightmap;
+        std::vector<Tile::Type> scratch(tiles.size());
+        for (int iteration = 0; iteration < m_config.ca_iterations; ++iteration)
+        {
+            m_automaton.step_rows(tiles, scratch, outer_width, outer_height, 0, outer_height);
+            tiles.swap(scratch);
+        }
+
+        // Crop the halo away
+        std::vector<Tile::Type> result(static_cast<size_t>(region.width) *
+                                       static_cast<size_t>(region.height));
+        for (int row = 0; row < region.height; ++row)
+        {
+            const auto source = tiles.begin() +
+                                static_cast<std::ptrdiff_t>(
+                                    (static_cast<size_t>(region.y - outer_y + row) *
+                                     outer_stride) +
+                                    static_cast<size_t>(region.x - outer_x));
+            std::copy_n(source, region.width,
+                        result.begin() + static_cast<std::ptrdiff_t>(row * region.width));
+        }
+        return result;
     }
 
-    auto MapGenerator::simple_noise(float x_pos, float y_pos) const -> float
+    auto MapGenerator::move_cost_for(Tile::Type tile_type) -> int
     {
-        const int x_floor = static_cast<int>(std::floor(x_pos));
-        const int y_floor = static_cast<int>(std::floor(y_pos));
-        const int x_next = x_floor + 1;
-        const int y_next = y_floor + 1;
-
-        const float x_weight = x_pos - static_cast<float>(x_floor);
-        const float y_weight = y_pos - static_cast<float>(y_floor);
-
-        const float value_00 = hash_noise(x_floor, y_floor);
-        const float value_10 = hash_noise(x_next, y_floor);
-        const float value_01 = hash_noise(x_floor, y_next);
-        const float value_11 = hash_noise(x_next, y_next);
-
-        const auto smoothstep = [](float factor) -> float
-        { return factor * factor * (k_smoothstep_a - (k_smoothstep_b * factor)); };
-        const auto lerp = [](float value_start, float value_end, float factor) -> float
-        { return value_start + ((value_end - value_start) * factor); };
-
-        const float interp_x0 = lerp(value_00, value_10, smoothstep(x_weight));
-        const float interp_x1 = lerp(value_01, value_11, smoothstep(x_weight));
-        return lerp(interp_x0, interp_x1, smoothstep(y_weight));
+        switch (tile_type)
+        {
+        case Tile::Type::Grass:
+        case Tile::Type::Road:
+            return k_move_cost_walkable;
+        case Tile::Type::Desert:
+        case Tile::Type::Forest:
+            return k_move_cost_slow;
+        case Tile::Type::Water:
+        case Tile::Type::Mountain:
+        case Tile::Type::Wall:
+            return k_move_cost_blocked;
+        }
+
+        return k_move_cost_walkable;
     }
 
-    auto MapGenerator::hash_noise(int x_pos, int y_pos) const -> float
+    auto MapGenerator::generate_heightmap() -> std::vector<float>
     {
-        uint32_t hash_value = (static_cast<uint32_t>(x_pos) * k_hash_prime_x) +
-                              (static_cast<uint32_t>(y_pos) * k_hash_prime_y);
-        hash_value ^= static_cast<uint32_t>(m_config.seed) + k_hash_seed_mix +
-                      (hash_value << k_hash_shift_left) + (hash_value >> k_hash_shift_right);
-        hash_value = (hash_value ^ (hash_value >> k_hash_xor_shift)) * k_hash_multiplier;
-        hash_value ^= hash_value >> k_hash_final_shift;
-        return static_cast<float>(hash_value & k_hash_mask) / k_hash_normalizer;
+        std::vector<float> heightmap(static_cast<size_t>(m_config.width * m_config.height));
+        const std::span<float> rows(heightmap);
+
+        for_each_row_band(
+            [&](int row_begin, int row_end)
+            {
+                for (int y_pos = row_begin; y_pos < row_end; ++y_pos)
+                {
+                    m_noise.fractal_row(y_pos, 0,
+                                        rows.subspan(index_of(0, y_pos),
+                                                     static_cast<size_t>(m_config.width)),
+                                        m_config.noise_scale, m_config.noise_octaves);
+                }
+            });
+
+        return heightmap;
     }
 
     auto MapGenerator::heightmap_to_tiles(const std::vector<float> &heightmap)
@@ -177,94 +215,38 @@ namespace Tactics
     {
         std::vector<Tile::Type> tiles(heightmap.size());
 
-        for (int y_pos = 0; y_pos < m_config.height; ++y_pos)
-        {
-            for (int x_pos = 0; x_pos < m_config.width; ++x_pos)
+        for_each_row_band(
+            [&](int row_begin, int row_end)
             {
-                const size_t idx = index_of(x_pos, y_pos);
-                const float height = heightmap[idx];
-
-                if (height < m_config.water_threshold)
+                for (int y_pos = row_begin; y_pos < row_end; ++y_pos)
                 {
-                    tiles[idx] = Tile::Type::Water;
-                }
-                else if (height < m_config.grass_threshold)
-                {
-                    tiles[idx] = Tile::Type::Grass;
-                }
-                else if (height < m_config.forest_threshold)
-                {
-                    tiles[idx] = Tile::Type::Forest;
-                }
-                else if (height < m_config.mountain_threshold)
-                {
-                    const float selector = simple_noise(
-                        (static_cast<float>(x_pos) * k_selector_scale) + k_selector_offset_x,
-                        (static_cast<float>(y_pos) * k_selector_scale) + k_selector_offset_y);
-                    tiles[idx] =
-                        selector > k_selector_threshold ? Tile::Type::Mountain : Tile::Type::Desert;
-                }
-                else
-                {
-                    tiles[idx] = Tile::Type::Mountain;
+                    for (int x_pos = 0; x_pos < m_config.width; ++x_pos)
+                    {
+                        const size_t idx = index_of(x_pos, y_pos);
+                        tiles[idx] = classify_height(x_pos, y_pos, heightmap[idx]);
+                    }
                 }
-            }
-        }
+            });
 
         return tiles;
     }
 
     auto MapGenerator::apply_cellular_automata(std::vector<Tile::Type> &tiles) -> void
     {
-        constexpr int MAJORITY_THRESHOLD = 5;
+        // Ping-pong between the tile buffer and one scratch buffer allocated up front
+        std::vector<Tile::Type> scratch(tiles.size());
 
         for (int iteration = 0; iteration < m_config.ca_iterations; ++iteration)
         {
-            std::vector<Tile::Type> new_tiles = tiles;
-
-            for (int y_pos = 0; y_pos < m_config.height; ++y_pos)
-            {
-                for (int x_pos = 0; x_pos < m_config.width; ++x_pos)
+            // Rows only read the previous iteration, so bands are independent
+            for_each_row_band(
+                [&](int row_begin, int row_end)
                 {
-                    const size_t idx = index_of(x_pos, y_pos);
-
-                    const Vector2i position(x_pos, y_pos);
-                    int water_neighbors = 0;
-                    int grass_neighbors = 0;
-                    int forest_neighbors = 0;
-                    int mountain_neighbors = 0;
-                    int desert_neighbors = 0;
-
-                    water_neighbors = count_neighbors(tiles, position, Tile::Type::Water);
-                    grass_neighbors = count_neighbors(tiles, position, Tile::Type::Grass);
-                    forest_neighbors = count_neighbors(tiles, position, Tile::Type::Forest);
-                    mountain_neighbors = count_neighbors(tiles, position, Tile::Type::Mountain);
-                    desert_neighbors = count_neighbors(tiles, position, Tile::Type::Desert);
-
-                    if (water_neighbors >= MAJORITY_THRESHOLD)
-                    {
-                        new_tiles[idx] = Tile::Type::Water;
-                    }
-                    else if (mountain_neighbors >= MAJORITY_THRESHOLD)
-                    {
-                        new_tiles[idx] = Tile::Type::Mountain;
-                    }
-                    else if (forest_neighbors >= MAJORITY_THRESHOLD)
-                    {
-                        new_tiles[idx] = Tile::Type::Forest;
-                    }
-                    else if (grass_neighbors >= MAJORITY_THRESHOLD)
-                    {
-                        new_tiles[idx] = Tile::Type::Grass;
-                    }
-                    else if (desert_neighbors >= MAJORITY_THRESHOLD)
-                    {
-                        new_tiles[idx] = Tile::Type::Desert;
-                    }
-                }
-            }
+                    m_automaton.step_rows(tiles, scratch, m_config.width, m_config.height,
+                                          row_begin, row_end);
+                });
 
-            tiles = std::move(new_tiles);
+            tiles.swap(scratch);
         }
     }
 
@@ -278,8 +260,8 @@ namespace Tactics
             for (int x_pos = 0; x_pos < m_config.width; ++x_pos)
             {
                 const Vector2i pos(x_pos, y_pos);
-                const Tile *tile = grid.get_tile(pos);
-                if (tile != nullptr && tile->get_type() == Tile::Type::Grass)
+                const auto tile = grid.get_tile(pos);
+                if (tile.has_value() && tile->get_type() == Tile::Type::Grass)
                 {
                     grass_positions.push_back(pos);
                 }
@@ -306,154 +288,180 @@ namespace Tactics
 
     auto MapGenerator::ensure_connectivity(Grid &grid) -> void
     {
-        std::vector<Vector2i> walkable_tiles;
-        for (int y_pos = 0; y_pos < m_config.height; ++y_pos)
+        ConnectedComponents components;
+        const std::size_t component_count = components.label(grid);
+        if (component_count == 0)
         {
-            for (int x_pos = 0; x_pos < m_config.width; ++x_pos)
-            {
-                const Vector2i pos(x_pos, y_pos);
-                const Tile *tile = grid.get_tile(pos);
-                if (tile != nullptr && tile->is_walkable())
-                {
-                    walkable_tiles.push_back(pos);
-                }
-            }
+            log_warning("No walkable tiles found in generated map");
+            return;
         }
-
-        if (walkable_tiles.empty())
+        if (component_count == 1)
         {
-            log_warning("No walkable tiles found in generated map");
             return;
         }
 
-        const int connected_count = flood_fill_count(grid, walkable_tiles[0]);
-        if (connected_count >= static_cast<int>(walkable_tiles.size()))
+        carve_corridors(grid, components);
+
+        if (components.label(grid) != 1)
         {
-            return;
+            log_warning("Generated map is still disconnected after carving corridors");
         }
+    }
 
-        for (int y_pos = 1; y_pos < m_config.height - 1; ++y_pos)
+    void MapGenerator::carve_corridors(Grid &grid, const ConnectedComponents &components) const
+    {
+        constexpr std::uint32_t NO_PARENT = std::numeric_limits<std::uint32_t>::max();
+        constexpr int UNREACHED = std::numeric_limits<int>::max();
+
+        const auto labels = components.get_labels();
+        const std::size_t main_component = components.get_largest_component().value_or(0);
+        const auto width = static_cast<std::size_t>(m_config.width);
+        const auto height = static_cast<std::size_t>(m_config.height);
+
+        // 0-1 BFS out of the main component: entering a blocked tile costs one carve,
+        // entering a walkable tile is free
+        std::vector<int> carve_count(labels.size(), UNREACHED);
+        std::vector<std::uint32_t> parents(labels.size(), NO_PARENT);
+        std::vector<bool> settled(labels.size(), false);
+        std::vector<bool> joined(components.get_component_count(), false);
+        joined[main_component] = true;
+
+        std::deque<std::size_t> frontier;
+        for (std::size_t idx = 0; idx < labels.size(); ++idx)
         {
-            for (int x_pos = 1; x_pos < m_config.width - 1; ++x_pos)
+            if (labels[idx] == main_component)
             {
-                const Vector2i pos(x_pos, y_pos);
-                const Tile *tile = grid.get_tile(pos);
+                carve_count[idx] = 0;
+                frontier.push_back(idx);
+            }
+        }
 
-                if (tile == nullptr || tile->is_walkable())
-                {
-                    continue;
-                }
+        while (!frontier.empty())
+        {
+            const std::size_t current = frontier.front();
+            frontier.pop_front();
+            if (settled[current])
+            {
+                continue;
+            }
+            settled[current] = true;
 
-                const int walkable_neighbors = count_walkable_neighbors(grid, pos);
-                if (walkable_neighbors >= k_walkable_neighbor_threshold)
+            // First time a component is reached its cheapest link is known; open it
+            const std::uint32_t label = labels[current];
+            if (label != ConnectedComponents::NO_COMPONENT && !joined[label])
+            {
+                joined[label] = true;
+                for (std::uint32_t step = static_cast<std::uint32_t>(current); step != NO_PARENT;
+                     step = parents[step])
                 {
-                    grid.set_tile(pos, Tile(pos, Tile::Type::Grass, k_move_cost_walkable));
+                    if (labels[step] == ConnectedComponents::NO_COMPONENT)
+                    {
+                        const Vector2i pos(static_cast<int>(step % width),
+                                           static_cast<int>(step / width));
+                        grid.set_tile(pos, Tile(pos, Tile::Type::Grass, k_move_cost_walkable));
+                    }
                 }
             }
-        }
-    }
-
-    auto MapGenerator::index_of(int x_pos, int y_pos) const -> size_t
-    {
-        return (static_cast<size_t>(y_pos) * static_cast<size_t>(m_config.width)) +
-               static_cast<size_t>(x_pos);
-    }
 
-    auto MapGenerator::count_neighbors(const std::vector<Tile::Type> &tiles, Vector2i position,
-                                       Tile::Type type) const -> int
-    {
-        int count = 0;
+            const std::size_t x_pos = current % width;
+            const std::size_t y_pos = current / width;
+            const std::array<bool, 4> in_bounds = {x_pos > 0, x_pos + 1 < width, y_pos > 0,
+                                                   y_pos + 1 < height};
+            const std::array<std::size_t, 4> neighbors = {current - 1, current + 1,
+                                                          current - width, current + width};
 
-        for (int dy_val = -1; dy_val <= 1; ++dy_val)
-        {
-            for (int dx_val = -1; dx_val <= 1; ++dx_val)
+            for (std::size_t dir = 0; dir < neighbors.size(); ++dir)
             {
-                if (dx_val == 0 && dy_val == 0)
+                if (!in_bounds[dir])
                 {
                     continue;
                 }
 
-                const int nx_val = position.x + dx_val;
-                const int ny_val = position.y + dy_val;
+                const std::size_t next = neighbors[dir];
+                const int step_cost = labels[next] == ConnectedComponents::NO_COMPONENT ? 1 : 0;
+                const int next_count = carve_count[current] + step_cost;
+                if (next_count >= carve_count[next])
+                {
+                    continue;
+                }
 
-                if (nx_val >= 0 && nx_val < m_config.width && ny_val >= 0 &&
-                    ny_val < m_config.height)
+                carve_count[next] = next_count;
+                parents[next] = static_cast<std::uint32_t>(current);
+                if (step_cost == 0)
                 {
-                    const size_t idx = index_of(nx_val, ny_val);
-                    if (tiles[idx] == type)
-                    {
-                        ++count;
-                    }
+                    frontier.push_front(next);
+                }
+                else
+                {
+                    frontier.push_back(next);
                 }
             }
         }
-
-        return count;
     }
 
-    auto MapGenerator::count_walkable_neighbors(const Grid &grid, Vector2i position) -> int
+    auto MapGenerator::classify_height(int x_pos, int y_pos, float height) const -> Tile::Type
     {
-        int walkable_neighbors = 0;
-        const std::array<Vector2i, 4> offsets = {Vector2i(-1, 0), Vector2i(1, 0), Vector2i(0, -1),
-                                                 Vector2i(0, 1)};
-
-        for (const auto &offset : offsets)
+        if (height < m_config.water_threshold)
         {
-            const Vector2i neighbor_pos = position + offset;
-            const Tile *neighbor = grid.get_tile(neighbor_pos);
-            if (neighbor != nullptr && neighbor->is_walkable())
-            {
-                ++walkable_neighbors;
-            }
+            return Tile::Type::Water;
         }
-
-        return walkable_neighbors;
+        if (height < m_config.grass_threshold)
+        {
+            return Tile::Type::Grass;
+        }
+        if (height < m_config.forest_threshold)
+        {
+            return Tile::Type::Forest;
+        }
+        if (height < m_config.mountain_threshold)
+        {
+            const float selector = m_noise.sample(
+                (static_cast<float>(x_pos) * k_selector_scale) + k_selector_offset_x,
+                (static_cast<float>(y_pos) * k_selector_scale) + k_selector_offset_y);
+            return selector > k_selector_threshold ? Tile::Type::Mountain : Tile::Type::Desert;
+        }
+        return Tile::Type::Mountain;
     }
 
-    auto MapGenerator::flood_fill_count(const Grid &grid, Vector2i start) const -> int
+    void MapGenerator::report_progress(float progress) const
     {
-        std::unordered_set<size_t> visited;
-        std::queue<Vector2i> to_visit;
-
-        to_visit.push(start);
-        visited.insert(index_of(start.x, start.y));
-
-        int count = 0;
-
-        while (!to_visit.empty())
+        if (m_on_progress)
         {
-            const Vector2i current = to_visit.front();
-            to_visit.pop();
-            ++count;
-
-            const std::array<Vector2i, 4> offsets = {Vector2i(-1, 0), Vector2i(1, 0),
-                                                     Vector2i(0, -1), Vector2i(0, 1)};
-
-            for (const auto &offset : offsets)
-            {
-                const Vector2i neighbor = current + offset;
+            m_on_progress(progress);
+        }
+    }
 
-                if (neighbor.x < 0 || neighbor.x >= m_config.width || neighbor.y < 0 ||
-                    neighbor.y >= m_config.height)
-                {
-                    continue;
-                }
+    void MapGenerator::for_each_row_band(const std::function<void(int, int)> &body)
+    {
+        const int band_count = (m_config.height + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE;
+        get_pool().parallel_for(static_cast<std::size_t>(std::max(band_count, 0)),
+                                [&](std::size_t band, std::size_t /*worker*/)
+                                {
+                                    const int row_begin =
+                                        static_cast<int>(band) * Grid::CHUNK_SIZE;
+                                    body(row_begin,
+                                         std::min(row_begin + Grid::CHUNK_SIZE, m_config.height));
+                                });
+    }
 
-                const size_t hash = index_of(neighbor.x, neighbor.y);
-                if (visited.contains(hash))
-                {
-                    continue;
-                }
+    auto MapGenerator::get_pool() -> ThreadPool &
+    {
+        if (m_shared_pool != nullptr)
+        {
+            return *m_shared_pool;
+        }
 
-                const Tile *tile = grid.get_tile(neighbor);
-                if (tile != nullptr && tile->is_walkable())
-                {
-                    visited.insert(hash);
-                    to_visit.push(neighbor);
-                }
-            }
+        if (m_owned_pool == nullptr)
+        {
+            m_owned_pool = std::make_unique<ThreadPool>(
+                static_cast<std::size_t>(std::max(m_config.thread_count, 0)));
         }
+        return *m_owned_pool;
+    }
 
-        return count;
+    auto MapGenerator::index_of(int x_pos, int y_pos) const -> size_t
+    {
+        return (static_cast<size_t>(y_pos) * static_cast<size_t>(m_config.width)) +
+               static_cast<size_t>(x_pos);
     }
 } // namespace Tactics
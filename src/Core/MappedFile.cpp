@@ -0,0 +1,116 @@
+#include "Tactics/Core/MappedFile.hpp"
+#include "Tactics/Core/Logger.hpp"
+#include <utility>
+
+#if defined(_WIN32)
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Tactics
+{
+    auto MappedFile::open(const std::filesystem::path &path) -> std::optional<MappedFile>
+    {
+        MappedFile file;
+
+#if defined(_WIN32)
+        std::ifstream stream(path, std::ios::binary);
+        if (!stream)
+        {
+            return std::nullopt;
+        }
+
+        file.m_buffer.assign(std::istreambuf_iterator<char>(stream),
+                             std::istreambuf_iterator<char>());
+        file.m_data = file.m_buffer.data();
+        file.m_size = file.m_buffer.size();
+#else
+        const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (descriptor < 0)
+        {
+            return std::nullopt;
+        }
+
+        struct stat status{};
+        if (::fstat(descriptor, &status) != 0)
+        {
+            ::close(descriptor);
+            return std::nullopt;
+        }
+
+        // mmap rejects empty lengths; an empty file is simply an empty span
+        file.m_size = static_cast<std::size_t>(status.st_size);
+        if (file.m_size > 0)
+        {
+            void *mapping = ::mmap(nullptr, file.m_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if (mapping == MAP_FAILED)
+            {
+                log_error("Failed to map file: " + path.string());
+                ::close(descriptor);
+                return std::nullopt;
+            }
+
+            // Loads copy whole planes front to back
+            ::posix_madvise(mapping, file.m_size, POSIX_MADV_SEQUENTIAL);
+            file.m_data = static_cast<const std::uint8_t *>(mapping);
+        }
+
+        // The mapping stays valid after the descriptor is closed
+        ::close(descriptor);
+#endif
+
+        return file;
+    }
+
+    MappedFile::~MappedFile()
+    {
+        unmap();
+    }
+
+    MappedFile::MappedFile(MappedFile &&other) noexcept
+        : m_data(std::exchange(other.m_data, nullptr)), m_size(std::exchange(other.m_size, 0)),
+          m_buffer(std::move(other.m_buffer))
+    {
+    }
+
+    auto MappedFile::operator=(MappedFile &&other) noexcept -> MappedFile &
+    {
+        if (this != &other)
+        {
+            unmap();
+            m_data = std::exchange(other.m_data, nullptr);
+            m_size = std::exchange(other.m_size, 0);
+            m_buffer = std::move(other.m_buffer);
+        }
+        return *this;
+    }
+
+    auto MappedFile::get_bytes() const -> std::span<const std::uint8_t>
+    {
+        return {m_data, m_size};
+    }
+
+    auto MappedFile::get_size() const -> std::size_t
+    {
+        return m_size;
+    }
+
+    void MappedFile::unmap()
+    {
+#if !defined(_WIN32)
+        if (m_data != nullptr)
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+            ::munmap(const_cast<std::uint8_t *>(m_data), m_size);
+        }
+#endif
+        m_data = nullptr;
+        m_size = 0;
+        m_buffer.clear();
+    }
+} // namespace Tactics
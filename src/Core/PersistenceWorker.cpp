@@ -0,0 +1,238 @@
+#include "Tactics/Core/PersistenceWorker.hpp"
+#include "Tactics/Core/Logger.hpp"
+
+namespace Tactics
+{
+    namespace
+    {
+        // Units are move-only, so a snapshot rebuilds them from their state
+        auto snapshot_units(const std::vector<Unit> &units) -> std::vector<Unit>
+        {
+            std::vector<Unit> snapshot;
+            snapshot.reserve(units.size());
+            for (const Unit &unit : units)
+            {
+                snapshot.emplace_back(unit.get_position(), unit.get_move_points());
+            }
+            return snapshot;
+        }
+    } // namespace
+
+    PersistenceWorker::PersistenceWorker(const std::string &db_path)
+        : m_database(std::make_shared<SQLiteDatabase>(db_path)), m_grid_repository(m_database),
+          m_unit_repository(m_database), m_worker([this] { run(); })
+    {
+    }
+
+    PersistenceWorker::~PersistenceWorker()
+    {
+        {
+            const std::lock_guard lock(m_mutex);
+            m_stopping = true;
+        }
+        m_work_ready.notify_one();
+        // m_worker joins after draining the queue
+    }
+
+    auto PersistenceWorker::save_map(const std::string &map_name, const Grid &grid)
+        -> std::shared_future<bool>
+    {
+        // Snapshot before taking the lock so the worker is never held up by the copy
+        Grid snapshot = grid.clone();
+        return enqueue(map_name,
+                       [&](Job &job)
+                       {
+                           // A full write covers whatever an earlier failed write left behind
+                           m_unsaved_grids.erase(map_name);
+                           job.grid = std::move(snapshot);
+                           job.full_map = true;
+                       });
+    }
+
+    auto PersistenceWorker::save_units(const std::string &map_name, const std::vector<Unit> &units)
+        -> std::shared_future<bool>
+    {
+        std::vector<Unit> snapshot = snapshot_units(units);
+        return enqueue(map_name, [&snapshot](Job &job) { job.units = std::move(snapshot); });
+    }
+
+    auto PersistenceWorker::save_generator_config(const std::string &map_name,
+                                                  const GeneratorConfig &config)
+        -> std::shared_future<bool>
+    {
+        return enqueue(map_name, [&config](Job &job) { job.config = config; });
+    }
+
+    auto PersistenceWorker::save_scene(const std::string &map_name, const Grid &grid,
+                                       const std::vector<Unit> &units,
+                                       const std::optional<GeneratorConfig> &config)
+        -> std::shared_future<bool>
+    {
+        Grid grid_snapshot = grid.clone();
+        std::vector<Unit> units_snapshot = snapshot_units(units);
+        return enqueue(map_name,
+                       [&](Job &job)
+                       {
+                           // A replaced snapshot's changes have not been written yet either;
+                           // a queued full save stays full
+                           if (job.grid.has_value())
+                           {
+                               grid_snapshot.merge_dirty_chunks(*job.grid);
+                           }
+                           // So are those of a write that failed
+                           if (auto unsaved = m_unsaved_grids.extract(map_name))
+                           {
+                               grid_snapshot.merge_dirty_chunks(unsaved.mapped());
+                           }
+                           job.grid = std::move(grid_snapshot);
+                           job.units = std::move(units_snapshot);
+                           // A coalesced save without a config keeps the queued one
+                           if (config.has_value())
+                           {
+                               job.config = config;
+                           }
+                       });
+    }
+
+    void PersistenceWorker::flush()
+    {
+        std::unique_lock lock(m_mutex);
+        m_idle.wait(lock, [this] { return m_order.empty() && !m_busy; });
+    }
+
+    auto PersistenceWorker::get_pending_count() const -> std::size_t
+    {
+        const std::lock_guard lock(m_mutex);
+        return m_order.size();
+    }
+
+    auto PersistenceWorker::get_coalesced_count() const -> std::size_t
+    {
+        const std::lock_guard lock(m_mutex);
+        return m_coalesced_count;
+    }
+
+    auto PersistenceWorker::enqueue(const std::string &map_name,
+                                    const std::function<void(Job &)> &fill)
+        -> std::shared_future<bool>
+    {
+        std::shared_future<bool> future;
+        {
+            const std::lock_guard lock(m_mutex);
+            auto found = m_pending.find(map_name);
+            if (found != m_pending.end())
+            {
+                ++m_coalesced_count;
+            }
+            else
+            {
+                found = m_pending.try_emplace(map_name).first;
+                found->second.future = found->second.promise.get_future().share();
+                m_order.push_back(map_name);
+            }
+
+            fill(found->second);
+            future = found->second.future;
+        }
+        m_work_ready.notify_one();
+        return future;
+    }
+
+    void PersistenceWorker::run()
+    {
+        std::unique_lock lock(m_mutex);
+        while (true)
+        {
+            m_work_ready.wait(lock, [this] { return m_stopping || !m_order.empty(); });
+            if (m_order.empty())
+            {
+                // Only reached when stopping with nothing left to write
+                return;
+            }
+
+            std::string map_name = std::move(m_order.front());
+            m_order.pop_front();
+            auto node = m_pending.extract(map_name);
+            m_busy = true;
+
+            // Later saves for this map queue a new job, written after this one
+            lock.unlock();
+            Job &job = node.mapped();
+            const bool saved = write(map_name, job);
+            job.promise.set_value(saved);
+            lock.lock();
+
+            // The caller has already cleared its dirty bits, so the worker keeps them
+            if (!saved && job.grid.has_value())
+            {
+                keep_unsaved_grid(map_name, job);
+            }
+
+            m_busy = false;
+            if (m_order.empty())
+            {
+                m_idle.notify_all();
+            }
+        }
+    }
+
+    void PersistenceWorker::keep_unsaved_grid(const std::string &map_name, Job &job)
+    {
+        Grid &grid = *job.grid;
+        if (job.full_map)
+        {
+            for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+            {
+                for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+                {
+                    grid.mark_chunk_changed(chunk_x, chunk_y);
+                }
+            }
+        }
+
+        // A grid save queued meanwhile takes the missing chunks; a full one already has them
+        const auto queued = m_pending.find(map_name);
+        if (queued != m_pending.end() && queued->second.grid.has_value())
+        {
+            if (!queued->second.full_map)
+            {
+                queued->second.grid->merge_dirty_chunks(grid);
+            }
+            return;
+        }
+
+        m_unsaved_grids.insert_or_assign(map_name, std::move(grid));
+    }
+
+    auto PersistenceWorker::write(const std::string &map_name, Job &job) -> bool
+    {
+        // The repositories' own transactions become savepoints inside this one, so a job that
+        // merged several saves never leaves them out of step
+        SQLiteTransaction transaction(*m_database);
+        bool saved = transaction.is_active();
+
+        if (saved && job.grid.has_value())
+        {
+            saved = job.full_map ? m_grid_repository.save_map(map_name, *job.grid)
+                                 : m_grid_repository.save_map_changes(map_name, *job.grid);
+        }
+        if (saved && job.units.has_value())
+        {
+            saved = m_unit_repository.save_units(map_name, *job.units);
+        }
+        if (saved && job.config.has_value())
+        {
+            saved = m_grid_repository.save_generator_config(map_name, *job.config);
+        }
+        if (saved)
+        {
+            saved = transaction.commit();
+        }
+
+        if (!saved)
+        {
+            log_error("Background save failed for map: " + map_name);
+        }
+        return saved;
+    }
+} // namespace Tactics
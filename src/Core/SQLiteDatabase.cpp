@@ -0,0 +1,215 @@
+#include "Tactics/Core/SQLiteDatabase.hpp"
+#include "Tactics/Core/Logger.hpp"
+
+namespace Tactics
+{
+    namespace
+    {
+        // Another connection (e.g. the persistence worker) may hold the write lock briefly
+        constexpr int BUSY_TIMEOUT_MS = 5000;
+
+        // WAL lets readers run alongside the single writer; NORMAL only syncs at checkpoints,
+        // which is still durable against application crashes in WAL mode
+        constexpr const char *CONNECTION_PRAGMAS = "PRAGMA journal_mode = WAL;"
+                                                   "PRAGMA synchronous = NORMAL;"
+                                                   "PRAGMA mmap_size = 67108864;"
+                                                   "PRAGMA cache_size = -8192;";
+
+        auto savepoint_name(int depth) -> std::string
+        {
+            return "nested_" + std::to_string(depth);
+        }
+    } // namespace
+
+    SQLiteDatabase::SQLiteDatabase(const std::string &db_path) : m_path(db_path)
+    {
+        const int result = sqlite3_open(db_path.c_str(), &m_db);
+        if (result != SQLITE_OK)
+        {
+            log_error("Failed to open SQLite database: " + db_path + " - " + sqlite3_errmsg(m_db));
+            if (m_db != nullptr)
+            {
+                sqlite3_close(m_db);
+                m_db = nullptr;
+            }
+            return;
+        }
+
+        sqlite3_busy_timeout(m_db, BUSY_TIMEOUT_MS);
+        if (!execute(CONNECTION_PRAGMAS))
+        {
+            log_warning("Continuing with default SQLite connection settings");
+        }
+
+        m_statements = SQLiteStatementCache(m_db);
+    }
+
+    SQLiteDatabase::~SQLiteDatabase()
+    {
+        if (m_transaction_depth > 0)
+        {
+            log_warning("Closing database with an open transaction; rolling back");
+            execute("ROLLBACK");
+        }
+
+        m_statements.clear();
+        if (m_db != nullptr)
+        {
+            sqlite3_close(m_db);
+            m_db = nullptr;
+        }
+    }
+
+    auto SQLiteDatabase::is_open() const -> bool
+    {
+        return m_db != nullptr;
+    }
+
+    auto SQLiteDatabase::get_handle() const -> sqlite3 *
+    {
+        return m_db;
+    }
+
+    auto SQLiteDatabase::get_path() const -> const std::string &
+    {
+        return m_path;
+    }
+
+    auto SQLiteDatabase::get_error_message() const -> std::string
+    {
+        return m_db != nullptr ? sqlite3_errmsg(m_db) : "Database connection is null";
+    }
+
+    auto SQLiteDatabase::acquire(const std::string &sql) -> CachedStatement
+    {
+        return m_statements.acquire(sql);
+    }
+
+    auto SQLiteDatabase::execute(const std::string &sql) -> bool
+    {
+        if (m_db == nullptr)
+        {
+            return false;
+        }
+
+        char *error_message = nullptr;
+        const int result = sqlite3_exec(m_db, sql.c_str(), nullptr, nullptr, &error_message);
+        if (result != SQLITE_OK)
+        {
+            log_error("SQLite error: " +
+                      std::string(error_message != nullptr ? error_message : "Unknown error"));
+            sqlite3_free(error_message);
+            return false;
+        }
+
+        return true;
+    }
+
+    auto SQLiteDatabase::begin_transaction() -> bool
+    {
+        // IMMEDIATE takes the write lock up front, so a busy writer is waited out here rather
+        // than failing the first write
+        const std::string sql = m_transaction_depth == 0
+                                    ? std::string("BEGIN IMMEDIATE")
+                                    : "SAVEPOINT " + savepoint_name(m_transaction_depth);
+        if (!execute(sql))
+        {
+            return false;
+        }
+
+        ++m_transaction_depth;
+        return true;
+    }
+
+    auto SQLiteDatabase::commit_transaction() -> bool
+    {
+        if (m_transaction_depth == 0)
+        {
+            log_error("Commit without an open transaction");
+            return false;
+        }
+
+        --m_transaction_depth;
+        if (m_transaction_depth > 0)
+        {
+            return execute("RELEASE " + savepoint_name(m_transaction_depth));
+        }
+
+        if (!execute("COMMIT"))
+        {
+            execute("ROLLBACK");
+            return false;
+        }
+
+        ++m_commit_count;
+        return true;
+    }
+
+    void SQLiteDatabase::rollback_transaction()
+    {
+        if (m_transaction_depth == 0)
+        {
+            return;
+        }
+
+        --m_transaction_depth;
+        if (m_transaction_depth > 0)
+        {
+            const std::string name = savepoint_name(m_transaction_depth);
+            execute("ROLLBACK TO " + name + "; RELEASE " + name);
+            return;
+        }
+
+        execute("ROLLBACK");
+    }
+
+    auto SQLiteDatabase::get_transaction_depth() const -> int
+    {
+        return m_transaction_depth;
+    }
+
+    auto SQLiteDatabase::get_commit_count() const -> std::size_t
+    {
+        return m_commit_count;
+    }
+
+    auto SQLiteDatabase::get_statement_cache() const -> const SQLiteStatementCache &
+    {
+        return m_statements;
+    }
+
+    SQLiteTransaction::SQLiteTransaction(SQLiteDatabase &database)
+        : m_database(database), m_active(database.begin_transaction())
+    {
+    }
+
+    SQLiteTransaction::~SQLiteTransaction()
+    {
+        rollback();
+    }
+
+    auto SQLiteTransaction::is_active() const -> bool
+    {
+        return m_active;
+    }
+
+    auto SQLiteTransaction::commit() -> bool
+    {
+        if (!m_active)
+        {
+            return false;
+        }
+
+        m_active = false;
+        return m_database.commit_transaction();
+    }
+
+    void SQLiteTransaction::rollback()
+    {
+        if (m_active)
+        {
+            m_active = false;
+            m_database.rollback_transaction();
+        }
+    }
+} // namespace Tactics
@@ -1,69 +1,168 @@
 #include "Tactics/Core/SQLiteGridRepository.hpp"
 #include "Tactics/Components/Tile.hpp"
 #include "Tactics/Core/Logger.hpp"
+#include "Tactics/Core/TilePlaneCodec.hpp"
+#include <algorithm>
+#include <bit>
 #include <cstring>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
 
 namespace Tactics
 {
-    SQLiteGridRepository::SQLiteGridRepository(const std::string &db_path)
+    namespace
     {
-        const int result = sqlite3_open(db_path.c_str(), &m_db);
-        if (result != SQLITE_OK)
+        // Per-chunk blobs, one row per chunk, are written by encode_chunk_blob (chunk format
+        // version 2). Version 1 blobs, still read, hold both planes uncompressed:
+        //   [CHUNK_TILE_COUNT bytes] tile types, chunk-local row-major including padding
+        //   [CHUNK_TILE_COUNT bytes] move costs as int8, same order
+        constexpr int RAW_CHUNK_FORMAT_VERSION = 1;
+        constexpr size_t CHUNK_BLOB_SIZE = static_cast<size_t>(Grid::CHUNK_TILE_COUNT) * 2;
+
+        // Older whole-map blob layout (format version 1), one row per map:
+        //   [width * height bytes] tile types, row-major
+        //   [width * height bytes] move costs as int8, row-major
+        constexpr size_t TILE_BLOB_PLANE_COUNT = 2;
+
+        // FNV-1a over a chunk blob, used to find chunk content shared between versions
+        constexpr std::uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        constexpr std::uint64_t FNV_PRIME = 1099511628211ULL;
+
+        auto hash_blob(std::span<const std::uint8_t> blob) -> std::uint64_t
         {
-            log_error("Failed to open SQLite database: " + db_path + " - " + sqlite3_errmsg(m_db));
-            if (m_db != nullptr)
+            std::uint64_t hash = FNV_OFFSET_BASIS;
+            for (const std::uint8_t byte : blob)
             {
-                sqlite3_close(m_db);
-                m_db = nullptr;
+                hash = (hash ^ byte) * FNV_PRIME;
             }
-            return;
+            return hash;
         }
 
-        if (!initialize_schema())
+        auto chunks_for(int tiles) -> int
         {
-            log_error("Failed to initialize database schema");
-            if (m_db != nullptr)
+            return (std::max(tiles, 0) + Grid::CHUNK_SIZE - 1) / Grid::CHUNK_SIZE;
+        }
+
+        auto tile_blob_size(int width, int height) -> size_t
+        {
+            return static_cast<size_t>(width) * static_cast<size_t>(height) *
+                   TILE_BLOB_PLANE_COUNT;
+        }
+
+        auto is_valid_type_plane(std::span<const std::uint8_t> tile_types) -> bool
+        {
+            return tile_types.empty() ||
+                   std::ranges::max(tile_types) <= static_cast<std::uint8_t>(Tile::Type::Wall);
+        }
+
+        // False, with nothing copied, if a tile type is out of range
+        auto decode_raw_chunk(std::span<const std::uint8_t> blob, const GridChunk &chunk) -> bool
+        {
+            const auto tile_types = blob.first(Grid::CHUNK_TILE_COUNT);
+            if (!is_valid_type_plane(tile_types))
+            {
+                return false;
+            }
+
+            std::ranges::copy(tile_types, chunk.tile_types.begin());
+            std::ranges::transform(blob.subspan(Grid::CHUNK_TILE_COUNT), chunk.move_costs.begin(),
+                                   [](std::uint8_t cost) -> std::int8_t
+                                   { return static_cast<std::int8_t>(cost); });
+            return true;
+        }
+
+        auto decode_stored_chunk(int format_version, std::span<const std::uint8_t> blob,
+                                 const GridChunk &chunk) -> bool
+        {
+            if (format_version == RAW_CHUNK_FORMAT_VERSION)
+            {
+                return blob.size() == CHUNK_BLOB_SIZE && decode_raw_chunk(blob, chunk);
+            }
+
+            return format_version == SQLiteGridRepository::CHUNK_FORMAT_VERSION &&
+                   decode_chunk_blob(blob, chunk);
+        }
+
+        // Grid planes are chunk-major; the whole-map blob is row-major, so copy one chunk row at
+        // a time. False, with nothing copied, if a tile type is out of range
+        auto decode_tile_blob(std::span<const std::uint8_t> blob, Grid &grid) -> bool
+        {
+            const auto width = static_cast<size_t>(grid.get_width());
+            const size_t plane_size = width * static_cast<size_t>(grid.get_height());
+            if (!is_valid_type_plane(blob.first(plane_size)))
+            {
+                return false;
+            }
+
+            for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
             {
-                sqlite3_close(m_db);
-                m_db = nullptr;
+                for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+                {
+                    const GridChunk chunk = grid.get_chunk(chunk_x, chunk_y);
+                    const auto row_width = static_cast<size_t>(chunk.bounds.width);
+
+                    for (int local_y = 0; local_y < chunk.bounds.height; ++local_y)
+                    {
+                        const auto local_offset = static_cast<size_t>(local_y * Grid::CHUNK_SIZE);
+                        const size_t blob_offset =
+                            (static_cast<size_t>(chunk.bounds.y + local_y) * width) +
+                            static_cast<size_t>(chunk.bounds.x);
+
+                        std::ranges::copy(blob.subspan(blob_offset, row_width),
+                                          chunk.tile_types.begin() +
+                                              static_cast<std::ptrdiff_t>(local_offset));
+                        std::ranges::transform(blob.subspan(plane_size + blob_offset, row_width),
+                                               chunk.move_costs.begin() +
+                                                   static_cast<std::ptrdiff_t>(local_offset),
+                                               [](std::uint8_t cost) -> std::int8_t
+                                               { return static_cast<std::int8_t>(cost); });
+                    }
+
+                    grid.mark_chunk_changed(chunk_x, chunk_y);
+                }
             }
+            return true;
         }
+    } // namespace
+
+    SQLiteGridRepository::SQLiteGridRepository(const std::string &db_path)
+        : SQLiteGridRepository(std::make_shared<SQLiteDatabase>(db_path))
+    {
     }
 
-    SQLiteGridRepository::~SQLiteGridRepository()
+    SQLiteGridRepository::SQLiteGridRepository(std::shared_ptr<SQLiteDatabase> database)
+        : m_database(std::move(database))
     {
-        if (m_db != nullptr)
+        if (!is_open())
+        {
+            return;
+        }
+
+        if (!initialize_schema())
         {
-            sqlite3_close(m_db);
-            m_db = nullptr;
+            log_error("Failed to initialize database schema");
+            m_database.reset();
         }
     }
 
     SQLiteGridRepository::SQLiteGridRepository(SQLiteGridRepository &&other) noexcept
-        : m_db(other.m_db)
+        : m_database(std::move(other.m_database))
     {
-        other.m_db = nullptr;
     }
 
     auto SQLiteGridRepository::operator=(SQLiteGridRepository &&other) noexcept
         -> SQLiteGridRepository &
     {
-        if (this != &other)
-        {
-            if (m_db != nullptr)
-            {
-                sqlite3_close(m_db);
-            }
-            m_db = other.m_db;
-            other.m_db = nullptr;
-        }
+        m_database = std::move(other.m_database);
         return *this;
     }
 
     // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
     auto SQLiteGridRepository::initialize_schema() -> bool
     {
-        if (m_db == nullptr)
+        if (!is_open())
         {
             return false;
         }
@@ -80,12 +179,13 @@ namespace Tactics
             )
         )";
 
-        if (!execute_statement(create_maps_sql))
+        if (!m_database->execute(create_maps_sql))
         {
             return false;
         }
 
-        // Create tiles table
+        // Create legacy tiles table (one row per tile)
+        // Rows are only read to migrate older databases into map_chunks (see migrate_to_chunks)
         // Note: sprite_id and variant columns are reserved for future graphical assets
         // They are nullable to maintain backward compatibility
         const std::string create_tiles_sql = R"(
@@ -102,11 +202,96 @@ namespace Tactics
             )
         )";
 
-        if (!execute_statement(create_tiles_sql))
+        if (!m_database->execute(create_tiles_sql))
+        {
+            return false;
+        }
+
+        // Create older whole-map tile blob table (one row per map)
+        // Rows are only read to migrate older databases into map_chunks
+        const std::string create_tile_blobs_sql = R"(
+            CREATE TABLE IF NOT EXISTS map_tile_blobs (
+                map_id INTEGER PRIMARY KEY,
+                format_version INTEGER NOT NULL,
+                tile_data BLOB NOT NULL,
+                FOREIGN KEY (map_id) REFERENCES maps(id) ON DELETE CASCADE
+            )
+        )";
+
+        if (!m_database->execute(create_tile_blobs_sql))
+        {
+            return false;
+        }
+
+        // Create per-chunk tile blob table (one row per chunk, so saves can write only changes)
+        const std::string create_chunks_sql = R"(
+            CREATE TABLE IF NOT EXISTS map_chunks (
+                map_id INTEGER NOT NULL,
+                chunk_x INTEGER NOT NULL,
+                chunk_y INTEGER NOT NULL,
+                format_version INTEGER NOT NULL,
+                tile_data BLOB NOT NULL,
+                PRIMARY KEY (map_id, chunk_x, chunk_y),
+                FOREIGN KEY (map_id) REFERENCES maps(id) ON DELETE CASCADE
+            )
+        )";
+
+        if (!m_database->execute(create_chunks_sql))
         {
             return false;
         }
 
+        // Create version tables. Chunk contents are shared by every version that uses them; a
+        // version has a row per chunk it changed, and a chunk's content as of a version is the
+        // one in its latest row at or before that version
+        const std::string create_chunk_contents_sql = R"(
+            CREATE TABLE IF NOT EXISTS chunk_contents (
+                id INTEGER PRIMARY KEY AUTOINCREMENT,
+                content_hash INTEGER NOT NULL,
+                format_version INTEGER NOT NULL,
+                tile_data BLOB NOT NULL
+            )
+        )";
+
+        const std::string create_versions_sql = R"(
+            CREATE TABLE IF NOT EXISTS map_versions (
+                map_id INTEGER NOT NULL,
+                version INTEGER NOT NULL,
+                label TEXT NOT NULL DEFAULT '',
+                width INTEGER NOT NULL,
+                height INTEGER NOT NULL,
+                created_at TEXT NOT NULL DEFAULT (datetime('now')),
+                PRIMARY KEY (map_id, version),
+                FOREIGN KEY (map_id) REFERENCES maps(id) ON DELETE CASCADE
+            )
+        )";
+
+        const std::string create_version_chunks_sql = R"(
+            CREATE TABLE IF NOT EXISTS map_version_chunks (
+                map_id INTEGER NOT NULL,
+                chunk_x INTEGER NOT NULL,
+                chunk_y INTEGER NOT NULL,
+                version INTEGER NOT NULL,
+                content_id INTEGER NOT NULL,
+                PRIMARY KEY (map_id, chunk_x, chunk_y, version),
+                FOREIGN KEY (map_id) REFERENCES maps(id) ON DELETE CASCADE,
+                FOREIGN KEY (content_id) REFERENCES chunk_contents(id)
+            )
+        )";
+
+        const std::string create_content_index_sql = R"(
+            CREATE INDEX IF NOT EXISTS idx_chunk_contents_hash ON chunk_contents(content_hash)
+        )";
+
+        for (const std::string *sql : {&create_chunk_contents_sql, &create_versions_sql,
+                                       &create_version_chunks_sql, &create_content_index_sql})
+        {
+            if (!m_database->execute(*sql))
+            {
+                return false;
+            }
+        }
+
         // Create generator configs table
         const std::string create_configs_sql = R"(
             CREATE TABLE IF NOT EXISTS generator_configs (
@@ -124,7 +309,7 @@ namespace Tactics
             )
         )";
 
-        if (!execute_statement(create_configs_sql))
+        if (!m_database->execute(create_configs_sql))
         {
             return false;
         }
@@ -134,7 +319,7 @@ namespace Tactics
             CREATE INDEX IF NOT EXISTS idx_tiles_map_position ON tiles(map_id, x, y)
         )";
 
-        if (!execute_statement(create_index_sql))
+        if (!m_database->execute(create_index_sql))
         {
             return false;
         }
@@ -143,49 +328,30 @@ namespace Tactics
         return true;
     }
 
-    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
-    auto SQLiteGridRepository::execute_statement(const std::string &sql) -> bool
+    auto SQLiteGridRepository::is_open() const -> bool
     {
-        if (m_db == nullptr)
-        {
-            return false;
-        }
-
-        char *error_message = nullptr;
-        const int result = sqlite3_exec(m_db, sql.c_str(), nullptr, nullptr, &error_message);
-
-        if (result != SQLITE_OK)
-        {
-            log_error("SQLite error: " +
-                      std::string(error_message != nullptr ? error_message : "Unknown error"));
-            sqlite3_free(error_message);
-            return false;
-        }
-
-        return true;
+        return m_database != nullptr && m_database->is_open();
     }
 
     // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
     auto SQLiteGridRepository::get_map_id(const std::string &map_name) -> std::optional<int>
     {
-        if (m_db == nullptr)
+        if (!is_open())
         {
             return std::nullopt;
         }
 
-        const std::string sql = "SELECT id FROM maps WHERE name = ?";
-        sqlite3_stmt *stmt = nullptr;
-
-        if (sqlite3_prepare_v2(m_db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+        // Hot path (map_exists, every load and save), so the statement stays prepared
+        const CachedStatement cached = m_database->acquire("SELECT id FROM maps WHERE name = ?");
+        if (!cached)
         {
-            log_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(m_db)));
             return std::nullopt;
         }
+        sqlite3_stmt *stmt = cached.get();
 
         if (sqlite3_bind_text(stmt, 1, map_name.c_str(), -1, SQLITE_STATIC) != SQLITE_OK)
         {
-            log_error("Failed to bind parameter: " + std::string(sqlite3_errmsg(m_db)));
-            sqlite3_finalize(stmt);
+            log_error("Failed to bind parameter: " + m_database->get_error_message());
             return std::nullopt;
         }
 
@@ -198,10 +364,9 @@ namespace Tactics
         }
         else if (result != SQLITE_DONE)
         {
-            log_error("Failed to execute query: " + std::string(sqlite3_errmsg(m_db)));
+            log_error("Failed to execute query: " + m_database->get_error_message());
         }
 
-        sqlite3_finalize(stmt);
         return map_id;
     }
 
@@ -209,7 +374,7 @@ namespace Tactics
     auto SQLiteGridRepository::upsert_map_metadata(const std::string &map_name, Vector2i size)
         -> std::optional<int>
     {
-        if (m_db == nullptr)
+        if (!is_open())
         {
             return std::nullopt;
         }
@@ -223,14 +388,12 @@ namespace Tactics
             const std::string update_sql =
                 "UPDATE maps SET width = ?, height = ?, updated_at = datetime('now') "
                 "WHERE id = ?";
-            sqlite3_stmt *stmt = nullptr;
-
-            if (sqlite3_prepare_v2(m_db, update_sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+            const CachedStatement cached = m_database->acquire(update_sql);
+            if (!cached)
             {
-                log_error("Failed to prepare update statement: " +
-                          std::string(sqlite3_errmsg(m_db)));
                 return std::nullopt;
             }
+            sqlite3_stmt *stmt = cached.get();
 
             sqlite3_bind_int(stmt, 1, size.x);
             sqlite3_bind_int(stmt, 2, size.y);
@@ -238,24 +401,21 @@ namespace Tactics
 
             if (sqlite3_step(stmt) != SQLITE_DONE)
             {
-                log_error("Failed to update map metadata: " + std::string(sqlite3_errmsg(m_db)));
-                sqlite3_finalize(stmt);
+                log_error("Failed to update map metadata: " + m_database->get_error_message());
                 return std::nullopt;
             }
 
-            sqlite3_finalize(stmt);
             return existing_id;
         }
 
         // Insert new map
         const std::string insert_sql = "INSERT INTO maps (name, width, height) VALUES (?, ?, ?)";
-        sqlite3_stmt *stmt = nullptr;
-
-        if (sqlite3_prepare_v2(m_db, insert_sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+        const CachedStatement cached = m_database->acquire(insert_sql);
+        if (!cached)
         {
-            log_error("Failed to prepare insert statement: " + std::string(sqlite3_errmsg(m_db)));
             return std::nullopt;
         }
+        sqlite3_stmt *stmt = cached.get();
 
         sqlite3_bind_text(stmt, 1, map_name.c_str(), -1, SQLITE_STATIC);
         sqlite3_bind_int(stmt, 2, size.x);
@@ -263,20 +423,17 @@ namespace Tactics
 
         if (sqlite3_step(stmt) != SQLITE_DONE)
         {
-            log_error("Failed to insert map metadata: " + std::string(sqlite3_errmsg(m_db)));
-            sqlite3_finalize(stmt);
+            log_error("Failed to insert map metadata: " + m_database->get_error_message());
             return std::nullopt;
         }
 
-        const int new_id = static_cast<int>(sqlite3_last_insert_rowid(m_db));
-        sqlite3_finalize(stmt);
-        return new_id;
+        return static_cast<int>(sqlite3_last_insert_rowid(m_database->get_handle()));
     }
 
     // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
     auto SQLiteGridRepository::load_map(const std::string &map_name) -> std::optional<Grid>
     {
-        if (m_db == nullptr)
+        if (!is_open())
         {
             log_error("Database connection is null");
             return std::nullopt;
@@ -289,84 +446,53 @@ namespace Tactics
             return std::nullopt;
         }
 
-        // Load map metadata
-        const std::string metadata_sql = "SELECT width, height FROM maps WHERE id = ?";
-        sqlite3_stmt *metadata_stmt = nullptr;
-
-        if (sqlite3_prepare_v2(m_db, metadata_sql.c_str(), -1, &metadata_stmt, nullptr) !=
-            SQLITE_OK)
-        {
-            log_error("Failed to prepare metadata query: " + std::string(sqlite3_errmsg(m_db)));
-            return std::nullopt;
-        }
-
-        sqlite3_bind_int(metadata_stmt, 1, map_id.value());
-
-        int width = 0;
-        int height = 0;
-
-        if (sqlite3_step(metadata_stmt) == SQLITE_ROW)
-        {
-            width = sqlite3_column_int(metadata_stmt, 0);
-            height = sqlite3_column_int(metadata_stmt, 1);
-        }
-        else
+        const auto map_size = load_map_size(map_id.value());
+        if (!map_size.has_value())
         {
             log_error("Failed to load map metadata");
-            sqlite3_finalize(metadata_stmt);
             return std::nullopt;
         }
 
-        sqlite3_finalize(metadata_stmt);
-
         // Create grid with proper dimensions
         Grid grid;
-        grid.resize(width, height);
-
-        // Load tiles
-        const std::string tiles_sql =
-            "SELECT x, y, tile_type, move_cost FROM tiles WHERE map_id = ? ORDER BY y, x";
-        sqlite3_stmt *tiles_stmt = nullptr;
+        grid.resize(map_size->x, map_size->y);
 
-        if (sqlite3_prepare_v2(m_db, tiles_sql.c_str(), -1, &tiles_stmt, nullptr) != SQLITE_OK)
+        // Older databases hold a whole-map blob or per-tile rows; those are rewritten as chunks
+        BlobLoadResult load_result = load_chunks(map_id.value(), grid);
+        if (load_result == BlobLoadResult::Missing)
         {
-            log_error("Failed to prepare tiles query: " + std::string(sqlite3_errmsg(m_db)));
-            return std::nullopt;
-        }
+            load_result = load_tile_blob(map_id.value(), grid);
+            if (load_result == BlobLoadResult::Missing)
+            {
+                load_result = load_tile_rows(map_id.value(), grid) ? BlobLoadResult::Loaded
+                                                                   : BlobLoadResult::Corrupt;
+            }
 
-        sqlite3_bind_int(tiles_stmt, 1, map_id.value());
+            if (load_result == BlobLoadResult::Loaded && !migrate_to_chunks(map_id.value(), grid))
+            {
+                log_error("Failed to migrate tiles for map: " + map_name);
+                return std::nullopt;
+            }
+        }
 
-        while (sqlite3_step(tiles_stmt) == SQLITE_ROW)
+        if (load_result == BlobLoadResult::Corrupt)
         {
-            const int x_pos = sqlite3_column_int(tiles_stmt, 0);
-            const int y_pos = sqlite3_column_int(tiles_stmt, 1);
-            const int tile_type_int = sqlite3_column_int(tiles_stmt, 2);
-            const int move_cost = sqlite3_column_int(tiles_stmt, 3);
-
-            const auto tile_type = static_cast<Tile::Type>(tile_type_int);
-            const Vector2i position(x_pos, y_pos);
-            const Tile tile(position, tile_type, move_cost);
-
-            grid.set_tile(position, tile);
+            log_error("Corrupt tile data for map: " + map_name);
+            return std::nullopt;
         }
 
-        sqlite3_finalize(tiles_stmt);
+        // The grid now matches what is stored
+        grid.clear_dirty_chunks();
 
-        log_info("Loaded map: " + map_name + " (" + std::to_string(width) + "x" +
-                 std::to_string(height) + ")");
+        log_info("Loaded map: " + map_name + " (" + std::to_string(map_size->x) + "x" +
+                 std::to_string(map_size->y) + ")");
         return grid;
     }
 
     // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
     auto SQLiteGridRepository::save_map(const std::string &map_name, const Grid &grid) -> bool
     {
-        constexpr int STMT_MAP_ID = 1;
-        constexpr int STMT_X_POS = 2;
-        constexpr int STMT_Y_POS = 3;
-        constexpr int STMT_TILE_TYPE = 4;
-        constexpr int STMT_TILE_MOVE_COST = 5;
-
-        if (m_db == nullptr)
+        if (!is_open())
         {
             log_error("Database connection is null");
             return false;
@@ -376,6 +502,13 @@ namespace Tactics
         const int height = grid.get_height();
         const Vector2i map_size(width, height);
 
+        // Metadata and tiles are written in one transaction (a savepoint inside a unit of work)
+        SQLiteTransaction transaction(*m_database);
+        if (!transaction.is_active())
+        {
+            return false;
+        }
+
         // Upsert map metadata
         const auto map_id = upsert_map_metadata(map_name, map_size);
         if (!map_id.has_value())
@@ -384,189 +517,1040 @@ namespace Tactics
             return false;
         }
 
-        // Begin transaction for efficient bulk insert
-        if (!execute_statement("BEGIN TRANSACTION"))
+        if (!write_chunks(map_id.value(), grid, false) || !drop_legacy_tiles(map_id.value()) ||
+            !transaction.commit())
         {
             return false;
         }
 
-        // Delete existing tiles for this map
-        const std::string delete_sql = "DELETE FROM tiles WHERE map_id = ?";
-        sqlite3_stmt *delete_stmt = nullptr;
+        log_info("Saved map: " + map_name + " (" + std::to_string(width) + "x" +
+                 std::to_string(height) + ")");
+        return true;
+    }
 
-        if (sqlite3_prepare_v2(m_db, delete_sql.c_str(), -1, &delete_stmt, nullptr) != SQLITE_OK)
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::save_map_changes(const std::string &map_name, const Grid &grid)
+        -> bool
+    {
+        if (!is_open())
         {
-            log_error("Failed to prepare delete statement: " + std::string(sqlite3_errmsg(m_db)));
-            execute_statement("ROLLBACK");
+            log_error("Database connection is null");
             return false;
         }
 
-        sqlite3_bind_int(delete_stmt, 1, map_id.value());
+        if (!grid.has_dirty_chunks())
+        {
+            log_debug("No changes to save for map: " + map_name);
+            return true;
+        }
+
+        // A delta only applies on top of a complete chunk set of the same size
+        const Vector2i map_size(grid.get_width(), grid.get_height());
+        const auto map_id = get_map_id(map_name);
+        if (!map_id.has_value() || load_map_size(map_id.value()) != map_size ||
+            count_chunks(map_id.value()) != grid.get_chunk_count())
+        {
+            return save_map(map_name, grid);
+        }
 
-        if (sqlite3_step(delete_stmt) != SQLITE_DONE)
+        SQLiteTransaction transaction(*m_database);
+        if (!transaction.is_active() || !upsert_map_metadata(map_name, map_size).has_value() ||
+            !write_chunks(map_id.value(), grid, true) || !transaction.commit())
         {
-            log_error("Failed to delete existing tiles: " + std::string(sqlite3_errmsg(m_db)));
-            sqlite3_finalize(delete_stmt);
-            execute_statement("ROLLBACK");
             return false;
         }
 
-        sqlite3_finalize(delete_stmt);
+        log_info("Saved " + std::to_string(grid.get_dirty_chunk_count()) +
+                 " changed chunks of map: " + map_name);
+        return true;
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::load_map_size(int map_id) -> std::optional<Vector2i>
+    {
+        const CachedStatement stmt =
+            m_database->acquire("SELECT width, height FROM maps WHERE id = ?");
+        if (!stmt)
+        {
+            return std::nullopt;
+        }
 
-        // Insert all tiles
-        // Note: sprite_id and variant are set to NULL for now (reserved for future graphics)
-        const std::string insert_sql = "INSERT INTO tiles (map_id, x, y, tile_type, move_cost, "
-                                       "sprite_id, variant) VALUES (?, ?, ?, ?, ?, NULL, NULL)";
-        sqlite3_stmt *insert_stmt = nullptr;
+        sqlite3_bind_int(stmt.get(), 1, map_id);
 
-        if (sqlite3_prepare_v2(m_db, insert_sql.c_str(), -1, &insert_stmt, nullptr) != SQLITE_OK)
+        if (sqlite3_step(stmt.get()) != SQLITE_ROW)
         {
-            log_error("Failed to prepare insert statement: " + std::string(sqlite3_errmsg(m_db)));
-            execute_statement("ROLLBACK");
-            return false;
+            return std::nullopt;
         }
 
-        for (int y_pos = 0; y_pos < height; ++y_pos)
+        return Vector2i(sqlite3_column_int(stmt.get(), 0), sqlite3_column_int(stmt.get(), 1));
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::count_chunks(int map_id) -> int
+    {
+        const CachedStatement stmt =
+            m_database->acquire("SELECT COUNT(*) FROM map_chunks WHERE map_id = ?");
+        if (!stmt)
         {
-            for (int x_pos = 0; x_pos < width; ++x_pos)
-            {
-                const Vector2i position(x_pos, y_pos);
-                const Tile *tile = grid.get_tile(position);
+            return 0;
+        }
 
-                if (tile == nullptr)
-                {
-                    continue;
-                }
+        sqlite3_bind_int(stmt.get(), 1, map_id);
+        return sqlite3_step(stmt.get()) == SQLITE_ROW ? sqlite3_column_int(stmt.get(), 0) : 0;
+    }
 
-                sqlite3_reset(insert_stmt);
-                sqlite3_bind_int(insert_stmt, STMT_MAP_ID, map_id.value());
-                sqlite3_bind_int(insert_stmt, STMT_X_POS, x_pos);
-                sqlite3_bind_int(insert_stmt, STMT_Y_POS, y_pos);
-                sqlite3_bind_int(insert_stmt, STMT_TILE_TYPE, static_cast<int>(tile->get_type()));
-                sqlite3_bind_int(insert_stmt, STMT_TILE_MOVE_COST, tile->get_move_cost());
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::load_chunks(int map_id, Grid &grid) -> BlobLoadResult
+    {
+        const CachedStatement cached = m_database->acquire(
+            "SELECT chunk_x, chunk_y, format_version, tile_data FROM map_chunks WHERE map_id = ?");
+        if (!cached)
+        {
+            return BlobLoadResult::Corrupt;
+        }
+        sqlite3_stmt *stmt = cached.get();
 
-                if (sqlite3_step(insert_stmt) != SQLITE_DONE)
-                {
-                    log_error("Failed to insert tile: " + std::string(sqlite3_errmsg(m_db)));
-                    sqlite3_finalize(insert_stmt);
-                    execute_statement("ROLLBACK");
-                    return false;
-                }
+        sqlite3_bind_int(stmt, 1, map_id);
+
+        int loaded_count = 0;
+        int result = SQLITE_DONE;
+        while ((result = sqlite3_step(stmt)) == SQLITE_ROW)
+        {
+            const int chunk_x = sqlite3_column_int(stmt, 0);
+            const int chunk_y = sqlite3_column_int(stmt, 1);
+            const int format_version = sqlite3_column_int(stmt, 2);
+            const auto *data = static_cast<const std::uint8_t *>(sqlite3_column_blob(stmt, 3));
+            const auto size = static_cast<size_t>(sqlite3_column_bytes(stmt, 3));
+
+            if (chunk_x < 0 || chunk_x >= grid.get_chunks_x() || chunk_y < 0 ||
+                chunk_y >= grid.get_chunks_y())
+            {
+                log_error("Chunk outside the map: (" + std::to_string(chunk_x) + ", " +
+                          std::to_string(chunk_y) + ")");
+                return BlobLoadResult::Corrupt;
+            }
+
+            if (!decode_stored_chunk(format_version, std::span<const std::uint8_t>(data, size),
+                                     grid.get_chunk(chunk_x, chunk_y)))
+            {
+                log_error("Unreadable chunk (" + std::to_string(chunk_x) + ", " +
+                          std::to_string(chunk_y) + "), format version " +
+                          std::to_string(format_version));
+                return BlobLoadResult::Corrupt;
             }
+            grid.mark_chunk_changed(chunk_x, chunk_y);
+            ++loaded_count;
         }
 
-        sqlite3_finalize(insert_stmt);
+        if (result != SQLITE_DONE)
+        {
+            log_error("Failed to read map chunks: " + m_database->get_error_message());
+            return BlobLoadResult::Corrupt;
+        }
 
-        // Commit transaction
-        if (!execute_statement("COMMIT"))
+        if (loaded_count == 0)
         {
-            execute_statement("ROLLBACK");
-            return false;
+            return BlobLoadResult::Missing;
         }
 
-        log_info("Saved map: " + map_name + " (" + std::to_string(width) + "x" +
-                 std::to_string(height) + ")");
-        return true;
+        if (loaded_count != grid.get_chunk_count())
+        {
+            log_error("Map has " + std::to_string(loaded_count) + " of " +
+                      std::to_string(grid.get_chunk_count()) + " chunks");
+            return BlobLoadResult::Corrupt;
+        }
+
+        return BlobLoadResult::Loaded;
     }
 
     // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
-    auto SQLiteGridRepository::list_maps() -> std::vector<MapMetadata>
+    auto SQLiteGridRepository::load_tile_blob(int map_id, Grid &grid) -> BlobLoadResult
     {
-        constexpr int STMT_MAP_ID = 0;
-        constexpr int STMT_MAP_NAME = 1;
-        constexpr int STMT_MAP_WIDTH = 2;
-        constexpr int STMT_MAP_HEIGHT = 3;
-        constexpr int STMT_MAP_CREATED_AT = 4;
-        constexpr int STMT_MAP_UPDATED_AT = 5;
-
-        std::vector<MapMetadata> maps;
-
-        if (m_db == nullptr)
+        const std::string sql = "SELECT format_version, tile_data FROM map_tile_blobs "
+                                "WHERE map_id = ?";
+        const CachedStatement cached = m_database->acquire(sql);
+        if (!cached)
         {
-            return maps;
+            return BlobLoadResult::Corrupt;
         }
+        sqlite3_stmt *stmt = cached.get();
 
-        const std::string sql =
-            "SELECT id, name, width, height, created_at, updated_at FROM maps ORDER BY name";
-        sqlite3_stmt *stmt = nullptr;
+        sqlite3_bind_int(stmt, 1, map_id);
 
-        if (sqlite3_prepare_v2(m_db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+        const int result = sqlite3_step(stmt);
+        if (result == SQLITE_DONE)
         {
-            log_error("Failed to prepare list query: " + std::string(sqlite3_errmsg(m_db)));
-            return maps;
+            return BlobLoadResult::Missing;
         }
 
-        while (sqlite3_step(stmt) == SQLITE_ROW)
+        if (result != SQLITE_ROW)
         {
-            MapMetadata metadata;
+            log_error("Failed to read tile blob: " + m_database->get_error_message());
+            return BlobLoadResult::Corrupt;
+        }
 
-            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
-            metadata.id = sqlite3_column_int(stmt, STMT_MAP_ID);
-            metadata.name =
-                reinterpret_cast<const char *>(sqlite3_column_text(stmt, STMT_MAP_NAME));
-            metadata.width = sqlite3_column_int(stmt, STMT_MAP_WIDTH);
-            metadata.height = sqlite3_column_int(stmt, STMT_MAP_HEIGHT);
-            metadata.created_at =
-                reinterpret_cast<const char *>(sqlite3_column_text(stmt, STMT_MAP_CREATED_AT));
-            metadata.updated_at =
-                reinterpret_cast<const char *>(sqlite3_column_text(stmt, STMT_MAP_UPDATED_AT));
-            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+        const int format_version = sqlite3_column_int(stmt, 0);
+        const auto *data = static_cast<const std::uint8_t *>(sqlite3_column_blob(stmt, 1));
+        const auto size = static_cast<size_t>(sqlite3_column_bytes(stmt, 1));
+        const size_t expected_size = tile_blob_size(grid.get_width(), grid.get_height());
 
-            maps.push_back(metadata);
+        if (format_version != TILE_BLOB_FORMAT_VERSION)
+        {
+            log_error("Unsupported tile blob format version: " + std::to_string(format_version));
+            return BlobLoadResult::Corrupt;
         }
 
-        sqlite3_finalize(stmt);
-        return maps;
-    }
+        if (size != expected_size || (size > 0 && data == nullptr))
+        {
+            log_error("Tile blob size mismatch: expected " + std::to_string(expected_size) +
+                      " bytes, got " + std::to_string(size));
+            return BlobLoadResult::Corrupt;
+        }
 
-    auto SQLiteGridRepository::map_exists(const std::string &map_name) -> bool
-    {
-        return get_map_id(map_name).has_value();
+        return decode_tile_blob(std::span<const std::uint8_t>(data, size), grid)
+                   ? BlobLoadResult::Loaded
+                   : BlobLoadResult::Corrupt;
     }
 
     // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
-    auto SQLiteGridRepository::delete_map(const std::string &map_name) -> bool
+    auto SQLiteGridRepository::load_tile_rows(int map_id, Grid &grid) -> bool
     {
-        if (m_db == nullptr)
+        const CachedStatement tiles_stmt = m_database->acquire(
+            "SELECT x, y, tile_type, move_cost FROM tiles WHERE map_id = ? ORDER BY y, x");
+        if (!tiles_stmt)
         {
             return false;
         }
 
-        const auto map_id = get_map_id(map_name);
-        if (!map_id.has_value())
+        sqlite3_bind_int(tiles_stmt.get(), 1, map_id);
+
+        // Every row has to be read: the grid is migrated to chunks and the rows deleted after
+        int result = SQLITE_ROW;
+        while ((result = sqlite3_step(tiles_stmt.get())) == SQLITE_ROW)
         {
-            log_error("Map not found: " + map_name);
-            return false;
+            const int x_pos = sqlite3_column_int(tiles_stmt.get(), 0);
+            const int y_pos = sqlite3_column_int(tiles_stmt.get(), 1);
+            const int tile_type_int = sqlite3_column_int(tiles_stmt.get(), 2);
+            const int move_cost = sqlite3_column_int(tiles_stmt.get(), 3);
+
+            if (tile_type_int < 0 || tile_type_int > static_cast<int>(Tile::Type::Wall))
+            {
+                log_error("Invalid tile type " + std::to_string(tile_type_int) + " at (" +
+                          std::to_string(x_pos) + ", " + std::to_string(y_pos) + ")");
+                return false;
+            }
+
+            const auto tile_type = static_cast<Tile::Type>(tile_type_int);
+            const Vector2i position(x_pos, y_pos);
+            const Tile tile(position, tile_type, move_cost);
+
+            grid.set_tile(position, tile);
         }
 
-        // Delete map (cascade will delete tiles)
-        const std::string delete_sql = "DELETE FROM maps WHERE id = ?";
-        sqlite3_stmt *stmt = nullptr;
+        if (result != SQLITE_DONE)
+        {
+            log_error("Failed to read tiles: " + m_database->get_error_message());
+            return false;
+        }
+        return true;
+    }
 
-        if (sqlite3_prepare_v2(m_db, delete_sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::migrate_to_chunks(int map_id, const Grid &grid) -> bool
+    {
+        SQLiteTransaction transaction(*m_database);
+        if (!transaction.is_active() || !write_chunks(map_id, grid, false) ||
+            !drop_legacy_tiles(map_id) || !transaction.commit())
         {
-            log_error("Failed to prepare delete statement: " + std::string(sqlite3_errmsg(m_db)));
             return false;
         }
 
-        sqlite3_bind_int(stmt, 1, map_id.value());
+        log_info("Migrated tiles to chunk blobs for map id " + std::to_string(map_id));
+        return true;
+    }
 
-        bool success = false;
-        success = sqlite3_step(stmt) == SQLITE_DONE;
-        if (!success)
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::write_chunks(int map_id, const Grid &grid, bool dirty_only) -> bool
+    {
+        // A full write replaces the chunk set, which also drops chunks outside a shrunk map
+        if (!dirty_only)
         {
-            log_error("Failed to delete map: " + std::string(sqlite3_errmsg(m_db)));
-        }
+            const CachedStatement delete_stmt =
+                m_database->acquire("DELETE FROM map_chunks WHERE map_id = ?");
+            if (!delete_stmt)
+            {
+                return false;
+            }
 
-        sqlite3_finalize(stmt);
-        return success;
+            sqlite3_bind_int(delete_stmt.get(), 1, map_id);
+
+            if (sqlite3_step(delete_stmt.get()) != SQLITE_DONE)
+            {
+                log_error("Failed to delete map chunks: " + m_database->get_error_message());
+                return false;
+            }
+        }
+
+        const std::string upsert_sql = R"(
+            INSERT INTO map_chunks (map_id, chunk_x, chunk_y, format_version, tile_data)
+            VALUES (?, ?, ?, ?, ?)
+            ON CONFLICT(map_id, chunk_x, chunk_y) DO UPDATE SET
+                format_version = excluded.format_version,
+                tile_data = excluded.tile_data
+        )";
+        const CachedStatement cached = m_database->acquire(upsert_sql);
+        if (!cached)
+        {
+            return false;
+        }
+        sqlite3_stmt *upsert_stmt = cached.get();
+
+        constexpr int STMT_MAP_ID = 1;
+        constexpr int STMT_CHUNK_X = 2;
+        constexpr int STMT_CHUNK_Y = 3;
+        constexpr int STMT_FORMAT_VERSION = 4;
+        constexpr int STMT_TILE_DATA = 5;
+
+        std::vector<std::uint8_t> blob;
+        blob.reserve(CHUNK_BLOB_SIZE);
+        for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+        {
+            for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+            {
+                if (dirty_only && !grid.is_chunk_dirty(chunk_x, chunk_y))
+                {
+                    continue;
+                }
+
+                blob.clear();
+                encode_chunk_blob(grid.get_chunk(chunk_x, chunk_y), blob);
+
+                sqlite3_reset(upsert_stmt);
+                sqlite3_bind_int(upsert_stmt, STMT_MAP_ID, map_id);
+                sqlite3_bind_int(upsert_stmt, STMT_CHUNK_X, chunk_x);
+                sqlite3_bind_int(upsert_stmt, STMT_CHUNK_Y, chunk_y);
+                sqlite3_bind_int(upsert_stmt, STMT_FORMAT_VERSION, CHUNK_FORMAT_VERSION);
+                sqlite3_bind_blob64(upsert_stmt, STMT_TILE_DATA, blob.data(), blob.size(),
+                                    SQLITE_STATIC);
+
+                if (sqlite3_step(upsert_stmt) != SQLITE_DONE)
+                {
+                    log_error("Failed to write map chunk: " + m_database->get_error_message());
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::drop_legacy_tiles(int map_id) -> bool
+    {
+        for (const char *sql :
+             {"DELETE FROM map_tile_blobs WHERE map_id = ?", "DELETE FROM tiles WHERE map_id = ?"})
+        {
+            const CachedStatement stmt = m_database->acquire(sql);
+            if (!stmt)
+            {
+                return false;
+            }
+
+            sqlite3_bind_int(stmt.get(), 1, map_id);
+
+            if (sqlite3_step(stmt.get()) != SQLITE_DONE)
+            {
+                log_error("Failed to delete legacy tiles: " + m_database->get_error_message());
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::get_map_size(const std::string &map_name)
+        -> std::optional<Vector2i>
+    {
+        if (!is_open())
+        {
+            return std::nullopt;
+        }
+
+        const CachedStatement stmt =
+            m_database->acquire("SELECT width, height FROM maps WHERE name = ?");
+        if (!stmt)
+        {
+            return std::nullopt;
+        }
+
+        sqlite3_bind_text(stmt.get(), 1, map_name.c_str(), -1, SQLITE_STATIC);
+
+        if (sqlite3_step(stmt.get()) != SQLITE_ROW)
+        {
+            return std::nullopt;
+        }
+
+        return Vector2i(sqlite3_column_int(stmt.get(), 0), sqlite3_column_int(stmt.get(), 1));
+    }
+
+    // Maps saved before chunked storage have no chunk rows until load_map has migrated them
+    auto SQLiteGridRepository::load_chunk(const std::string &map_name, const GridChunk &chunk)
+        -> bool
+    {
+        if (!is_open())
+        {
+            return false;
+        }
+
+        const CachedStatement cached = m_database->acquire(R"(
+            SELECT c.format_version, c.tile_data
+            FROM map_chunks c
+            JOIN maps m ON m.id = c.map_id
+            WHERE m.name = ? AND c.chunk_x = ? AND c.chunk_y = ?
+        )");
+        if (!cached)
+        {
+            return false;
+        }
+        sqlite3_stmt *stmt = cached.get();
+
+        sqlite3_bind_text(stmt, 1, map_name.c_str(), -1, SQLITE_STATIC);
+        sqlite3_bind_int(stmt, 2, chunk.coord.x);
+        sqlite3_bind_int(stmt, 3, chunk.coord.y);
+
+        if (sqlite3_step(stmt) != SQLITE_ROW)
+        {
+            return false;
+        }
+
+        const int format_version = sqlite3_column_int(stmt, 0);
+        const auto *data = static_cast<const std::uint8_t *>(sqlite3_column_blob(stmt, 1));
+        const auto size = static_cast<size_t>(sqlite3_column_bytes(stmt, 1));
+        if (!decode_stored_chunk(format_version, std::span<const std::uint8_t>(data, size), chunk))
+        {
+            log_error("Unreadable chunk (" + std::to_string(chunk.coord.x) + ", " +
+                      std::to_string(chunk.coord.y) + ") in map: " + map_name);
+            return false;
+        }
+        return true;
+    }
+
+    auto SQLiteGridRepository::list_maps() -> std::vector<MapMetadata>
+    {
+        constexpr int STMT_MAP_ID = 0;
+        constexpr int STMT_MAP_NAME = 1;
+        constexpr int STMT_MAP_WIDTH = 2;
+        constexpr int STMT_MAP_HEIGHT = 3;
+        constexpr int STMT_MAP_CREATED_AT = 4;
+        constexpr int STMT_MAP_UPDATED_AT = 5;
+
+        std::vector<MapMetadata> maps;
+
+        if (!is_open())
+        {
+            return maps;
+        }
+
+        const std::string sql =
+            "SELECT id, name, width, height, created_at, updated_at FROM maps ORDER BY name";
+        const CachedStatement cached = m_database->acquire(sql);
+        if (!cached)
+        {
+            return maps;
+        }
+        sqlite3_stmt *stmt = cached.get();
+
+        while (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            MapMetadata metadata;
+
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            metadata.id = sqlite3_column_int(stmt, STMT_MAP_ID);
+            metadata.name =
+                reinterpret_cast<const char *>(sqlite3_column_text(stmt, STMT_MAP_NAME));
+            metadata.width = sqlite3_column_int(stmt, STMT_MAP_WIDTH);
+            metadata.height = sqlite3_column_int(stmt, STMT_MAP_HEIGHT);
+            metadata.created_at =
+                reinterpret_cast<const char *>(sqlite3_column_text(stmt, STMT_MAP_CREATED_AT));
+            metadata.updated_at =
+                reinterpret_cast<const char *>(sqlite3_column_text(stmt, STMT_MAP_UPDATED_AT));
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+            maps.push_back(metadata);
+        }
+
+        return maps;
+    }
+
+    auto SQLiteGridRepository::map_exists(const std::string &map_name) -> bool
+    {
+        return get_map_id(map_name).has_value();
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::delete_map(const std::string &map_name) -> bool
+    {
+        if (!is_open())
+        {
+            return false;
+        }
+
+        const auto map_id = get_map_id(map_name);
+        if (!map_id.has_value())
+        {
+            log_error("Map not found: " + map_name);
+            return false;
+        }
+
+        // Foreign keys are not enforced on this connection, so every table that refers to the
+        // map is cleared explicitly
+        SQLiteTransaction transaction(*m_database);
+        if (!transaction.is_active() || !drop_legacy_tiles(map_id.value()) ||
+            !drop_versions(map_id.value()))
+        {
+            return false;
+        }
+
+        const CachedStatement chunks_stmt =
+            m_database->acquire("DELETE FROM map_chunks WHERE map_id = ?");
+        if (!chunks_stmt)
+        {
+            return false;
+        }
+
+        sqlite3_bind_int(chunks_stmt.get(), 1, map_id.value());
+
+        if (sqlite3_step(chunks_stmt.get()) != SQLITE_DONE)
+        {
+            log_error("Failed to delete map chunks: " + m_database->get_error_message());
+            return false;
+        }
+
+        // Generator configs are keyed by name rather than map id
+        const CachedStatement config_stmt =
+            m_database->acquire("DELETE FROM generator_configs WHERE map_name = ?");
+        if (!config_stmt)
+        {
+            return false;
+        }
+
+        sqlite3_bind_text(config_stmt.get(), 1, map_name.c_str(), -1, SQLITE_STATIC);
+
+        if (sqlite3_step(config_stmt.get()) != SQLITE_DONE)
+        {
+            log_error("Failed to delete generator config: " + m_database->get_error_message());
+            return false;
+        }
+
+        const CachedStatement stmt = m_database->acquire("DELETE FROM maps WHERE id = ?");
+        if (!stmt)
+        {
+            return false;
+        }
+
+        sqlite3_bind_int(stmt.get(), 1, map_id.value());
+
+        if (sqlite3_step(stmt.get()) != SQLITE_DONE)
+        {
+            log_error("Failed to delete map: " + m_database->get_error_message());
+            return false;
+        }
+
+        return transaction.commit();
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::create_version(const std::string &map_name, const Grid &grid,
+                                              const std::string &label) -> std::optional<int>
+    {
+        if (!is_open())
+        {
+            log_error("Database connection is null");
+            return std::nullopt;
+        }
+
+        const auto map_id = get_map_id(map_name);
+        if (!map_id.has_value())
+        {
+            log_error("Map not found: " + map_name);
+            return std::nullopt;
+        }
+
+        SQLiteTransaction transaction(*m_database);
+        if (!transaction.is_active())
+        {
+            return std::nullopt;
+        }
+
+        int previous_version = 0;
+        {
+            const CachedStatement stmt =
+                m_database->acquire("SELECT MAX(version) FROM map_versions WHERE map_id = ?");
+            if (!stmt)
+            {
+                return std::nullopt;
+            }
+
+            sqlite3_bind_int(stmt.get(), 1, map_id.value());
+
+            if (sqlite3_step(stmt.get()) == SQLITE_ROW)
+            {
+                previous_version = sqlite3_column_int(stmt.get(), 0);
+            }
+        }
+        const int version = previous_version + 1;
+
+        // After a resize every chunk is recorded, so no older chunk shows through
+        const Vector2i size(grid.get_width(), grid.get_height());
+        std::vector<std::int64_t> previous_manifest;
+        if (previous_version > 0 && load_version_size(map_id.value(), previous_version) == size)
+        {
+            auto manifest = load_version_manifest(map_id.value(), previous_version, size);
+            if (!manifest.has_value())
+            {
+                return std::nullopt;
+            }
+            previous_manifest = std::move(manifest.value());
+        }
+
+        {
+            const CachedStatement stmt = m_database->acquire(
+                "INSERT INTO map_versions (map_id, version, label, width, height) "
+                "VALUES (?, ?, ?, ?, ?)");
+            if (!stmt)
+            {
+                return std::nullopt;
+            }
+
+            constexpr int STMT_LABEL = 3;
+            constexpr int STMT_WIDTH = 4;
+            constexpr int STMT_HEIGHT = 5;
+            sqlite3_bind_int(stmt.get(), 1, map_id.value());
+            sqlite3_bind_int(stmt.get(), 2, version);
+            sqlite3_bind_text(stmt.get(), STMT_LABEL, label.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int(stmt.get(), STMT_WIDTH, size.x);
+            sqlite3_bind_int(stmt.get(), STMT_HEIGHT, size.y);
+
+            if (sqlite3_step(stmt.get()) != SQLITE_DONE)
+            {
+                log_error("Failed to create map version: " + m_database->get_error_message());
+                return std::nullopt;
+            }
+        }
+
+        const CachedStatement cached = m_database->acquire(
+            "INSERT INTO map_version_chunks (map_id, chunk_x, chunk_y, version, content_id) "
+            "VALUES (?, ?, ?, ?, ?)");
+        if (!cached)
+        {
+            return std::nullopt;
+        }
+        sqlite3_stmt *chunk_stmt = cached.get();
+
+        constexpr int STMT_MAP_ID = 1;
+        constexpr int STMT_CHUNK_X = 2;
+        constexpr int STMT_CHUNK_Y = 3;
+        constexpr int STMT_VERSION = 4;
+        constexpr int STMT_CONTENT_ID = 5;
+
+        int stored_count = 0;
+        std::vector<std::uint8_t> blob;
+        blob.reserve(CHUNK_BLOB_SIZE);
+        for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+        {
+            for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+            {
+                // Every chunk is hashed: dirty bits track changes since the last save, not the
+                // last version, so they cannot tell which chunks match the previous manifest
+                blob.clear();
+                encode_chunk_blob(grid.get_chunk(chunk_x, chunk_y), blob);
+
+                const auto content_id = find_or_insert_content(blob);
+                if (!content_id.has_value())
+                {
+                    return std::nullopt;
+                }
+
+                const auto index = static_cast<size_t>((chunk_y * grid.get_chunks_x()) + chunk_x);
+                if (!previous_manifest.empty() && previous_manifest[index] == content_id.value())
+                {
+                    continue;
+                }
+
+                sqlite3_reset(chunk_stmt);
+                sqlite3_bind_int(chunk_stmt, STMT_MAP_ID, map_id.value());
+                sqlite3_bind_int(chunk_stmt, STMT_CHUNK_X, chunk_x);
+                sqlite3_bind_int(chunk_stmt, STMT_CHUNK_Y, chunk_y);
+                sqlite3_bind_int(chunk_stmt, STMT_VERSION, version);
+                sqlite3_bind_int64(chunk_stmt, STMT_CONTENT_ID, content_id.value());
+
+                if (sqlite3_step(chunk_stmt) != SQLITE_DONE)
+                {
+                    log_error("Failed to write version chunk: " +
+                              m_database->get_error_message());
+                    return std::nullopt;
+                }
+                ++stored_count;
+            }
+        }
+
+        if (!transaction.commit())
+        {
+            return std::nullopt;
+        }
+
+        log_info("Created version " + std::to_string(version) + " of map: " + map_name + " (" +
+                 std::to_string(stored_count) + " chunks stored)");
+        return version;
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::list_versions(const std::string &map_name)
+        -> std::vector<MapVersion>
+    {
+        constexpr int STMT_VERSION = 0;
+        constexpr int STMT_LABEL = 1;
+        constexpr int STMT_WIDTH = 2;
+        constexpr int STMT_HEIGHT = 3;
+        constexpr int STMT_CREATED_AT = 4;
+        constexpr int STMT_STORED_CHUNKS = 5;
+
+        std::vector<MapVersion> versions;
+
+        const auto map_id = get_map_id(map_name);
+        if (!map_id.has_value())
+        {
+            return versions;
+        }
+
+        const std::string sql = R"(
+            SELECT v.version, v.label, v.width, v.height, v.created_at,
+                (SELECT COUNT(*) FROM map_version_chunks c
+                 WHERE c.map_id = v.map_id AND c.version = v.version)
+            FROM map_versions v WHERE v.map_id = ? ORDER BY v.version
+        )";
+        const CachedStatement cached = m_database->acquire(sql);
+        if (!cached)
+        {
+            return versions;
+        }
+        sqlite3_stmt *stmt = cached.get();
+
+        sqlite3_bind_int(stmt, 1, map_id.value());
+
+        while (sqlite3_step(stmt) == SQLITE_ROW)
+        {
+            MapVersion version;
+
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            version.version = sqlite3_column_int(stmt, STMT_VERSION);
+            version.label = reinterpret_cast<const char *>(sqlite3_column_text(stmt, STMT_LABEL));
+            version.width = sqlite3_column_int(stmt, STMT_WIDTH);
+            version.height = sqlite3_column_int(stmt, STMT_HEIGHT);
+            version.created_at =
+                reinterpret_cast<const char *>(sqlite3_column_text(stmt, STMT_CREATED_AT));
+            version.stored_chunk_count = sqlite3_column_int(stmt, STMT_STORED_CHUNKS);
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+            versions.push_back(version);
+        }
+
+        return versions;
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::load_version(const std::string &map_name, int version)
+        -> std::optional<Grid>
+    {
+        const auto map_id = get_map_id(map_name);
+        if (!map_id.has_value())
+        {
+            log_error("Map not found: " + map_name);
+            return std::nullopt;
+        }
+
+        const auto size = load_version_size(map_id.value(), version);
+        if (!size.has_value())
+        {
+            log_error("Version " + std::to_string(version) + " of map not found: " + map_name);
+            return std::nullopt;
+        }
+
+        const auto manifest = load_version_manifest(map_id.value(), version, size.value());
+        if (!manifest.has_value())
+        {
+            return std::nullopt;
+        }
+
+        const CachedStatement cached = m_database->acquire(
+            "SELECT format_version, tile_data FROM chunk_contents WHERE id = ?");
+        if (!cached)
+        {
+            return std::nullopt;
+        }
+        sqlite3_stmt *stmt = cached.get();
+
+        Grid grid;
+        grid.resize(size->x, size->y);
+        for (int chunk_y = 0; chunk_y < grid.get_chunks_y(); ++chunk_y)
+        {
+            for (int chunk_x = 0; chunk_x < grid.get_chunks_x(); ++chunk_x)
+            {
+                const auto index = static_cast<size_t>((chunk_y * grid.get_chunks_x()) + chunk_x);
+
+                sqlite3_reset(stmt);
+                sqlite3_bind_int64(stmt, 1, manifest.value()[index]);
+
+                if (sqlite3_step(stmt) != SQLITE_ROW)
+                {
+                    log_error("Missing chunk (" + std::to_string(chunk_x) + ", " +
+                              std::to_string(chunk_y) + ") in version " +
+                              std::to_string(version) + " of map: " + map_name);
+                    return std::nullopt;
+                }
+
+                const int format_version = sqlite3_column_int(stmt, 0);
+                const auto *data = static_cast<const std::uint8_t *>(sqlite3_column_blob(stmt, 1));
+                const auto data_size = static_cast<size_t>(sqlite3_column_bytes(stmt, 1));
+                if (!decode_stored_chunk(format_version,
+                                         std::span<const std::uint8_t>(data, data_size),
+                                         grid.get_chunk(chunk_x, chunk_y)))
+                {
+                    log_error("Corrupt chunk content in version " + std::to_string(version) +
+                              " of map: " + map_name);
+                    return std::nullopt;
+                }
+                grid.mark_chunk_changed(chunk_x, chunk_y);
+            }
+        }
+
+        log_info("Loaded version " + std::to_string(version) + " of map: " + map_name);
+        return grid;
+    }
+
+    auto SQLiteGridRepository::diff_versions(const std::string &map_name, int from_version,
+                                             int to_version) -> std::optional<MapVersionDiff>
+    {
+        const auto map_id = get_map_id(map_name);
+        if (!map_id.has_value())
+        {
+            log_error("Map not found: " + map_name);
+            return std::nullopt;
+        }
+
+        const auto from_size = load_version_size(map_id.value(), from_version);
+        const auto to_size = load_version_size(map_id.value(), to_version);
+        if (!from_size.has_value() || !to_size.has_value())
+        {
+            log_error("Version not found for map: " + map_name);
+            return std::nullopt;
+        }
+
+        const auto from_manifest =
+            load_version_manifest(map_id.value(), from_version, from_size.value());
+        const auto to_manifest = load_version_manifest(map_id.value(), to_version, to_size.value());
+        if (!from_manifest.has_value() || !to_manifest.has_value())
+        {
+            return std::nullopt;
+        }
+
+        // Chunks present in only one of the versions count as changed
+        const auto content_at = [](const std::vector<std::int64_t> &manifest, Vector2i size,
+                                   int chunk_x, int chunk_y) -> std::int64_t
+        {
+            const int chunks_x = chunks_for(size.x);
+            if (chunk_x >= chunks_x || chunk_y >= chunks_for(size.y))
+            {
+                return 0;
+            }
+            return manifest[static_cast<size_t>((chunk_y * chunks_x) + chunk_x)];
+        };
+
+        MapVersionDiff diff{.from_size = from_size.value(), .to_size = to_size.value(),
+                            .changed_chunks = {}};
+        const int chunks_x = std::max(chunks_for(from_size->x), chunks_for(to_size->x));
+        const int chunks_y = std::max(chunks_for(from_size->y), chunks_for(to_size->y));
+        for (int chunk_y = 0; chunk_y < chunks_y; ++chunk_y)
+        {
+            for (int chunk_x = 0; chunk_x < chunks_x; ++chunk_x)
+            {
+                if (content_at(from_manifest.value(), diff.from_size, chunk_x, chunk_y) !=
+                    content_at(to_manifest.value(), diff.to_size, chunk_x, chunk_y))
+                {
+                    diff.changed_chunks.emplace_back(chunk_x, chunk_y);
+                }
+            }
+        }
+
+        return diff;
+    }
+
+    auto SQLiteGridRepository::restore_version(const std::string &map_name, int version) -> bool
+    {
+        const auto grid = load_version(map_name, version);
+        return grid.has_value() && save_map(map_name, grid.value());
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::load_version_size(int map_id, int version)
+        -> std::optional<Vector2i>
+    {
+        const CachedStatement stmt = m_database->acquire(
+            "SELECT width, height FROM map_versions WHERE map_id = ? AND version = ?");
+        if (!stmt)
+        {
+            return std::nullopt;
+        }
+
+        sqlite3_bind_int(stmt.get(), 1, map_id);
+        sqlite3_bind_int(stmt.get(), 2, version);
+
+        if (sqlite3_step(stmt.get()) != SQLITE_ROW)
+        {
+            return std::nullopt;
+        }
+
+        return Vector2i(sqlite3_column_int(stmt.get(), 0), sqlite3_column_int(stmt.get(), 1));
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::load_version_manifest(int map_id, int version, Vector2i size)
+        -> std::optional<std::vector<std::int64_t>>
+    {
+        // SQLite takes the bare content_id from the row that holds MAX(version)
+        const std::string sql = R"(
+            SELECT chunk_x, chunk_y, content_id, MAX(version) FROM map_version_chunks
+            WHERE map_id = ? AND version <= ? GROUP BY chunk_x, chunk_y
+        )";
+        const CachedStatement cached = m_database->acquire(sql);
+        if (!cached)
+        {
+            return std::nullopt;
+        }
+        sqlite3_stmt *stmt = cached.get();
+
+        sqlite3_bind_int(stmt, 1, map_id);
+        sqlite3_bind_int(stmt, 2, version);
+
+        // Rows outside the version's size belong to an older, larger map and are skipped
+        const int chunks_x = chunks_for(size.x);
+        const int chunks_y = chunks_for(size.y);
+        std::vector<std::int64_t> manifest(static_cast<size_t>(chunks_x) *
+                                           static_cast<size_t>(chunks_y));
+
+        int result = SQLITE_DONE;
+        while ((result = sqlite3_step(stmt)) == SQLITE_ROW)
+        {
+            const int chunk_x = sqlite3_column_int(stmt, 0);
+            const int chunk_y = sqlite3_column_int(stmt, 1);
+            if (chunk_x >= 0 && chunk_x < chunks_x && chunk_y >= 0 && chunk_y < chunks_y)
+            {
+                manifest[static_cast<size_t>((chunk_y * chunks_x) + chunk_x)] =
+                    sqlite3_column_int64(stmt, 2);
+            }
+        }
+
+        if (result != SQLITE_DONE)
+        {
+            log_error("Failed to read version chunks: " + m_database->get_error_message());
+            return std::nullopt;
+        }
+
+        return manifest;
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::find_or_insert_content(std::span<const std::uint8_t> blob)
+        -> std::optional<std::int64_t>
+    {
+        const auto hash = std::bit_cast<sqlite3_int64>(hash_blob(blob));
+
+        // Equal hashes are confirmed byte for byte, so a collision only costs a comparison
+        {
+            const CachedStatement cached = m_database->acquire(
+                "SELECT id, tile_data FROM chunk_contents "
+                "WHERE content_hash = ? AND format_version = ?");
+            if (!cached)
+            {
+                return std::nullopt;
+            }
+            sqlite3_stmt *stmt = cached.get();
+
+            sqlite3_bind_int64(stmt, 1, hash);
+            sqlite3_bind_int(stmt, 2, CHUNK_FORMAT_VERSION);
+
+            int result = SQLITE_DONE;
+            while ((result = sqlite3_step(stmt)) == SQLITE_ROW)
+            {
+                const auto *data = static_cast<const std::uint8_t *>(sqlite3_column_blob(stmt, 1));
+                const auto size = static_cast<size_t>(sqlite3_column_bytes(stmt, 1));
+                if (std::ranges::equal(std::span<const std::uint8_t>(data, size), blob))
+                {
+                    return sqlite3_column_int64(stmt, 0);
+                }
+            }
+
+            if (result != SQLITE_DONE)
+            {
+                log_error("Failed to read chunk contents: " + m_database->get_error_message());
+                return std::nullopt;
+            }
+        }
+
+        const CachedStatement stmt =
+            m_database->acquire("INSERT INTO chunk_contents (content_hash, format_version, "
+                                "tile_data) VALUES (?, ?, ?)");
+        if (!stmt)
+        {
+            return std::nullopt;
+        }
+
+        constexpr int STMT_TILE_DATA = 3;
+        sqlite3_bind_int64(stmt.get(), 1, hash);
+        sqlite3_bind_int(stmt.get(), 2, CHUNK_FORMAT_VERSION);
+        sqlite3_bind_blob64(stmt.get(), STMT_TILE_DATA, blob.data(), blob.size(), SQLITE_STATIC);
+
+        if (sqlite3_step(stmt.get()) != SQLITE_DONE)
+        {
+            log_error("Failed to write chunk content: " + m_database->get_error_message());
+            return std::nullopt;
+        }
+
+        return sqlite3_last_insert_rowid(m_database->get_handle());
+    }
+
+    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
+    auto SQLiteGridRepository::drop_versions(int map_id) -> bool
+    {
+        for (const char *sql : {"DELETE FROM map_version_chunks WHERE map_id = ?",
+                                "DELETE FROM map_versions WHERE map_id = ?"})
+        {
+            const CachedStatement stmt = m_database->acquire(sql);
+            if (!stmt)
+            {
+                return false;
+            }
+
+            sqlite3_bind_int(stmt.get(), 1, map_id);
+
+            if (sqlite3_step(stmt.get()) != SQLITE_DONE)
+            {
+                log_error("Failed to delete map versions: " + m_database->get_error_message());
+                return false;
+            }
+        }
+
+        // Content may still be shared with versions of other maps
+        return m_database->execute("DELETE FROM chunk_contents WHERE id NOT IN "
+                                   "(SELECT content_id FROM map_version_chunks)");
     }
 
     // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
     auto SQLiteGridRepository::load_generator_config(const std::string &map_name)
         -> std::optional<GeneratorConfig>
     {
-        if (m_db == nullptr)
+        if (!is_open())
         {
             return std::nullopt;
         }
@@ -591,13 +1575,12 @@ namespace Tactics
             WHERE m.name = ?
         )";
 
-        sqlite3_stmt *stmt = nullptr;
-        if (sqlite3_prepare_v2(m_db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+        const CachedStatement cached = m_database->acquire(sql);
+        if (!cached)
         {
-            log_error("Failed to prepare generator config query: " +
-                      std::string(sqlite3_errmsg(m_db)));
             return std::nullopt;
         }
+        sqlite3_stmt *stmt = cached.get();
 
         sqlite3_bind_text(stmt, 1, map_name.c_str(), -1, SQLITE_STATIC);
 
@@ -606,7 +1589,8 @@ namespace Tactics
         {
             if (sqlite3_column_type(stmt, COLUMN_SEED) != SQLITE_NULL)
             {
-                GeneratorConfig loaded_config{};
+                // Fields that are not stored (thread count) keep their defaults
+                GeneratorConfig loaded_config = GeneratorConfig::default_config();
                 loaded_config.width = sqlite3_column_int(stmt, COLUMN_WIDTH);
                 loaded_config.height = sqlite3_column_int(stmt, COLUMN_HEIGHT);
                 loaded_config.seed = sqlite3_column_int(stmt, COLUMN_SEED);
@@ -627,7 +1611,6 @@ namespace Tactics
             }
         }
 
-        sqlite3_finalize(stmt);
         return config;
     }
 
@@ -635,7 +1618,7 @@ namespace Tactics
     auto SQLiteGridRepository::save_generator_config(const std::string &map_name,
                                                      const GeneratorConfig &config) -> bool
     {
-        if (m_db == nullptr)
+        if (!is_open())
         {
             return false;
         }
@@ -656,13 +1639,12 @@ namespace Tactics
                 mountain_threshold = excluded.mountain_threshold
         )";
 
-        sqlite3_stmt *stmt = nullptr;
-        if (sqlite3_prepare_v2(m_db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+        const CachedStatement cached = m_database->acquire(sql);
+        if (!cached)
         {
-            log_error("Failed to prepare generator config upsert: " +
-                      std::string(sqlite3_errmsg(m_db)));
             return false;
         }
+        sqlite3_stmt *stmt = cached.get();
 
         constexpr int STMT_MAP_NAME = 1;
         constexpr int STMT_SEED = 2;
@@ -688,14 +1670,12 @@ namespace Tactics
         sqlite3_bind_double(stmt, STMT_MOUNTAIN_THRESHOLD,
                             static_cast<double>(config.mountain_threshold));
 
-        bool success = false;
-        success = sqlite3_step(stmt) == SQLITE_DONE;
+        const bool success = sqlite3_step(stmt) == SQLITE_DONE;
         if (!success)
         {
-            log_error("Failed to save generator config: " + std::string(sqlite3_errmsg(m_db)));
+            log_error("Failed to save generator config: " + m_database->get_error_message());
         }
 
-        sqlite3_finalize(stmt);
         return success;
     }
 } // namespace Tactics
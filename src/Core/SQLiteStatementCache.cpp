@@ -0,0 +1,135 @@
+#include "Tactics/Core/SQLiteStatementCache.hpp"
+#include "Tactics/Core/Logger.hpp"
+#include <utility>
+
+namespace Tactics
+{
+    CachedStatement::CachedStatement(sqlite3_stmt *stmt, bool *checked_out)
+        : m_stmt(stmt), m_checked_out(checked_out)
+    {
+        *m_checked_out = true;
+    }
+
+    CachedStatement::~CachedStatement()
+    {
+        release();
+    }
+
+    CachedStatement::CachedStatement(CachedStatement &&other) noexcept
+        : m_stmt(std::exchange(other.m_stmt, nullptr)),
+          m_checked_out(std::exchange(other.m_checked_out, nullptr))
+    {
+    }
+
+    auto CachedStatement::operator=(CachedStatement &&other) noexcept -> CachedStatement &
+    {
+        if (this != &other)
+        {
+            release();
+            m_stmt = std::exchange(other.m_stmt, nullptr);
+            m_checked_out = std::exchange(other.m_checked_out, nullptr);
+        }
+        return *this;
+    }
+
+    auto CachedStatement::get() const -> sqlite3_stmt *
+    {
+        return m_stmt;
+    }
+
+    CachedStatement::operator bool() const
+    {
+        return m_stmt != nullptr;
+    }
+
+    void CachedStatement::release()
+    {
+        if (m_stmt != nullptr)
+        {
+            sqlite3_reset(m_stmt);
+            sqlite3_clear_bindings(m_stmt);
+            *m_checked_out = false;
+            m_stmt = nullptr;
+            m_checked_out = nullptr;
+        }
+    }
+
+    SQLiteStatementCache::SQLiteStatementCache(sqlite3 *db) : m_db(db) {}
+
+    SQLiteStatementCache::~SQLiteStatementCache()
+    {
+        clear();
+    }
+
+    SQLiteStatementCache::SQLiteStatementCache(SQLiteStatementCache &&other) noexcept
+        : m_db(std::exchange(other.m_db, nullptr)), m_statements(std::move(other.m_statements)),
+          m_prepare_count(std::exchange(other.m_prepare_count, 0))
+    {
+        other.m_statements.clear();
+    }
+
+    auto SQLiteStatementCache::operator=(SQLiteStatementCache &&other) noexcept
+        -> SQLiteStatementCache &
+    {
+        if (this != &other)
+        {
+            clear();
+            m_db = std::exchange(other.m_db, nullptr);
+            m_statements = std::move(other.m_statements);
+            other.m_statements.clear();
+            m_prepare_count = std::exchange(other.m_prepare_count, 0);
+        }
+        return *this;
+    }
+
+    auto SQLiteStatementCache::acquire(const std::string &sql) -> CachedStatement
+    {
+        if (m_db == nullptr)
+        {
+            return CachedStatement();
+        }
+
+        const auto found = m_statements.find(sql);
+        if (found != m_statements.end())
+        {
+            Entry &entry = found->second;
+            if (entry.checked_out)
+            {
+                log_error("Statement is already checked out: " + sql);
+                return CachedStatement();
+            }
+            return CachedStatement(entry.stmt, &entry.checked_out);
+        }
+
+        sqlite3_stmt *stmt = nullptr;
+        ++m_prepare_count;
+        if (sqlite3_prepare_v2(m_db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+        {
+            log_error("Failed to prepare statement: " + std::string(sqlite3_errmsg(m_db)));
+            sqlite3_finalize(stmt);
+            return CachedStatement();
+        }
+
+        Entry &entry = m_statements.try_emplace(sql, Entry{.stmt = stmt}).first->second;
+        return CachedStatement(entry.stmt, &entry.checked_out);
+    }
+
+    void SQLiteStatementCache::clear()
+    {
+        for (const auto &[sql, entry] : m_statements)
+        {
+            sqlite3_finalize(entry.stmt);
+        }
+        m_statements.clear();
+    }
+
+    auto SQLiteStatementCache::get_statement_count() const -> std::size_t
+    {
+        return m_statements.size();
+    }
+
+    auto SQLiteStatementCache::get_prepare_count() const -> std::size_t
+    {
+        return m_prepare_count;
+    }
+} // namespace Tactics
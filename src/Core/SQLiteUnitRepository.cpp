@@ -1,67 +1,46 @@
 #include "Tactics/Core/SQLiteUnitRepository.hpp"
 #include "Tactics/Core/Logger.hpp"
+#include <memory>
+#include <utility>
 
 namespace Tactics
 {
     SQLiteUnitRepository::SQLiteUnitRepository(const std::string &db_path)
+        : SQLiteUnitRepository(std::make_shared<SQLiteDatabase>(db_path))
     {
-        const int result = sqlite3_open(db_path.c_str(), &m_db);
-        if (result != SQLITE_OK)
+    }
+
+    SQLiteUnitRepository::SQLiteUnitRepository(std::shared_ptr<SQLiteDatabase> database)
+        : m_database(std::move(database))
+    {
+        if (!is_open())
         {
-            log_error("Failed to open SQLite database: " + db_path + " - " + sqlite3_errmsg(m_db));
-            if (m_db != nullptr)
-            {
-                sqlite3_close(m_db);
-                m_db = nullptr;
-            }
             return;
         }
 
         if (!initialize_schema())
         {
             log_error("Failed to initialize unit repository schema");
-            if (m_db != nullptr)
-            {
-                sqlite3_close(m_db);
-                m_db = nullptr;
-            }
-        }
-    }
-
-    SQLiteUnitRepository::~SQLiteUnitRepository()
-    {
-        if (m_db != nullptr)
-        {
-            sqlite3_close(m_db);
-            m_db = nullptr;
+            m_database.reset();
         }
     }
 
     SQLiteUnitRepository::SQLiteUnitRepository(SQLiteUnitRepository &&other) noexcept
-        : m_db(other.m_db)
+        : m_database(std::move(other.m_database))
     {
-        other.m_db = nullptr;
     }
 
     auto SQLiteUnitRepository::operator=(SQLiteUnitRepository &&other) noexcept
         -> SQLiteUnitRepository &
     {
-        if (this != &other)
-        {
-            if (m_db != nullptr)
-            {
-                sqlite3_close(m_db);
-            }
-            m_db = other.m_db;
-            other.m_db = nullptr;
-        }
+        m_database = std::move(other.m_database);
         return *this;
     }
 
     // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
     auto SQLiteUnitRepository::initialize_schema() -> bool
     {
-        if (m_db == nullptr)
+        if (!is_open())
         {
             return false;
         }
@@ -77,53 +56,37 @@ namespace Tactics
             )
         )";
 
-        if (!execute_statement(create_units_sql))
+        if (!m_database->execute(create_units_sql))
         {
             return false;
         }
 
         const std::string create_units_index_sql =
             "CREATE INDEX IF NOT EXISTS idx_units_map_name ON units(map_name)";
-        return execute_statement(create_units_index_sql);
+        return m_database->execute(create_units_index_sql);
     }
 
-    // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
-    auto SQLiteUnitRepository::execute_statement(const std::string &sql) -> bool
+    auto SQLiteUnitRepository::is_open() const -> bool
     {
-        if (m_db == nullptr)
-        {
-            return false;
-        }
-
-        char *error_message = nullptr;
-        const int result = sqlite3_exec(m_db, sql.c_str(), nullptr, nullptr, &error_message);
-        if (result != SQLITE_OK)
-        {
-            log_error("SQLite error: " +
-                      std::string(error_message != nullptr ? error_message : "Unknown error"));
-            sqlite3_free(error_message);
-            return false;
-        }
-
-        return true;
+        return m_database != nullptr && m_database->is_open();
     }
 
     auto SQLiteUnitRepository::load_units(const std::string &map_name) -> std::vector<Unit>
     {
         std::vector<Unit> units;
-        if (m_db == nullptr)
+        if (!is_open())
         {
             return units;
         }
 
         const std::string sql =
             "SELECT x, y, move_points FROM units WHERE map_name = ? ORDER BY unit_index";
-        sqlite3_stmt *stmt = nullptr;
-        if (sqlite3_prepare_v2(m_db, sql.c_str(), -1, &stmt, nullptr) != SQLITE_OK)
+        const CachedStatement cached = m_database->acquire(sql);
+        if (!cached)
         {
-            log_error("Failed to prepare units query: " + std::string(sqlite3_errmsg(m_db)));
             return units;
         }
+        sqlite3_stmt *stmt = cached.get();
 
         sqlite3_bind_text(stmt, 1, map_name.c_str(), -1, SQLITE_STATIC);
 
@@ -135,52 +98,46 @@ namespace Tactics
             units.emplace_back(Vector2i{x_pos, y_pos}, move_points);
         }
 
-        sqlite3_finalize(stmt);
         return units;
     }
 
     auto SQLiteUnitRepository::save_units(const std::string &map_name,
                                           const std::vector<Unit> &units) -> bool
     {
-        if (m_db == nullptr)
+        if (!is_open())
         {
             log_error("Database connection is null");
             return false;
         }
 
-        if (!execute_statement("BEGIN TRANSACTION"))
+        SQLiteTransaction transaction(*m_database);
+        if (!transaction.is_active())
         {
             return false;
         }
 
-        const std::string delete_sql = "DELETE FROM units WHERE map_name = ?";
-        sqlite3_stmt *delete_stmt = nullptr;
-        if (sqlite3_prepare_v2(m_db, delete_sql.c_str(), -1, &delete_stmt, nullptr) != SQLITE_OK)
+        const CachedStatement delete_stmt =
+            m_database->acquire("DELETE FROM units WHERE map_name = ?");
+        if (!delete_stmt)
         {
-            log_error("Failed to prepare delete units: " + std::string(sqlite3_errmsg(m_db)));
-            execute_statement("ROLLBACK");
             return false;
         }
 
-        sqlite3_bind_text(delete_stmt, 1, map_name.c_str(), -1, SQLITE_STATIC);
-        if (sqlite3_step(delete_stmt) != SQLITE_DONE)
+        sqlite3_bind_text(delete_stmt.get(), 1, map_name.c_str(), -1, SQLITE_STATIC);
+        if (sqlite3_step(delete_stmt.get()) != SQLITE_DONE)
         {
-            log_error("Failed to delete units: " + std::string(sqlite3_errmsg(m_db)));
-            sqlite3_finalize(delete_stmt);
-            execute_statement("ROLLBACK");
+            log_error("Failed to delete units: " + m_database->get_error_message());
             return false;
         }
-        sqlite3_finalize(delete_stmt);
 
         const std::string insert_sql =
             "INSERT INTO units (map_name, unit_index, x, y, move_points) VALUES (?, ?, ?, ?, ?)";
-        sqlite3_stmt *insert_stmt = nullptr;
-        if (sqlite3_prepare_v2(m_db, insert_sql.c_str(), -1, &insert_stmt, nullptr) != SQLITE_OK)
+        const CachedStatement cached = m_database->acquire(insert_sql);
+        if (!cached)
         {
-            log_error("Failed to prepare insert units: " + std::string(sqlite3_errmsg(m_db)));
-            execute_statement("ROLLBACK");
             return false;
         }
+        sqlite3_stmt *insert_stmt = cached.get();
 
         constexpr int STMT_MAP_NAME = 1;
         constexpr int STMT_UNIT_INDEX = 2;
@@ -200,21 +157,11 @@ namespace Tactics
 
             if (sqlite3_step(insert_stmt) != SQLITE_DONE)
             {
-                log_error("Failed to insert unit: " + std::string(sqlite3_errmsg(m_db)));
-                sqlite3_finalize(insert_stmt);
-                execute_statement("ROLLBACK");
+                log_error("Failed to insert unit: " + m_database->get_error_message());
                 return false;
             }
         }
 
-        sqlite3_finalize(insert_stmt);
-
-        if (!execute_statement("COMMIT"))
-        {
-            execute_statement("ROLLBACK");
-            return false;
-        }
-
-        return true;
+        return transaction.commit();
     }
 } // namespace Tactics
@@ -0,0 +1,85 @@
+#include "Tactics/Core/ThreadPool.hpp"
+
+#include <algorithm>
+
+namespace Tactics
+{
+    ThreadPool::ThreadPool(std::size_t worker_count)
+    {
+        if (worker_count == 0)
+        {
+            worker_count = std::max(1U, std::thread::hardware_concurrency());
+        }
+
+        m_workers.reserve(worker_count);
+        for (std::size_t worker = 0; worker < worker_count; ++worker)
+        {
+            m_workers.emplace_back([this, worker]() { worker_loop(worker); });
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            const std::scoped_lock lock(m_mutex);
+            m_stopping = true;
+        }
+        m_job_ready.notify_all();
+        // Workers are joined by the jthread destructors
+    }
+
+    void ThreadPool::parallel_for(std::size_t item_count, const Task &task)
+    {
+        if (item_count == 0)
+        {
+            return;
+        }
+
+        std::unique_lock lock(m_mutex);
+        m_task = &task;
+        m_item_count = item_count;
+        m_next_item = 0;
+        m_busy_workers = m_workers.size();
+        ++m_job_generation;
+        m_job_ready.notify_all();
+
+        m_job_done.wait(lock, [this]() -> bool { return m_busy_workers == 0; });
+        m_task = nullptr;
+    }
+
+    auto ThreadPool::get_worker_count() const -> std::size_t
+    {
+        return m_workers.size();
+    }
+
+    void ThreadPool::worker_loop(std::size_t worker)
+    {
+        std::uint64_t seen_generation = 0;
+        std::unique_lock lock(m_mutex);
+        while (true)
+        {
+            m_job_ready.wait(lock, [this, &seen_generation]() -> bool
+                             { return m_stopping || m_job_generation != seen_generation; });
+            if (m_stopping)
+            {
+                return;
+            }
+
+            seen_generation = m_job_generation;
+            const Task &task = *m_task;
+            while (m_next_item < m_item_count)
+            {
+                const std::size_t item = m_next_item++;
+                lock.unlock();
+                task(item, worker);
+                lock.lock();
+            }
+
+            --m_busy_workers;
+            if (m_busy_workers == 0)
+            {
+                m_job_done.notify_all();
+            }
+        }
+    }
+} // namespace Tactics
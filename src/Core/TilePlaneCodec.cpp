@@ -0,0 +1,597 @@
+#include "Tactics/Core/TilePlaneCodec.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TACTICS_TILE_CODEC_X86 1
+#include <immintrin.h>
+#endif
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr std::size_t WORD_BYTES = sizeof(std::uint64_t);
+        constexpr std::uint64_t BYTE_BROADCAST = 0x0101010101010101ULL;
+        constexpr std::size_t MAX_RUN = std::numeric_limits<std::uint16_t>::max();
+        constexpr std::size_t RUN_BYTES = 3;
+        constexpr std::size_t BITS_PER_BYTE = 8;
+        constexpr std::size_t VALUE_COUNT = 256;
+        constexpr std::size_t BLOB_HEADER_BYTES = 6;
+        constexpr std::size_t SSE_BYTES = 16;
+        constexpr std::size_t AVX_BYTES = 32;
+        constexpr std::size_t NIBBLE_BITS = 4;
+        constexpr std::uint32_t SSE_ALL_EQUAL = 0xFFFFU;
+        constexpr std::uint32_t AVX_ALL_EQUAL = 0xFFFFFFFFU;
+        constexpr short LOW_NIBBLE = 0x000F;
+        constexpr short HIGH_BYTE_NIBBLE = 0x0F00;
+
+        const RawCodec RAW_CODEC;
+        const RunLengthCodec RUN_LENGTH_CODEC;
+        const PaletteCodec PALETTE_CODEC;
+
+        // Ties go to the earlier codec, so cheaper decoders win when sizes are equal
+        const std::array<const ITilePlaneCodec *, 3> CODECS = {&RAW_CODEC, &RUN_LENGTH_CODEC,
+                                                               &PALETTE_CODEC};
+
+        // Index of the lowest-addressed non-zero byte in a word loaded from memory
+        auto first_set_byte(std::uint64_t word) -> std::size_t
+        {
+            if constexpr (std::endian::native == std::endian::little)
+            {
+                return static_cast<std::size_t>(std::countr_zero(word)) / BITS_PER_BYTE;
+            }
+            else
+            {
+                return static_cast<std::size_t>(std::countl_zero(word)) / BITS_PER_BYTE;
+            }
+        }
+
+        // End of a run of value that continues at least up to position, comparing a word at a
+        // time. Also finishes the scan after the vector kernels
+        auto find_run_end_scalar(std::span<const std::uint8_t> plane, std::size_t position,
+                                 std::uint8_t value) -> std::size_t
+        {
+            const std::uint64_t pattern = BYTE_BROADCAST * value;
+
+            while (position + WORD_BYTES <= plane.size())
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, plane.subspan(position).data(), WORD_BYTES);
+                const std::uint64_t difference = word ^ pattern;
+                if (difference != 0)
+                {
+                    return position + first_set_byte(difference);
+                }
+                position += WORD_BYTES;
+            }
+
+            while (position < plane.size() && plane[position] == value)
+            {
+                ++position;
+            }
+            return position;
+        }
+
+#if defined(TACTICS_TILE_CODEC_X86)
+        // Compiled for their instruction set through target attributes, like the ValueNoise
+        // kernels, so the rest of the file stays baseline x86-64
+        __attribute__((target("sse4.1"))) auto
+        find_run_end_sse41(std::span<const std::uint8_t> plane, std::size_t position,
+                           std::uint8_t value) -> std::size_t
+        {
+            const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+            for (; position + SSE_BYTES <= plane.size(); position += SSE_BYTES)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                const auto *block = reinterpret_cast<const __m128i *>(&plane[position]);
+                const auto equal = static_cast<std::uint32_t>(
+                    _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(block), pattern)));
+                if (equal != SSE_ALL_EQUAL)
+                {
+                    return position + static_cast<std::size_t>(std::countr_one(equal));
+                }
+            }
+            return find_run_end_scalar(plane, position, value);
+        }
+
+        __attribute__((target("avx2"))) auto
+        find_run_end_avx2(std::span<const std::uint8_t> plane, std::size_t position,
+                          std::uint8_t value) -> std::size_t
+        {
+            const __m256i pattern = _mm256_set1_epi8(static_cast<char>(value));
+            for (; position + AVX_BYTES <= plane.size(); position += AVX_BYTES)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                const auto *block = reinterpret_cast<const __m256i *>(&plane[position]);
+                const auto equal = static_cast<std::uint32_t>(
+                    _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(block), pattern)));
+                if (equal != AVX_ALL_EQUAL)
+                {
+                    return position + static_cast<std::size_t>(std::countr_one(equal));
+                }
+            }
+            return find_run_end_scalar(plane, position, value);
+        }
+
+        // Expand packed 4-bit indices through the palette: each packed byte is widened to 16
+        // bits with its high nibble moved into the upper byte, which leaves one index per byte
+        // in entry order, ready for a byte shuffle. Returns the packed bytes consumed; valid
+        // turns false if an index is past the end of the palette
+        __attribute__((target("sse4.1"))) auto
+        expand_nibbles_sse41(std::span<const std::uint8_t> packed, std::span<std::uint8_t> plane,
+                             const std::array<std::uint8_t, SSE_BYTES> &palette,
+                             std::size_t palette_size, bool &valid) -> std::size_t
+        {
+            constexpr std::size_t PACKED_STEP = SSE_BYTES / 2;
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            const __m128i table =
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(palette.data()));
+            const __m128i last_index = _mm_set1_epi8(static_cast<char>(palette_size - 1));
+            const __m128i low_mask = _mm_set1_epi16(LOW_NIBBLE);
+            const __m128i high_mask = _mm_set1_epi16(HIGH_BYTE_NIBBLE);
+            __m128i invalid = _mm_setzero_si128();
+
+            std::size_t byte = 0;
+            for (; (byte + PACKED_STEP) * 2 <= plane.size(); byte += PACKED_STEP)
+            {
+                const __m128i wide = _mm_cvtepu8_epi16(
+                    _mm_loadl_epi64(reinterpret_cast<const __m128i *>(&packed[byte])));
+                const __m128i indices =
+                    _mm_or_si128(_mm_and_si128(wide, low_mask),
+                                 _mm_and_si128(_mm_slli_epi16(wide, NIBBLE_BITS), high_mask));
+                invalid = _mm_or_si128(invalid, _mm_cmpgt_epi8(indices, last_index));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(&plane[byte * 2]),
+                                 _mm_shuffle_epi8(table, indices));
+            }
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+            valid = valid && _mm_testz_si128(invalid, invalid) != 0;
+            return byte;
+        }
+
+        __attribute__((target("avx2"))) auto
+        expand_nibbles_avx2(std::span<const std::uint8_t> packed, std::span<std::uint8_t> plane,
+                            const std::array<std::uint8_t, SSE_BYTES> &palette,
+                            std::size_t palette_size, bool &valid) -> std::size_t
+        {
+            constexpr std::size_t PACKED_STEP = AVX_BYTES / 2;
+            // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+            // The shuffle works within 128-bit lanes, so both lanes get the whole palette
+            const __m256i table = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(palette.data())));
+            const __m256i last_index = _mm256_set1_epi8(static_cast<char>(palette_size - 1));
+            const __m256i low_mask = _mm256_set1_epi16(LOW_NIBBLE);
+            const __m256i high_mask = _mm256_set1_epi16(HIGH_BYTE_NIBBLE);
+            __m256i invalid = _mm256_setzero_si256();
+
+            std::size_t byte = 0;
+            for (; (byte + PACKED_STEP) * 2 <= plane.size(); byte += PACKED_STEP)
+            {
+                const __m256i wide = _mm256_cvtepu8_epi16(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(&packed[byte])));
+                const __m256i indices = _mm256_or_si256(
+                    _mm256_and_si256(wide, low_mask),
+                    _mm256_and_si256(_mm256_slli_epi16(wide, NIBBLE_BITS), high_mask));
+                invalid = _mm256_or_si256(invalid, _mm256_cmpgt_epi8(indices, last_index));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(&plane[byte * 2]),
+                                    _mm256_shuffle_epi8(table, indices));
+            }
+            // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+
+            valid = valid && _mm256_testz_si256(invalid, invalid) != 0;
+            return byte;
+        }
+#endif
+
+        // End of the run starting at start
+        auto find_run_end(std::span<const std::uint8_t> plane, std::size_t start,
+                          TileCodecBackend backend) -> std::size_t
+        {
+#if defined(TACTICS_TILE_CODEC_X86)
+            switch (backend)
+            {
+            case TileCodecBackend::AVX2:
+                return find_run_end_avx2(plane, start + 1, plane[start]);
+            case TileCodecBackend::SSE41:
+                return find_run_end_sse41(plane, start + 1, plane[start]);
+            case TileCodecBackend::Scalar:
+                break;
+            }
+#else
+            static_cast<void>(backend);
+#endif
+            return find_run_end_scalar(plane, start + 1, plane[start]);
+        }
+
+        // Vector part of a 4-bit palette decode; returns the packed bytes it consumed, leaving
+        // the rest to the lookup table
+        auto expand_nibbles(std::span<const std::uint8_t> packed, std::span<std::uint8_t> plane,
+                            std::span<const std::uint8_t> palette, TileCodecBackend backend,
+                            bool &valid) -> std::size_t
+        {
+#if defined(TACTICS_TILE_CODEC_X86)
+            std::array<std::uint8_t, SSE_BYTES> table{};
+            std::ranges::copy(palette, table.begin());
+            switch (backend)
+            {
+            case TileCodecBackend::AVX2:
+                return expand_nibbles_avx2(packed, plane, table, palette.size(), valid);
+            case TileCodecBackend::SSE41:
+                return expand_nibbles_sse41(packed, plane, table, palette.size(), valid);
+            case TileCodecBackend::Scalar:
+                break;
+            }
+#else
+            static_cast<void>(packed);
+            static_cast<void>(plane);
+            static_cast<void>(palette);
+            static_cast<void>(backend);
+            static_cast<void>(valid);
+#endif
+            return 0;
+        }
+
+        // Index width for a palette size: one value needs no index bits at all
+        auto palette_bits(std::size_t palette_size) -> std::size_t
+        {
+            if (palette_size <= 1)
+            {
+                return 0;
+            }
+            if (palette_size <= 2)
+            {
+                return 1;
+            }
+            return palette_size <= 4 ? 2 : 4;
+        }
+
+        auto packed_size(std::size_t entry_count, std::size_t bits) -> std::size_t
+        {
+            return ((entry_count * bits) + BITS_PER_BYTE - 1) / BITS_PER_BYTE;
+        }
+
+        auto as_bytes(std::span<const std::int8_t> plane) -> std::span<const std::uint8_t>
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            return {reinterpret_cast<const std::uint8_t *>(plane.data()), plane.size()};
+        }
+
+        auto as_writable_bytes(std::span<std::int8_t> plane) -> std::span<std::uint8_t>
+        {
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            return {reinterpret_cast<std::uint8_t *>(plane.data()), plane.size()};
+        }
+
+        void put_u32(std::span<std::uint8_t> bytes, std::uint32_t value)
+        {
+            for (std::size_t byte = 0; byte < 4; ++byte)
+            {
+                bytes[byte] = static_cast<std::uint8_t>(value >> (byte * BITS_PER_BYTE));
+            }
+        }
+
+        auto get_u32(std::span<const std::uint8_t> bytes) -> std::uint32_t
+        {
+            std::uint32_t value = 0;
+            for (std::size_t byte = 0; byte < 4; ++byte)
+            {
+                value |= static_cast<std::uint32_t>(bytes[byte]) << (byte * BITS_PER_BYTE);
+            }
+            return value;
+        }
+    } // namespace
+
+    auto detect_tile_codec_backend() -> TileCodecBackend
+    {
+#if defined(TACTICS_TILE_CODEC_X86)
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return TileCodecBackend::AVX2;
+        }
+
+        if (__builtin_cpu_supports("sse4.1"))
+        {
+            return TileCodecBackend::SSE41;
+        }
+#endif
+
+        return TileCodecBackend::Scalar;
+    }
+
+    auto RawCodec::get_id() const -> TileCodecId
+    {
+        return TileCodecId::Raw;
+    }
+
+    auto RawCodec::encode(std::span<const std::uint8_t> plane, std::vector<std::uint8_t> &out) const
+        -> bool
+    {
+        out.insert(out.end(), plane.begin(), plane.end());
+        return true;
+    }
+
+    auto RawCodec::decode(std::span<const std::uint8_t> encoded,
+                          std::span<std::uint8_t> plane) const -> bool
+    {
+        if (encoded.size() != plane.size())
+        {
+            return false;
+        }
+        std::ranges::copy(encoded, plane.begin());
+        return true;
+    }
+
+    RunLengthCodec::RunLengthCodec() : m_backend(detect_tile_codec_backend()) {}
+
+    auto RunLengthCodec::get_id() const -> TileCodecId
+    {
+        return TileCodecId::RunLength;
+    }
+
+    auto RunLengthCodec::encode(std::span<const std::uint8_t> plane,
+                                std::vector<std::uint8_t> &out) const -> bool
+    {
+        std::size_t start = 0;
+        while (start < plane.size())
+        {
+            const std::uint8_t value = plane[start];
+            const std::size_t end = find_run_end(plane, start, m_backend);
+
+            for (std::size_t remaining = end - start; remaining > 0;)
+            {
+                const std::size_t length = std::min(remaining, MAX_RUN);
+                out.push_back(value);
+                out.push_back(static_cast<std::uint8_t>(length & 0xFFU));
+                out.push_back(static_cast<std::uint8_t>(length >> BITS_PER_BYTE));
+                remaining -= length;
+            }
+            start = end;
+        }
+        return true;
+    }
+
+    auto RunLengthCodec::decode(std::span<const std::uint8_t> encoded,
+                                std::span<std::uint8_t> plane) const -> bool
+    {
+        if (encoded.size() % RUN_BYTES != 0)
+        {
+            return false;
+        }
+
+        std::size_t position = 0;
+        for (std::size_t run = 0; run < encoded.size(); run += RUN_BYTES)
+        {
+            const std::uint8_t value = encoded[run];
+            const std::size_t length =
+                static_cast<std::size_t>(encoded[run + 1]) |
+                (static_cast<std::size_t>(encoded[run + 2]) << BITS_PER_BYTE);
+            if (length == 0 || length > plane.size() - position)
+            {
+                return false;
+            }
+
+            std::fill_n(plane.subspan(position).begin(), length, value);
+            position += length;
+        }
+
+        return position == plane.size();
+    }
+
+    void RunLengthCodec::set_backend(TileCodecBackend backend)
+    {
+        m_backend = std::min(backend, detect_tile_codec_backend());
+    }
+
+    auto RunLengthCodec::get_backend() const -> TileCodecBackend
+    {
+        return m_backend;
+    }
+
+    PaletteCodec::PaletteCodec() : m_backend(detect_tile_codec_backend()) {}
+
+    auto PaletteCodec::get_id() const -> TileCodecId
+    {
+        return TileCodecId::Palette;
+    }
+
+    auto PaletteCodec::encode(std::span<const std::uint8_t> plane,
+                              std::vector<std::uint8_t> &out) const -> bool
+    {
+        std::array<bool, VALUE_COUNT> seen{};
+        for (const std::uint8_t value : plane)
+        {
+            seen[value] = true;
+        }
+
+        std::array<std::uint8_t, VALUE_COUNT> index_of{};
+        std::vector<std::uint8_t> palette;
+        for (std::size_t value = 0; value < VALUE_COUNT; ++value)
+        {
+            if (seen[value])
+            {
+                if (palette.size() == static_cast<std::size_t>(MAX_PALETTE))
+                {
+                    return false;
+                }
+                index_of[value] = static_cast<std::uint8_t>(palette.size());
+                palette.push_back(static_cast<std::uint8_t>(value));
+            }
+        }
+
+        out.push_back(static_cast<std::uint8_t>(palette.size()));
+        out.insert(out.end(), palette.begin(), palette.end());
+
+        const std::size_t bits = palette_bits(palette.size());
+        if (bits == 0)
+        {
+            return true;
+        }
+
+        const std::size_t per_byte = BITS_PER_BYTE / bits;
+        const std::size_t packed_start = out.size();
+        out.resize(packed_start + packed_size(plane.size(), bits));
+        for (std::size_t entry = 0; entry < plane.size(); ++entry)
+        {
+            const auto shift = static_cast<unsigned>((entry % per_byte) * bits);
+            out[packed_start + (entry / per_byte)] |=
+                static_cast<std::uint8_t>(index_of[plane[entry]] << shift);
+        }
+        return true;
+    }
+
+    auto PaletteCodec::decode(std::span<const std::uint8_t> encoded,
+                              std::span<std::uint8_t> plane) const -> bool
+    {
+        if (encoded.empty())
+        {
+            return false;
+        }
+
+        const std::size_t palette_size = encoded[0];
+        if (palette_size > static_cast<std::size_t>(MAX_PALETTE) ||
+            (palette_size == 0 && !plane.empty()))
+        {
+            return false;
+        }
+
+        const std::size_t bits = palette_bits(palette_size);
+        const auto palette = encoded.subspan(1, std::min(palette_size, encoded.size() - 1));
+        if (palette.size() != palette_size ||
+            encoded.size() != 1 + palette_size + packed_size(plane.size(), bits))
+        {
+            return false;
+        }
+
+        if (bits == 0)
+        {
+            std::ranges::fill(plane, palette_size == 0 ? std::uint8_t{0} : palette[0]);
+            return true;
+        }
+
+        // Every possible packed byte expands to per_byte entries through one table lookup
+        const std::size_t per_byte = BITS_PER_BYTE / bits;
+        const std::size_t mask = (std::size_t{1} << bits) - 1;
+        std::array<std::array<std::uint8_t, BITS_PER_BYTE>, VALUE_COUNT> expanded{};
+        std::array<bool, VALUE_COUNT> valid{};
+        for (std::size_t packed = 0; packed < VALUE_COUNT; ++packed)
+        {
+            valid[packed] = true;
+            for (std::size_t slot = 0; slot < per_byte; ++slot)
+            {
+                const std::size_t index = (packed >> (slot * bits)) & mask;
+                valid[packed] = valid[packed] && index < palette_size;
+                expanded[packed][slot] = index < palette_size ? palette[index] : 0;
+            }
+        }
+
+        const auto packed = encoded.subspan(1 + palette_size);
+        const std::size_t whole_bytes = plane.size() / per_byte;
+        bool all_valid = true;
+        const std::size_t vector_bytes =
+            bits == NIBBLE_BITS ? expand_nibbles(packed, plane, palette, m_backend, all_valid) : 0;
+        for (std::size_t byte = vector_bytes; byte < whole_bytes; ++byte)
+        {
+            const std::uint8_t value = packed[byte];
+            all_valid = all_valid && valid[value];
+            std::memcpy(plane.subspan(byte * per_byte).data(), expanded[value].data(), per_byte);
+        }
+
+        const std::size_t tail = plane.size() - (whole_bytes * per_byte);
+        if (tail > 0)
+        {
+            const std::uint8_t value = packed[whole_bytes];
+            all_valid = all_valid && valid[value];
+            std::memcpy(plane.subspan(whole_bytes * per_byte).data(), expanded[value].data(),
+                        tail);
+        }
+
+        return all_valid;
+    }
+
+    void PaletteCodec::set_backend(TileCodecBackend backend)
+    {
+        m_backend = std::min(backend, detect_tile_codec_backend());
+    }
+
+    auto PaletteCodec::get_backend() const -> TileCodecBackend
+    {
+        return m_backend;
+    }
+
+    auto find_tile_codec(TileCodecId codec_id) -> const ITilePlaneCodec *
+    {
+        const auto found = std::ranges::find(CODECS, codec_id, &ITilePlaneCodec::get_id);
+        return found != CODECS.end() ? *found : nullptr;
+    }
+
+    auto encode_tile_plane(std::span<const std::uint8_t> plane, std::vector<std::uint8_t> &out)
+        -> TileCodecId
+    {
+        std::vector<std::uint8_t> best;
+        std::vector<std::uint8_t> candidate;
+        TileCodecId best_id = TileCodecId::Raw;
+        bool have_best = false;
+
+        for (const ITilePlaneCodec *codec : CODECS)
+        {
+            candidate.clear();
+            if (codec->encode(plane, candidate) && (!have_best || candidate.size() < best.size()))
+            {
+                std::swap(best, candidate);
+                best_id = codec->get_id();
+                have_best = true;
+            }
+        }
+
+        out.insert(out.end(), best.begin(), best.end());
+        return best_id;
+    }
+
+    void encode_chunk_blob(const ConstGridChunk &chunk, std::vector<std::uint8_t> &out)
+    {
+        const std::size_t header_start = out.size();
+        out.resize(header_start + BLOB_HEADER_BYTES);
+
+        const TileCodecId types_codec = encode_tile_plane(chunk.tile_types, out);
+        const std::size_t types_size = out.size() - header_start - BLOB_HEADER_BYTES;
+        const TileCodecId costs_codec = encode_tile_plane(as_bytes(chunk.move_costs), out);
+
+        const auto header = std::span<std::uint8_t>(out).subspan(header_start, BLOB_HEADER_BYTES);
+        header[0] = static_cast<std::uint8_t>(types_codec);
+        header[1] = static_cast<std::uint8_t>(costs_codec);
+        put_u32(header.subspan(2), static_cast<std::uint32_t>(types_size));
+    }
+
+    auto decode_chunk_blob(std::span<const std::uint8_t> blob, const GridChunk &chunk) -> bool
+    {
+        if (blob.size() < BLOB_HEADER_BYTES)
+        {
+            return false;
+        }
+
+        const ITilePlaneCodec *types_codec = find_tile_codec(static_cast<TileCodecId>(blob[0]));
+        const ITilePlaneCodec *costs_codec = find_tile_codec(static_cast<TileCodecId>(blob[1]));
+        const std::size_t types_size = get_u32(blob.subspan(2));
+        const auto body = blob.subspan(BLOB_HEADER_BYTES);
+        if (types_codec == nullptr || costs_codec == nullptr || types_size > body.size())
+        {
+            return false;
+        }
+
+        if (!types_codec->decode(body.first(types_size), chunk.tile_types) ||
+            !costs_codec->decode(body.subspan(types_size), as_writable_bytes(chunk.move_costs)))
+        {
+            return false;
+        }
+
+        // Any byte decodes, so a corrupt plane can hold values no Tile::Type has
+        return std::ranges::max(chunk.tile_types) <= static_cast<std::uint8_t>(Tile::Type::Wall);
+    }
+} // namespace Tactics
@@ -0,0 +1,395 @@
+#include "Tactics/Core/ValueNoise.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TACTICS_VALUE_NOISE_X86 1
+#include <immintrin.h>
+#endif
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr float OCTAVE_PERSISTENCE = 0.5F;
+        constexpr float OCTAVE_LACUNARITY = 2.0F;
+        constexpr float MIN_AMPLITUDE = 0.0001F;
+        constexpr float HEIGHT_MIN = 0.0F;
+        constexpr float HEIGHT_MAX = 1.0F;
+        constexpr float SMOOTHSTEP_A = 3.0F;
+        constexpr float SMOOTHSTEP_B = 2.0F;
+        constexpr float HASH_NORMALIZER = 16777215.0F;
+
+        constexpr std::uint32_t HASH_PRIME_X = 374761393U;
+        constexpr std::uint32_t HASH_PRIME_Y = 668265263U;
+        constexpr std::uint32_t HASH_SEED_MIX = 0x9E3779B9U;
+        constexpr std::uint32_t HASH_SHIFT_LEFT = 6U;
+        constexpr std::uint32_t HASH_SHIFT_RIGHT = 2U;
+        constexpr std::uint32_t HASH_XOR_SHIFT = 13U;
+        constexpr std::uint32_t HASH_MULTIPLIER = 1274126177U;
+        constexpr std::uint32_t HASH_FINAL_SHIFT = 16U;
+        constexpr std::uint32_t HASH_MASK = 0x00FFFFFFU;
+
+        // Enough for any octave count that still changes a float sum
+        constexpr int MAX_OCTAVES = 32;
+
+        // Per-octave frequency and amplitude, accumulated exactly like the scalar loop
+        struct OctaveTable
+        {
+            std::array<float, MAX_OCTAVES> frequencies{};
+            std::array<float, MAX_OCTAVES> amplitudes{};
+            size_t count = 0;
+            float normalizer = 0.0F;
+        };
+
+        auto build_octave_table(float base_frequency, int octaves) -> OctaveTable
+        {
+            OctaveTable table;
+            float frequency = base_frequency;
+            float amplitude = 1.0F;
+            float max_amplitude = 0.0F;
+            for (int octave = 0; octave < octaves; ++octave)
+            {
+                table.frequencies[static_cast<size_t>(octave)] = frequency;
+                table.amplitudes[static_cast<size_t>(octave)] = amplitude;
+                max_amplitude += amplitude;
+                amplitude *= OCTAVE_PERSISTENCE;
+                frequency *= OCTAVE_LACUNARITY;
+            }
+
+            table.count = static_cast<size_t>(std::max(octaves, 0));
+            table.normalizer = std::max(max_amplitude, MIN_AMPLITUDE);
+            return table;
+        }
+
+#if defined(TACTICS_VALUE_NOISE_X86)
+        // The SIMD helpers mirror ValueNoise::hash and ValueNoise::sample operation for
+        // operation. They are compiled for their instruction set through target attributes
+        // rather than per-file flags, so no inline code built for AVX2 can leak into the scalar
+        // path. Neither target enables FMA, which would fuse multiply-adds and change rounding.
+
+        __attribute__((target("sse4.1"))) inline auto hash_sse41(__m128i x_lanes, __m128i y_lanes,
+                                                                  std::uint32_t seed) -> __m128
+        {
+            const __m128i prime_x = _mm_set1_epi32(static_cast<int>(HASH_PRIME_X));
+            const __m128i prime_y = _mm_set1_epi32(static_cast<int>(HASH_PRIME_Y));
+            const __m128i seed_mix = _mm_set1_epi32(static_cast<int>(seed + HASH_SEED_MIX));
+            const __m128i multiplier = _mm_set1_epi32(static_cast<int>(HASH_MULTIPLIER));
+            const __m128i mask = _mm_set1_epi32(static_cast<int>(HASH_MASK));
+
+            __m128i hash_value =
+                _mm_add_epi32(_mm_mullo_epi32(x_lanes, prime_x), _mm_mullo_epi32(y_lanes, prime_y));
+            const __m128i mix =
+                _mm_add_epi32(_mm_add_epi32(seed_mix, _mm_slli_epi32(hash_value, HASH_SHIFT_LEFT)),
+                              _mm_srli_epi32(hash_value, HASH_SHIFT_RIGHT));
+            hash_value = _mm_xor_si128(hash_value, mix);
+            hash_value = _mm_mullo_epi32(
+                _mm_xor_si128(hash_value, _mm_srli_epi32(hash_value, HASH_XOR_SHIFT)), multiplier);
+            hash_value = _mm_xor_si128(hash_value, _mm_srli_epi32(hash_value, HASH_FINAL_SHIFT));
+            return _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(hash_value, mask)),
+                              _mm_set1_ps(HASH_NORMALIZER));
+        }
+
+        __attribute__((target("sse4.1"))) inline auto smoothstep_sse41(__m128 factor) -> __m128
+        {
+            const __m128 smooth_a = _mm_set1_ps(SMOOTHSTEP_A);
+            const __m128 smooth_b = _mm_set1_ps(SMOOTHSTEP_B);
+            return _mm_mul_ps(_mm_mul_ps(factor, factor),
+                              _mm_sub_ps(smooth_a, _mm_mul_ps(smooth_b, factor)));
+        }
+
+        __attribute__((target("sse4.1"))) inline auto lerp_sse41(__m128 value_start,
+                                                                 __m128 value_end, __m128 factor)
+            -> __m128
+        {
+            return _mm_add_ps(value_start, _mm_mul_ps(_mm_sub_ps(value_end, value_start), factor));
+        }
+
+        __attribute__((target("sse4.1"))) inline auto sample_sse41(__m128 sample_x, __m128 sample_y,
+                                                                    std::uint32_t seed) -> __m128
+        {
+            const __m128i x_floor = _mm_cvttps_epi32(_mm_floor_ps(sample_x));
+            const __m128i y_floor = _mm_cvttps_epi32(_mm_floor_ps(sample_y));
+            const __m128i x_next = _mm_add_epi32(x_floor, _mm_set1_epi32(1));
+            const __m128i y_next = _mm_add_epi32(y_floor, _mm_set1_epi32(1));
+
+            const __m128 x_weight =
+                smoothstep_sse41(_mm_sub_ps(sample_x, _mm_cvtepi32_ps(x_floor)));
+            const __m128 y_weight =
+                smoothstep_sse41(_mm_sub_ps(sample_y, _mm_cvtepi32_ps(y_floor)));
+
+            const __m128 interp_x0 = lerp_sse41(hash_sse41(x_floor, y_floor, seed),
+                                                hash_sse41(x_next, y_floor, seed), x_weight);
+            const __m128 interp_x1 = lerp_sse41(hash_sse41(x_floor, y_next, seed),
+                                                hash_sse41(x_next, y_next, seed), x_weight);
+            return lerp_sse41(interp_x0, interp_x1, y_weight);
+        }
+
+        __attribute__((target("avx2"))) inline auto hash_avx2(__m256i x_lanes, __m256i y_lanes,
+                                                               std::uint32_t seed) -> __m256
+        {
+            const __m256i prime_x = _mm256_set1_epi32(static_cast<int>(HASH_PRIME_X));
+            const __m256i prime_y = _mm256_set1_epi32(static_cast<int>(HASH_PRIME_Y));
+            const __m256i seed_mix = _mm256_set1_epi32(static_cast<int>(seed + HASH_SEED_MIX));
+            const __m256i multiplier = _mm256_set1_epi32(static_cast<int>(HASH_MULTIPLIER));
+            const __m256i mask = _mm256_set1_epi32(static_cast<int>(HASH_MASK));
+
+            __m256i hash_value = _mm256_add_epi32(_mm256_mullo_epi32(x_lanes, prime_x),
+                                                  _mm256_mullo_epi32(y_lanes, prime_y));
+            const __m256i mix = _mm256_add_epi32(
+                _mm256_add_epi32(seed_mix, _mm256_slli_epi32(hash_value, HASH_SHIFT_LEFT)),
+                _mm256_srli_epi32(hash_value, HASH_SHIFT_RIGHT));
+            hash_value = _mm256_xor_si256(hash_value, mix);
+            hash_value = _mm256_mullo_epi32(
+                _mm256_xor_si256(hash_value, _mm256_srli_epi32(hash_value, HASH_XOR_SHIFT)),
+                multiplier);
+            hash_value =
+                _mm256_xor_si256(hash_value, _mm256_srli_epi32(hash_value, HASH_FINAL_SHIFT));
+            return _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(hash_value, mask)),
+                                 _mm256_set1_ps(HASH_NORMALIZER));
+        }
+
+        __attribute__((target("avx2"))) inline auto smoothstep_avx2(__m256 factor) -> __m256
+        {
+            const __m256 smooth_a = _mm256_set1_ps(SMOOTHSTEP_A);
+            const __m256 smooth_b = _mm256_set1_ps(SMOOTHSTEP_B);
+            return _mm256_mul_ps(_mm256_mul_ps(factor, factor),
+                                 _mm256_sub_ps(smooth_a, _mm256_mul_ps(smooth_b, factor)));
+        }
+
+        __attribute__((target("avx2"))) inline auto lerp_avx2(__m256 value_start, __m256 value_end,
+                                                               __m256 factor) -> __m256
+        {
+            return _mm256_add_ps(value_start,
+                                 _mm256_mul_ps(_mm256_sub_ps(value_end, value_start), factor));
+        }
+
+        __attribute__((target("avx2"))) inline auto sample_avx2(__m256 sample_x, __m256 sample_y,
+                                                                 std::uint32_t seed) -> __m256
+        {
+            const __m256i x_floor = _mm256_cvttps_epi32(_mm256_floor_ps(sample_x));
+            const __m256i y_floor = _mm256_cvttps_epi32(_mm256_floor_ps(sample_y));
+            const __m256i x_next = _mm256_add_epi32(x_floor, _mm256_set1_epi32(1));
+            const __m256i y_next = _mm256_add_epi32(y_floor, _mm256_set1_epi32(1));
+
+            const __m256 x_weight =
+                smoothstep_avx2(_mm256_sub_ps(sample_x, _mm256_cvtepi32_ps(x_floor)));
+            const __m256 y_weight =
+                smoothstep_avx2(_mm256_sub_ps(sample_y, _mm256_cvtepi32_ps(y_floor)));
+
+            const __m256 interp_x0 = lerp_avx2(hash_avx2(x_floor, y_floor, seed),
+                                               hash_avx2(x_next, y_floor, seed), x_weight);
+            const __m256 interp_x1 = lerp_avx2(hash_avx2(x_floor, y_next, seed),
+                                               hash_avx2(x_next, y_next, seed), x_weight);
+            return lerp_avx2(interp_x0, interp_x1, y_weight);
+        }
+#endif
+    } // namespace
+
+    ValueNoise::ValueNoise(int seed)
+        : m_seed(static_cast<std::uint32_t>(seed)), m_backend(detect_backend())
+    {
+    }
+
+    auto ValueNoise::sample(float x_pos, float y_pos) const -> float
+    {
+        const int x_floor = static_cast<int>(std::floor(x_pos));
+        const int y_floor = static_cast<int>(std::floor(y_pos));
+        const int x_next = x_floor + 1;
+        const int y_next = y_floor + 1;
+
+        const float x_weight = x_pos - static_cast<float>(x_floor);
+        const float y_weight = y_pos - static_cast<float>(y_floor);
+
+        const float value_00 = hash(x_floor, y_floor);
+        const float value_10 = hash(x_next, y_floor);
+        const float value_01 = hash(x_floor, y_next);
+        const float value_11 = hash(x_next, y_next);
+
+        const auto smoothstep = [](float factor) -> float
+        { return factor * factor * (SMOOTHSTEP_A - (SMOOTHSTEP_B * factor)); };
+        const auto lerp = [](float value_start, float value_end, float factor) -> float
+        { return value_start + ((value_end - value_start) * factor); };
+
+        const float interp_x0 = lerp(value_00, value_10, smoothstep(x_weight));
+        const float interp_x1 = lerp(value_01, value_11, smoothstep(x_weight));
+        return lerp(interp_x0, interp_x1, smoothstep(y_weight));
+    }
+
+    auto ValueNoise::hash(int x_pos, int y_pos) const -> float
+    {
+        std::uint32_t hash_value = (static_cast<std::uint32_t>(x_pos) * HASH_PRIME_X) +
+                                   (static_cast<std::uint32_t>(y_pos) * HASH_PRIME_Y);
+        hash_value ^= m_seed + HASH_SEED_MIX + (hash_value << HASH_SHIFT_LEFT) +
+                      (hash_value >> HASH_SHIFT_RIGHT);
+        hash_value = (hash_value ^ (hash_value >> HASH_XOR_SHIFT)) * HASH_MULTIPLIER;
+        hash_value ^= hash_value >> HASH_FINAL_SHIFT;
+        return static_cast<float>(hash_value & HASH_MASK) / HASH_NORMALIZER;
+    }
+
+    void ValueNoise::fractal_row(int y_pos, int x_begin, std::span<float> out,
+                                 float base_frequency, int octaves) const
+    {
+        if (octaves > MAX_OCTAVES)
+        {
+            fractal_row_scalar(y_pos, x_begin, out, base_frequency, octaves);
+            return;
+        }
+
+        switch (m_backend)
+        {
+        case Backend::AVX2:
+            fractal_row_avx2(y_pos, x_begin, out, base_frequency, octaves);
+            return;
+        case Backend::SSE41:
+            fractal_row_sse41(y_pos, x_begin, out, base_frequency, octaves);
+            return;
+        case Backend::Scalar:
+            break;
+        }
+
+        fractal_row_scalar(y_pos, x_begin, out, base_frequency, octaves);
+    }
+
+    auto ValueNoise::detect_backend() -> Backend
+    {
+#if defined(TACTICS_VALUE_NOISE_X86)
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return Backend::AVX2;
+        }
+
+        if (__builtin_cpu_supports("sse4.1"))
+        {
+            return Backend::SSE41;
+        }
+#endif
+
+        return Backend::Scalar;
+    }
+
+    void ValueNoise::set_backend(Backend backend)
+    {
+        m_backend = std::min(backend, detect_backend());
+    }
+
+    auto ValueNoise::get_backend() const -> Backend
+    {
+        return m_backend;
+    }
+
+    void ValueNoise::fractal_row_scalar(int y_pos, int x_begin, std::span<float> out,
+                                        float base_frequency, int octaves) const
+    {
+        for (size_t index = 0; index < out.size(); ++index)
+        {
+            const int x_pos = x_begin + static_cast<int>(index);
+            float frequency = base_frequency;
+            float amplitude = 1.0F;
+            float value = 0.0F;
+            float max_amplitude = 0.0F;
+
+            for (int octave = 0; octave < octaves; ++octave)
+            {
+                const float sample_x = static_cast<float>(x_pos) * frequency;
+                const float sample_y = static_cast<float>(y_pos) * frequency;
+
+                value += sample(sample_x, sample_y) * amplitude;
+                max_amplitude += amplitude;
+
+                amplitude *= OCTAVE_PERSISTENCE;
+                frequency *= OCTAVE_LACUNARITY;
+            }
+
+            value = value / std::max(max_amplitude, MIN_AMPLITUDE);
+            out[index] = std::clamp(value, HEIGHT_MIN, HEIGHT_MAX);
+        }
+    }
+
+#if defined(TACTICS_VALUE_NOISE_X86)
+    __attribute__((target("sse4.1"))) void
+    ValueNoise::fractal_row_sse41(int y_pos, int x_begin, std::span<float> out,
+                                  float base_frequency, int octaves) const
+    {
+        constexpr size_t LANES = 4;
+        const OctaveTable table = build_octave_table(base_frequency, octaves);
+        const __m128 lane_offsets = _mm_setr_ps(0.0F, 1.0F, 2.0F, 3.0F);
+        const __m128 y_value = _mm_set1_ps(static_cast<float>(y_pos));
+
+        size_t index = 0;
+        for (; index + LANES <= out.size(); index += LANES)
+        {
+            // Exact for any coordinate a grid can have, so equal to converting each x
+            const __m128 x_value = _mm_add_ps(
+                _mm_set1_ps(static_cast<float>(x_begin + static_cast<int>(index))), lane_offsets);
+            __m128 value = _mm_setzero_ps();
+
+            for (size_t octave = 0; octave < table.count; ++octave)
+            {
+                const __m128 frequency = _mm_set1_ps(table.frequencies[octave]);
+                const __m128 noise = sample_sse41(_mm_mul_ps(x_value, frequency),
+                                                  _mm_mul_ps(y_value, frequency), m_seed);
+                value = _mm_add_ps(value, _mm_mul_ps(noise, _mm_set1_ps(table.amplitudes[octave])));
+            }
+
+            value = _mm_div_ps(value, _mm_set1_ps(table.normalizer));
+            value = _mm_min_ps(_mm_max_ps(value, _mm_set1_ps(HEIGHT_MIN)), _mm_set1_ps(HEIGHT_MAX));
+            _mm_storeu_ps(&out[index], value);
+        }
+
+        fractal_row_scalar(y_pos, x_begin + static_cast<int>(index), out.subspan(index),
+                           base_frequency, octaves);
+    }
+
+    __attribute__((target("avx2"))) void
+    ValueNoise::fractal_row_avx2(int y_pos, int x_begin, std::span<float> out,
+                                 float base_frequency, int octaves) const
+    {
+        constexpr size_t LANES = 8;
+        const OctaveTable table = build_octave_table(base_frequency, octaves);
+        const __m256 lane_offsets =
+            _mm256_setr_ps(0.0F, 1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F);
+        const __m256 y_value = _mm256_set1_ps(static_cast<float>(y_pos));
+
+        size_t index = 0;
+        for (; index + LANES <= out.size(); index += LANES)
+        {
+            const __m256 x_value = _mm256_add_ps(
+                _mm256_set1_ps(static_cast<float>(x_begin + static_cast<int>(index))),
+                lane_offsets);
+            __m256 value = _mm256_setzero_ps();
+
+            for (size_t octave = 0; octave < table.count; ++octave)
+            {
+                const __m256 frequency = _mm256_set1_ps(table.frequencies[octave]);
+                const __m256 noise = sample_avx2(_mm256_mul_ps(x_value, frequency),
+                                                 _mm256_mul_ps(y_value, frequency), m_seed);
+                const __m256 amplitude = _mm256_set1_ps(table.amplitudes[octave]);
+                value = _mm256_add_ps(value, _mm256_mul_ps(noise, amplitude));
+            }
+
+            value = _mm256_div_ps(value, _mm256_set1_ps(table.normalizer));
+            value = _mm256_min_ps(_mm256_max_ps(value, _mm256_set1_ps(HEIGHT_MIN)),
+                                  _mm256_set1_ps(HEIGHT_MAX));
+            _mm256_storeu_ps(&out[index], value);
+        }
+
+        fractal_row_scalar(y_pos, x_begin + static_cast<int>(index), out.subspan(index),
+                           base_frequency, octaves);
+    }
+#else
+    void ValueNoise::fractal_row_sse41(int y_pos, int x_begin, std::span<float> out,
+                                       float base_frequency, int octaves) const
+    {
+        fractal_row_scalar(y_pos, x_begin, out, base_frequency, octaves);
+    }
+
+    void ValueNoise::fractal_row_avx2(int y_pos, int x_begin, std::span<float> out,
+                                      float base_frequency, int octaves) const
+    {
+        fractal_row_scalar(y_pos, x_begin, out, base_frequency, octaves);
+    }
+#endif
+} // namespace Tactics
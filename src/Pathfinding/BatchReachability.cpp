@@ -0,0 +1,98 @@
+#include "Tactics/Pathfinding/BatchReachability.hpp"
+
+#include <bit>
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr std::size_t BITS_PER_WORD = 64;
+    } // namespace
+
+    void TileBitset::reset(std::size_t tile_count)
+    {
+        m_words.assign((tile_count + BITS_PER_WORD - 1) / BITS_PER_WORD, 0U);
+        m_size = tile_count;
+    }
+
+    void TileBitset::set(std::size_t index)
+    {
+        m_words[index / BITS_PER_WORD] |= std::uint64_t{1} << (index % BITS_PER_WORD);
+    }
+
+    auto TileBitset::test(std::size_t index) const -> bool
+    {
+        return ((m_words[index / BITS_PER_WORD] >> (index % BITS_PER_WORD)) & 1U) != 0U;
+    }
+
+    auto TileBitset::count() const -> std::size_t
+    {
+        std::size_t total = 0;
+        for (const std::uint64_t word : m_words)
+        {
+            total += static_cast<std::size_t>(std::popcount(word));
+        }
+
+        return total;
+    }
+
+    auto TileBitset::size() const -> std::size_t
+    {
+        return m_size;
+    }
+
+    BatchReachability::BatchReachability(std::size_t worker_count)
+        : m_worker_count(worker_count)
+    {
+    }
+
+    void BatchReachability::compute(const Grid &grid, std::span<const ReachabilityQuery> queries,
+                                    const std::vector<bool> &blocked)
+    {
+        m_results.resize(queries.size());
+
+        if (m_pool == nullptr)
+        {
+            m_pool = std::make_unique<ThreadPool>(m_worker_count);
+            m_worker_searches.resize(m_pool->get_worker_count());
+        }
+
+        m_pool->parallel_for(
+            queries.size(),
+            [&](std::size_t item, std::size_t worker)
+            {
+                ReachabilitySearch &search = m_worker_searches[worker];
+                search.compute(grid, queries[item].start, queries[item].move_points, blocked);
+
+                TileBitset &result = m_results[item];
+                const std::span<const int> remaining_move_points =
+                    search.get_remaining_move_points();
+                result.reset(remaining_move_points.size());
+                for (std::size_t index = 0; index < remaining_move_points.size(); ++index)
+                {
+                    if (remaining_move_points[index] >= 0)
+                    {
+                        result.set(index);
+                    }
+                }
+            });
+    }
+
+    auto BatchReachability::get_results() const -> std::span<const TileBitset>
+    {
+        return m_results;
+    }
+
+    auto BatchReachability::is_reachable(const Grid &grid, std::size_t query,
+                                         const Vector2i &position) const -> bool
+    {
+        if (query >= m_results.size() || !grid.is_valid_position(position))
+        {
+            return false;
+        }
+
+        const TileBitset &result = m_results[query];
+        const size_t index = grid.index_of(position.x, position.y);
+        return index < result.size() && result.test(index);
+    }
+} // namespace Tactics
@@ -0,0 +1,151 @@
+#include "Tactics/Pathfinding/FlowField.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr std::array<Vector2i, 4> DIRECTIONS = {Vector2i{0, -1}, Vector2i{0, 1},
+                                                        Vector2i{-1, 0}, Vector2i{1, 0}};
+    } // namespace
+
+    auto FlowField::update(const Grid &grid, std::span<const Vector2i> goals,
+                           const std::vector<bool> &blocked, std::uint64_t occupancy_revision)
+        -> bool
+    {
+        if (m_valid && m_grid_revision == grid.get_revision() &&
+            m_occupancy_revision == occupancy_revision && std::ranges::equal(m_goals, goals))
+        {
+            return false;
+        }
+
+        compute(grid, goals, blocked);
+        m_goals.assign(goals.begin(), goals.end());
+        m_grid_revision = grid.get_revision();
+        m_occupancy_revision = occupancy_revision;
+        m_valid = true;
+        return true;
+    }
+
+    void FlowField::compute(const Grid &grid, std::span<const Vector2i> goals,
+                            const std::vector<bool> &blocked)
+    {
+        const std::span<const std::int8_t> move_costs = grid.get_move_costs();
+        m_distances.assign(move_costs.size(), -1);
+        m_directions.assign(move_costs.size(), NO_DIRECTION);
+        m_frontier.reset(0);
+        m_valid = false;
+
+        // A mask that does not match the grid blocks nothing
+        const bool use_blocked = blocked.size() == move_costs.size();
+
+        for (const auto &goal : goals)
+        {
+            if (!grid.is_valid_position(goal))
+            {
+                continue;
+            }
+
+            const size_t goal_index = grid.index_of(goal.x, goal.y);
+            if (move_costs[goal_index] < 0 || m_distances[goal_index] == 0)
+            {
+                continue;
+            }
+
+            m_distances[goal_index] = 0;
+            m_frontier.push(goal, 0);
+        }
+
+        // Searching backwards from the goals: stepping from neighbor into current costs current
+        while (const auto entry = m_frontier.pop())
+        {
+            const Vector2i current = entry->value;
+            const size_t current_index = grid.index_of(current.x, current.y);
+            if (entry->priority > m_distances[current_index])
+            {
+                // Stale entry: a cheaper route to this tile was already expanded
+                continue;
+            }
+
+            const int step_cost = move_costs[current_index];
+            for (size_t direction = 0; direction < DIRECTIONS.size(); ++direction)
+            {
+                const Vector2i neighbor = current + DIRECTIONS[direction];
+                if (!grid.is_valid_position(neighbor))
+                {
+                    continue;
+                }
+
+                const size_t neighbor_index = grid.index_of(neighbor.x, neighbor.y);
+                if (move_costs[neighbor_index] < 0)
+                {
+                    continue;
+                }
+
+                const int neighbor_distance = entry->priority + step_cost;
+                const int known_distance = m_distances[neighbor_index];
+                if (known_distance >= 0 && neighbor_distance >= known_distance)
+                {
+                    continue;
+                }
+
+                m_distances[neighbor_index] = neighbor_distance;
+                // Opposite directions are adjacent pairs in DIRECTIONS, so flipping the low bit
+                // gives the step from neighbor back toward current
+                m_directions[neighbor_index] = static_cast<std::uint8_t>(direction ^ 1U);
+
+                // Occupied tiles can be left but not passed through
+                if (!use_blocked || !blocked[neighbor_index])
+                {
+                    m_frontier.push(neighbor, neighbor_distance);
+                }
+            }
+        }
+    }
+
+    void FlowField::invalidate()
+    {
+        m_distances.clear();
+        m_directions.clear();
+        m_valid = false;
+    }
+
+    auto FlowField::get_distance(const Grid &grid, const Vector2i &position) const -> int
+    {
+        if (!grid.is_valid_position(position) || m_distances.empty())
+        {
+            return -1;
+        }
+
+        return m_distances[grid.index_of(position.x, position.y)];
+    }
+
+    auto FlowField::get_next_step(const Grid &grid, const Vector2i &position) const
+        -> std::optional<Vector2i>
+    {
+        if (!grid.is_valid_position(position) || m_directions.empty())
+        {
+            return std::nullopt;
+        }
+
+        const std::uint8_t direction = m_directions[grid.index_of(position.x, position.y)];
+        if (direction == NO_DIRECTION)
+        {
+            return std::nullopt;
+        }
+
+        return position + DIRECTIONS[direction];
+    }
+
+    auto FlowField::get_distances() const -> std::span<const int>
+    {
+        return m_distances;
+    }
+
+    auto FlowField::has_result() const -> bool
+    {
+        return !m_distances.empty();
+    }
+} // namespace Tactics
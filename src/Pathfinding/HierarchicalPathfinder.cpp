@@ -0,0 +1,551 @@
+#include "Tactics/Pathfinding/HierarchicalPathfinder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <limits>
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr std::array<Vector2i, 4> DIRECTIONS = {Vector2i{0, -1}, Vector2i{0, 1},
+                                                        Vector2i{-1, 0}, Vector2i{1, 0}};
+
+        // Border stretches up to this length get a single entrance in the middle,
+        // longer ones get one at each end
+        constexpr int MAX_SINGLE_ENTRANCE_LENGTH = 6;
+
+        constexpr std::uint8_t NO_PARENT = 0xFF;
+
+        auto manhattan_distance(const Vector2i &from, const Vector2i &to) -> int
+        {
+            return std::abs(to.x - from.x) + std::abs(to.y - from.y);
+        }
+
+        auto local_index_of(const Recti &bounds, const Vector2i &position) -> size_t
+        {
+            return (static_cast<size_t>(position.y - bounds.y) *
+                    static_cast<size_t>(HierarchicalPathfinder::CLUSTER_SIZE)) +
+                   static_cast<size_t>(position.x - bounds.x);
+        }
+    } // namespace
+
+    void HierarchicalPathfinder::update(const Grid &grid)
+    {
+        const auto cluster_count = static_cast<size_t>(grid.get_chunk_count());
+        if (grid.get_width() != m_width || grid.get_height() != m_height ||
+            m_clusters.size() != cluster_count)
+        {
+            m_width = grid.get_width();
+            m_height = grid.get_height();
+            m_clusters_x = grid.get_chunks_x();
+            m_clusters_y = grid.get_chunks_y();
+            // Revision 0 is never handed out by Grid, so every cluster starts dirty
+            m_clusters.assign(cluster_count, Cluster{});
+        }
+
+        // A changed cluster also changes the far side of its shared borders
+        std::vector<bool> affected(cluster_count, false);
+        for (int cluster_y = 0; cluster_y < m_clusters_y; ++cluster_y)
+        {
+            for (int cluster_x = 0; cluster_x < m_clusters_x; ++cluster_x)
+            {
+                if (cluster_at(cluster_x, cluster_y).revision ==
+                    grid.get_chunk_revision(cluster_x, cluster_y))
+                {
+                    continue;
+                }
+
+                affected[(static_cast<size_t>(cluster_y) * static_cast<size_t>(m_clusters_x)) +
+                         static_cast<size_t>(cluster_x)] = true;
+                for (const auto &direction : DIRECTIONS)
+                {
+                    const int neighbor_x = cluster_x + direction.x;
+                    const int neighbor_y = cluster_y + direction.y;
+                    if (neighbor_x < 0 || neighbor_y < 0 || neighbor_x >= m_clusters_x ||
+                        neighbor_y >= m_clusters_y)
+                    {
+                        continue;
+                    }
+
+                    affected[(static_cast<size_t>(neighbor_y) *
+                              static_cast<size_t>(m_clusters_x)) +
+                             static_cast<size_t>(neighbor_x)] = true;
+                }
+            }
+        }
+
+        m_rebuilt_cluster_count = 0;
+        for (int cluster_y = 0; cluster_y < m_clusters_y; ++cluster_y)
+        {
+            for (int cluster_x = 0; cluster_x < m_clusters_x; ++cluster_x)
+            {
+                if (affected[(static_cast<size_t>(cluster_y) * static_cast<size_t>(m_clusters_x)) +
+                             static_cast<size_t>(cluster_x)])
+                {
+                    rebuild_cluster_nodes(grid, cluster_x, cluster_y);
+                    ++m_rebuilt_cluster_count;
+                }
+            }
+        }
+
+        // Intra edges need the final node sets, so they are built in a second pass
+        for (int cluster_y = 0; cluster_y < m_clusters_y; ++cluster_y)
+        {
+            for (int cluster_x = 0; cluster_x < m_clusters_x; ++cluster_x)
+            {
+                if (affected[(static_cast<size_t>(cluster_y) * static_cast<size_t>(m_clusters_x)) +
+                             static_cast<size_t>(cluster_x)])
+                {
+                    rebuild_cluster_edges(grid, cluster_x, cluster_y);
+                    cluster_at(cluster_x, cluster_y).revision =
+                        grid.get_chunk_revision(cluster_x, cluster_y);
+                }
+            }
+        }
+    }
+
+    auto HierarchicalPathfinder::find_abstract_path(const Grid &grid, const Vector2i &start,
+                                                    const Vector2i &goal)
+        -> std::optional<std::vector<Vector2i>>
+    {
+        if (!grid.is_valid_position(start) || !grid.is_valid_position(goal))
+        {
+            return std::nullopt;
+        }
+
+        if (start == goal)
+        {
+            return std::vector<Vector2i>{start};
+        }
+
+        const std::span<const std::int8_t> move_costs = grid.get_move_costs();
+        if (move_costs[grid.index_of(goal.x, goal.y)] < 0)
+        {
+            return std::nullopt;
+        }
+
+        update(grid);
+
+        // Connect start to the nodes of its cluster (and to goal if they share one)
+        const Vector2i start_cluster = Grid::chunk_of(start);
+        const Vector2i goal_cluster = Grid::chunk_of(goal);
+        m_start_edges.clear();
+        search_cluster(grid, start, false, std::nullopt);
+        for (const auto &node : cluster_at(start_cluster.x, start_cluster.y).nodes)
+        {
+            const int cost = local_cost_at(node);
+            if (cost > 0)
+            {
+                m_start_edges.push_back(Edge{.target = node, .cost = cost});
+            }
+        }
+
+        if (start_cluster == goal_cluster && local_cost_at(goal) >= 0)
+        {
+            m_start_edges.push_back(Edge{.target = goal, .cost = local_cost_at(goal)});
+        }
+
+        // Connect the nodes of the goal's cluster to goal; target holds the node here
+        m_goal_edges.clear();
+        search_cluster(grid, goal, true, std::nullopt);
+        for (const auto &node : cluster_at(goal_cluster.x, goal_cluster.y).nodes)
+        {
+            const int cost = local_cost_at(node);
+            if (cost > 0)
+            {
+                m_goal_edges.push_back(Edge{.target = node, .cost = cost});
+            }
+        }
+
+        prepare_abstract_search(grid);
+
+        const size_t start_index = grid.index_of(start.x, start.y);
+        m_abstract_open_stamp[start_index] = m_generation;
+        m_abstract_cost[start_index] = 0;
+        m_abstract_parent[start_index] = start;
+        m_abstract_open.reset(manhattan_distance(start, goal));
+        m_abstract_open.push(start, manhattan_distance(start, goal));
+
+        const auto relax = [&](const Vector2i &current, int current_cost, const Edge &edge)
+        {
+            const size_t target_index = grid.index_of(edge.target.x, edge.target.y);
+            if (m_abstract_closed_stamp[target_index] == m_generation)
+            {
+                return;
+            }
+
+            const int target_cost = current_cost + edge.cost;
+            if (m_abstract_open_stamp[target_index] == m_generation &&
+                target_cost >= m_abstract_cost[target_index])
+            {
+                return;
+            }
+
+            m_abstract_open_stamp[target_index] = m_generation;
+            m_abstract_cost[target_index] = target_cost;
+            m_abstract_parent[target_index] = current;
+            m_abstract_open.push(edge.target, target_cost + manhattan_distance(edge.target, goal));
+        };
+
+        while (const auto entry = m_abstract_open.pop())
+        {
+            const Vector2i current = entry->value;
+            const size_t current_index = grid.index_of(current.x, current.y);
+            if (m_abstract_closed_stamp[current_index] == m_generation)
+            {
+                continue;
+            }
+
+            m_abstract_closed_stamp[current_index] = m_generation;
+
+            if (current == goal)
+            {
+                std::vector<Vector2i> waypoints;
+                Vector2i waypoint = goal;
+                while (waypoint != start)
+                {
+                    waypoints.push_back(waypoint);
+                    waypoint = m_abstract_parent[grid.index_of(waypoint.x, waypoint.y)];
+                }
+
+                waypoints.push_back(start);
+                std::ranges::reverse(waypoints);
+                return waypoints;
+            }
+
+            const int current_cost = m_abstract_cost[current_index];
+            if (current == start)
+            {
+                for (const auto &edge : m_start_edges)
+                {
+                    relax(current, current_cost, edge);
+                }
+            }
+
+            if (const auto *edges = node_edges(current); edges != nullptr)
+            {
+                for (const auto &edge : *edges)
+                {
+                    relax(current, current_cost, edge);
+                }
+            }
+
+            const auto goal_edge =
+                std::ranges::find_if(m_goal_edges, [&current](const Edge &edge) -> bool
+                                     { return edge.target == current; });
+            if (goal_edge != m_goal_edges.end())
+            {
+                relax(current, current_cost, Edge{.target = goal, .cost = goal_edge->cost});
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    auto HierarchicalPathfinder::refine_segment(const Grid &grid, const Vector2i &from,
+                                                const Vector2i &to) -> std::optional<Path>
+    {
+        if (!grid.is_valid_position(from) || !grid.is_valid_position(to))
+        {
+            return std::nullopt;
+        }
+
+        const std::int8_t to_cost = grid.get_move_costs()[grid.index_of(to.x, to.y)];
+        if (Grid::chunk_of(from) != Grid::chunk_of(to))
+        {
+            // Segments between clusters are always a single step across an entrance
+            if (manhattan_distance(from, to) != 1 || to_cost < 0)
+            {
+                return std::nullopt;
+            }
+
+            return Path{.steps = {to}, .cost = to_cost};
+        }
+
+        search_cluster(grid, from, false, to);
+        const int cost = local_cost_at(to);
+        if (cost < 0)
+        {
+            return std::nullopt;
+        }
+
+        const Recti bounds = grid.get_chunk(Grid::chunk_of(from).x, Grid::chunk_of(from).y).bounds;
+        Path path;
+        path.cost = cost;
+        Vector2i current = to;
+        while (current != from)
+        {
+            path.steps.push_back(current);
+            current = current - DIRECTIONS[m_local_parent[local_index_of(bounds, current)]];
+        }
+
+        std::ranges::reverse(path.steps);
+        return path;
+    }
+
+    auto HierarchicalPathfinder::find_path(const Grid &grid, const Vector2i &start,
+                                           const Vector2i &goal) -> std::optional<Path>
+    {
+        const auto waypoints = find_abstract_path(grid, start, goal);
+        if (!waypoints.has_value())
+        {
+            return std::nullopt;
+        }
+
+        Path path;
+        for (size_t index = 1; index < waypoints->size(); ++index)
+        {
+            auto segment = refine_segment(grid, (*waypoints)[index - 1], (*waypoints)[index]);
+            if (!segment.has_value())
+            {
+                return std::nullopt;
+            }
+
+            path.steps.insert(path.steps.end(), segment->steps.begin(), segment->steps.end());
+            path.cost += segment->cost;
+        }
+
+        return path;
+    }
+
+    auto HierarchicalPathfinder::get_abstract_node_count() const -> int
+    {
+        size_t node_count = 0;
+        for (const auto &cluster : m_clusters)
+        {
+            node_count += cluster.nodes.size();
+        }
+
+        return static_cast<int>(node_count);
+    }
+
+    auto HierarchicalPathfinder::get_rebuilt_cluster_count() const -> int
+    {
+        return m_rebuilt_cluster_count;
+    }
+
+    auto HierarchicalPathfinder::cluster_at(int cluster_x, int cluster_y) -> Cluster &
+    {
+        return m_clusters[(static_cast<size_t>(cluster_y) * static_cast<size_t>(m_clusters_x)) +
+                          static_cast<size_t>(cluster_x)];
+    }
+
+    auto HierarchicalPathfinder::node_edges(const Vector2i &position) -> const std::vector<Edge> *
+    {
+        const Vector2i cluster_coord = Grid::chunk_of(position);
+        const Cluster &cluster = cluster_at(cluster_coord.x, cluster_coord.y);
+        const auto node = std::ranges::find(cluster.nodes, position);
+        if (node == cluster.nodes.end())
+        {
+            return nullptr;
+        }
+
+        return &cluster.edges[static_cast<size_t>(std::distance(cluster.nodes.begin(), node))];
+    }
+
+    void HierarchicalPathfinder::rebuild_cluster_nodes(const Grid &grid, int cluster_x,
+                                                       int cluster_y)
+    {
+        Cluster &cluster = cluster_at(cluster_x, cluster_y);
+        cluster.nodes.clear();
+        cluster.edges.clear();
+
+        const Recti bounds = grid.get_chunk(cluster_x, cluster_y).bounds;
+        for (const auto &direction : DIRECTIONS)
+        {
+            add_border_entrances(grid, cluster, bounds, direction);
+        }
+    }
+
+    void HierarchicalPathfinder::rebuild_cluster_edges(const Grid &grid, int cluster_x,
+                                                       int cluster_y)
+    {
+        Cluster &cluster = cluster_at(cluster_x, cluster_y);
+        for (size_t source = 0; source < cluster.nodes.size(); ++source)
+        {
+            search_cluster(grid, cluster.nodes[source], false, std::nullopt);
+            for (size_t target = 0; target < cluster.nodes.size(); ++target)
+            {
+                const int cost = local_cost_at(cluster.nodes[target]);
+                if (target != source && cost >= 0)
+                {
+                    cluster.edges[source].push_back(
+                        Edge{.target = cluster.nodes[target], .cost = cost});
+                }
+            }
+        }
+    }
+
+    void HierarchicalPathfinder::add_border_entrances(const Grid &grid, Cluster &cluster,
+                                                      const Recti &bounds,
+                                                      const Vector2i &direction)
+    {
+        // Walk the border tiles on the side facing direction
+        const bool vertical_border = direction.x != 0;
+        const int length = vertical_border ? bounds.height : bounds.width;
+        Vector2i first;
+        if (vertical_border)
+        {
+            first = Vector2i(direction.x > 0 ? bounds.right() - 1 : bounds.left(), bounds.top());
+        }
+        else
+        {
+            first = Vector2i(bounds.left(), direction.y > 0 ? bounds.bottom() - 1 : bounds.top());
+        }
+
+        const Vector2i step = vertical_border ? Vector2i(0, 1) : Vector2i(1, 0);
+        const std::span<const std::int8_t> move_costs = grid.get_move_costs();
+
+        const auto is_open = [&](int offset) -> bool
+        {
+            const Vector2i inside = first + (step * offset);
+            const Vector2i outside = inside + direction;
+            return grid.is_valid_position(outside) &&
+                   move_costs[grid.index_of(inside.x, inside.y)] >= 0 &&
+                   move_costs[grid.index_of(outside.x, outside.y)] >= 0;
+        };
+
+        const auto add_transition = [&](int offset)
+        {
+            const Vector2i inside = first + (step * offset);
+            const Vector2i outside = inside + direction;
+            const Edge crossing{.target = outside,
+                                .cost = move_costs[grid.index_of(outside.x, outside.y)]};
+
+            // Corner tiles can sit on two borders; keep a single node for them
+            const auto node = std::ranges::find(cluster.nodes, inside);
+            if (node != cluster.nodes.end())
+            {
+                cluster.edges[static_cast<size_t>(std::distance(cluster.nodes.begin(), node))]
+                    .push_back(crossing);
+                return;
+            }
+
+            cluster.nodes.push_back(inside);
+            cluster.edges.push_back({crossing});
+        };
+
+        int offset = 0;
+        while (offset < length)
+        {
+            if (!is_open(offset))
+            {
+                ++offset;
+                continue;
+            }
+
+            const int segment_start = offset;
+            while (offset < length && is_open(offset))
+            {
+                ++offset;
+            }
+
+            const int segment_end = offset - 1;
+            if (segment_end - segment_start + 1 <= MAX_SINGLE_ENTRANCE_LENGTH)
+            {
+                add_transition((segment_start + segment_end) / 2);
+            }
+            else
+            {
+                add_transition(segment_start);
+                add_transition(segment_end);
+            }
+        }
+    }
+
+    void HierarchicalPathfinder::search_cluster(const Grid &grid, const Vector2i &source,
+                                                bool reverse,
+                                                const std::optional<Vector2i> &stop_at)
+    {
+        const Vector2i cluster_coord = Grid::chunk_of(source);
+        const ConstGridChunk chunk = grid.get_chunk(cluster_coord.x, cluster_coord.y);
+        m_search_bounds = chunk.bounds;
+
+        m_local_cost.assign(Grid::CHUNK_TILE_COUNT, -1);
+        m_local_parent.assign(Grid::CHUNK_TILE_COUNT, NO_PARENT);
+        m_local_open.reset(CLUSTER_SIZE);
+
+        m_local_cost[local_index_of(chunk.bounds, source)] = 0;
+        m_local_open.push(source, 0);
+
+        while (const auto entry = m_local_open.pop())
+        {
+            const Vector2i current = entry->value;
+            const size_t current_index = local_index_of(chunk.bounds, current);
+            if (entry->priority > m_local_cost[current_index])
+            {
+                // Stale entry: this tile was already expanded with a lower cost
+                continue;
+            }
+
+            if (stop_at.has_value() && current == stop_at.value())
+            {
+                return;
+            }
+
+            for (size_t direction = 0; direction < DIRECTIONS.size(); ++direction)
+            {
+                const Vector2i neighbor = current + DIRECTIONS[direction];
+                if (!chunk.bounds.contains(neighbor))
+                {
+                    continue;
+                }
+
+                const size_t neighbor_index = local_index_of(chunk.bounds, neighbor);
+                const int neighbor_tile_cost = chunk.move_costs[neighbor_index];
+                if (neighbor_tile_cost < 0)
+                {
+                    continue;
+                }
+
+                // Reverse searches price the step from neighbor into current
+                const int step_cost = reverse ? static_cast<int>(chunk.move_costs[current_index])
+                                              : neighbor_tile_cost;
+                const int neighbor_cost = entry->priority + step_cost;
+                const int known_cost = m_local_cost[neighbor_index];
+                if (known_cost >= 0 && neighbor_cost >= known_cost)
+                {
+                    continue;
+                }
+
+                m_local_cost[neighbor_index] = neighbor_cost;
+                m_local_parent[neighbor_index] = static_cast<std::uint8_t>(direction);
+                m_local_open.push(neighbor, neighbor_cost);
+            }
+        }
+    }
+
+    auto HierarchicalPathfinder::local_cost_at(const Vector2i &position) const -> int
+    {
+        if (!m_search_bounds.contains(position))
+        {
+            return -1;
+        }
+
+        return m_local_cost[local_index_of(m_search_bounds, position)];
+    }
+
+    void HierarchicalPathfinder::prepare_abstract_search(const Grid &grid)
+    {
+        const size_t tile_count = grid.get_move_costs().size();
+        if (m_abstract_open_stamp.size() != tile_count)
+        {
+            m_abstract_open_stamp.assign(tile_count, 0U);
+            m_abstract_closed_stamp.assign(tile_count, 0U);
+            m_abstract_cost.assign(tile_count, 0);
+            m_abstract_parent.assign(tile_count, Vector2i{});
+            m_generation = 0;
+        }
+
+        ++m_generation;
+        if (m_generation == std::numeric_limits<std::uint32_t>::max())
+        {
+            // Stamps are about to wrap: clear them once and start over
+            std::ranges::fill(m_abstract_open_stamp, 0U);
+            std::ranges::fill(m_abstract_closed_stamp, 0U);
+            m_generation = 1;
+        }
+    }
+} // namespace Tactics
@@ -0,0 +1,152 @@
+#include "Tactics/Pathfinding/Pathfinder.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <limits>
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr std::array<Vector2i, 4> DIRECTIONS = {Vector2i{0, -1}, Vector2i{0, 1},
+                                                        Vector2i{-1, 0}, Vector2i{1, 0}};
+
+        auto manhattan_distance(const Vector2i &from, const Vector2i &to) -> int
+        {
+            return std::abs(to.x - from.x) + std::abs(to.y - from.y);
+        }
+    } // namespace
+
+    auto Pathfinder::find_path(const Grid &grid, const Vector2i &start, const Vector2i &goal,
+                               const std::vector<bool> &blocked) -> std::optional<Path>
+    {
+        m_expanded_count = 0;
+
+        if (!grid.is_valid_position(start) || !grid.is_valid_position(goal))
+        {
+            return std::nullopt;
+        }
+
+        const std::span<const std::int8_t> move_costs = grid.get_move_costs();
+        const size_t goal_index = grid.index_of(goal.x, goal.y);
+
+        // A mask that does not match the grid blocks nothing
+        const bool use_blocked = blocked.size() == move_costs.size();
+        if (start != goal && ((use_blocked && blocked[goal_index]) || move_costs[goal_index] < 0))
+        {
+            return std::nullopt;
+        }
+
+        prepare(grid);
+
+        const size_t start_index = grid.index_of(start.x, start.y);
+        m_open_stamp[start_index] = m_generation;
+        m_cost_so_far[start_index] = 0;
+        m_parent_direction[start_index] = NO_PARENT;
+        m_open.reset(manhattan_distance(start, goal));
+        m_open.push(start, manhattan_distance(start, goal));
+
+        while (const auto entry = m_open.pop())
+        {
+            const Vector2i current = entry->value;
+            const size_t current_index = grid.index_of(current.x, current.y);
+            if (m_closed_stamp[current_index] == m_generation)
+            {
+                // Stale entry: this node was already expanded with a lower cost
+                continue;
+            }
+
+            m_closed_stamp[current_index] = m_generation;
+            ++m_expanded_count;
+
+            if (current == goal)
+            {
+                return reconstruct_path(grid, start, goal);
+            }
+
+            const int current_cost = m_cost_so_far[current_index];
+
+            for (size_t direction = 0; direction < DIRECTIONS.size(); ++direction)
+            {
+                const Vector2i neighbor = current + DIRECTIONS[direction];
+                if (!grid.is_valid_position(neighbor))
+                {
+                    continue;
+                }
+
+                const size_t neighbor_index = grid.index_of(neighbor.x, neighbor.y);
+                if (m_closed_stamp[neighbor_index] == m_generation ||
+                    (use_blocked && blocked[neighbor_index]))
+                {
+                    continue;
+                }
+
+                const int move_cost = move_costs[neighbor_index];
+                if (move_cost < 0)
+                {
+                    continue;
+                }
+
+                const int neighbor_cost = current_cost + move_cost;
+                if (m_open_stamp[neighbor_index] == m_generation &&
+                    neighbor_cost >= m_cost_so_far[neighbor_index])
+                {
+                    continue;
+                }
+
+                m_open_stamp[neighbor_index] = m_generation;
+                m_cost_so_far[neighbor_index] = neighbor_cost;
+                m_parent_direction[neighbor_index] = static_cast<std::uint8_t>(direction);
+                m_open.push(neighbor, neighbor_cost + manhattan_distance(neighbor, goal));
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    auto Pathfinder::get_expanded_count() const -> int
+    {
+        return m_expanded_count;
+    }
+
+    void Pathfinder::prepare(const Grid &grid)
+    {
+        const size_t tile_count = grid.get_move_costs().size();
+        if (m_open_stamp.size() != tile_count)
+        {
+            m_open_stamp.assign(tile_count, 0U);
+            m_closed_stamp.assign(tile_count, 0U);
+            m_cost_so_far.assign(tile_count, 0);
+            m_parent_direction.assign(tile_count, NO_PARENT);
+            m_generation = 0;
+        }
+
+        ++m_generation;
+        if (m_generation == std::numeric_limits<std::uint32_t>::max())
+        {
+            // Stamps are about to wrap: clear them once and start over
+            std::ranges::fill(m_open_stamp, 0U);
+            std::ranges::fill(m_closed_stamp, 0U);
+            m_generation = 1;
+        }
+    }
+
+    auto Pathfinder::reconstruct_path(const Grid &grid, const Vector2i &start,
+                                      const Vector2i &goal) const -> Path
+    {
+        Path path;
+        path.cost = m_cost_so_far[grid.index_of(goal.x, goal.y)];
+
+        Vector2i current = goal;
+        while (current != start)
+        {
+            path.steps.push_back(current);
+            const std::uint8_t direction = m_parent_direction[grid.index_of(current.x, current.y)];
+            current = current - DIRECTIONS[direction];
+        }
+
+        std::ranges::reverse(path.steps);
+        return path;
+    }
+} // namespace Tactics
@@ -0,0 +1,106 @@
+#include "Tactics/Pathfinding/ReachabilitySearch.hpp"
+
+#include <array>
+
+namespace Tactics
+{
+    namespace
+    {
+        constexpr std::array<Vector2i, 4> DIRECTIONS = {Vector2i{0, -1}, Vector2i{0, 1},
+                                                        Vector2i{-1, 0}, Vector2i{1, 0}};
+    } // namespace
+
+    void ReachabilitySearch::compute(const Grid &grid, const Vector2i &start, int move_points,
+                                     const std::vector<bool> &blocked)
+    {
+        const std::span<const std::int8_t> move_costs = grid.get_move_costs();
+        m_remaining_move_points.assign(move_costs.size(), -1);
+        m_expanded_count = 0;
+
+        // A mask that does not match the grid (e.g. empty before any units are placed) blocks
+        // nothing
+        const bool use_blocked = blocked.size() == move_costs.size();
+
+        if (!grid.is_valid_position(start) || move_points < 0)
+        {
+            return;
+        }
+
+        m_remaining_move_points[grid.index_of(start.x, start.y)] = move_points;
+        m_frontier.reset(move_points);
+        m_frontier.push(start, 0);
+
+        // Priority is move points spent so far, so tiles pop in order of best remaining budget
+        while (const auto entry = m_frontier.pop())
+        {
+            const Vector2i current = entry->value;
+            const int remaining = move_points - entry->priority;
+            if (remaining < m_remaining_move_points[grid.index_of(current.x, current.y)])
+            {
+                // Stale entry: a cheaper route to this tile was already expanded
+                continue;
+            }
+
+            ++m_expanded_count;
+
+            for (const auto &direction : DIRECTIONS)
+            {
+                const Vector2i neighbor = current + direction;
+                if (!grid.is_valid_position(neighbor))
+                {
+                    continue;
+                }
+
+                const size_t neighbor_index = grid.index_of(neighbor.x, neighbor.y);
+                if (use_blocked && blocked[neighbor_index])
+                {
+                    continue;
+                }
+
+                const int cost = move_costs[neighbor_index];
+                if (cost < 0 || cost > remaining)
+                {
+                    continue;
+                }
+
+                const int neighbor_remaining = remaining - cost;
+                if (neighbor_remaining > m_remaining_move_points[neighbor_index])
+                {
+                    m_remaining_move_points[neighbor_index] = neighbor_remaining;
+                    m_frontier.push(neighbor, move_points - neighbor_remaining);
+                }
+            }
+        }
+    }
+
+    void ReachabilitySearch::clear()
+    {
+        m_remaining_move_points.clear();
+        m_expanded_count = 0;
+    }
+
+    auto ReachabilitySearch::get_remaining_move_points() const -> std::span<const int>
+    {
+        return m_remaining_move_points;
+    }
+
+    auto ReachabilitySearch::is_reachable(const Grid &grid, const Vector2i &position) const -> bool
+    {
+        if (!grid.is_valid_position(position) || m_remaining_move_points.empty())
+        {
+            return false;
+        }
+
+        return m_remaining_move_points[grid.index_of(position.x, position.y)] >= 0;
+    }
+
+    auto ReachabilitySearch::has_result() const -> bool
+    {
+        return !m_remaining_move_points.empty();
+    }
+
+    auto ReachabilitySearch::get_expanded_count() const -> int
+    {
+        return m_expanded_count;
+    }
+} // namespace Tactics
@@ -1,10 +1,12 @@
 #include "Tactics/Renderers/GridRenderer.hpp"
 
-#include "SDL3/SDL_stdinc.h"
 #include "Tactics/Components/Tile.hpp"
 #include "Tactics/Core/Rect.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <limits>
 
 namespace Tactics
 {
@@ -18,8 +20,14 @@ namespace Tactics
         constexpr SDL_Color ROAD_COLOR = {105, 105, 105, 255};
         constexpr SDL_Color WALL_COLOR = {64, 64, 64, 255};
         constexpr SDL_Color DEFAULT_COLOR = {128, 128, 128, 255};
+        constexpr SDL_FColor BORDER_COLOR = {0.0F, 0.0F, 0.0F, 1.0F};
 
-        auto tile_type_to_color(Tile::Type type) -> SDL_Color
+        constexpr std::size_t VERTICES_PER_QUAD = 4;
+        constexpr std::size_t INDICES_PER_QUAD = 6;
+        constexpr std::array<int, INDICES_PER_QUAD> QUAD_INDICES = {0, 1, 2, 0, 2, 3};
+        constexpr std::size_t TILE_TYPE_COUNT = std::numeric_limits<std::uint8_t>::max() + 1;
+
+        constexpr auto tile_type_to_color(Tile::Type type) -> SDL_Color
         {
             switch (type)
             {
@@ -41,11 +49,41 @@ namespace Tactics
                 return DEFAULT_COLOR;
             }
         }
+
+        // Vertex colour of every stored tile type byte, so the fill pass is one lookup per tile
+        constexpr auto make_tile_colors() -> std::array<SDL_FColor, TILE_TYPE_COUNT>
+        {
+            constexpr float CHANNEL_MAX = 255.0F;
+            std::array<SDL_FColor, TILE_TYPE_COUNT> colors{};
+            for (std::size_t type = 0; type < TILE_TYPE_COUNT; ++type)
+            {
+                const SDL_Color color = tile_type_to_color(static_cast<Tile::Type>(type));
+                colors[type] = {static_cast<float>(color.r) / CHANNEL_MAX,
+                                static_cast<float>(color.g) / CHANNEL_MAX,
+                                static_cast<float>(color.b) / CHANNEL_MAX,
+                                static_cast<float>(color.a) / CHANNEL_MAX};
+            }
+            return colors;
+        }
+
+        constexpr std::array<SDL_FColor, TILE_TYPE_COUNT> TILE_COLORS = make_tile_colors();
+
+        void push_quad(std::vector<SDL_Vertex> &vertices, float left, float top, float right,
+                       float bottom, SDL_FColor color)
+        {
+            vertices.push_back({{left, top}, color, {0.0F, 0.0F}});
+            vertices.push_back({{right, top}, color, {0.0F, 0.0F}});
+            vertices.push_back({{right, bottom}, color, {0.0F, 0.0F}});
+            vertices.push_back({{left, bottom}, color, {0.0F, 0.0F}});
+        }
     } // namespace
 
     auto GridRenderer::render(SDL_Renderer *renderer, const Grid &grid, const Camera &camera,
                               float tile_size) -> bool
     {
+        m_tile_vertices.clear();
+        m_border_vertices.clear();
+
         if (renderer == nullptr)
         {
             return false;
@@ -58,56 +96,124 @@ namespace Tactics
         const int start_y = static_cast<int>((view_rect.top() - tile_size) / tile_size);
         const int end_y = static_cast<int>((view_rect.bottom() + tile_size) / tile_size);
 
-        for (int y_pos = start_y; y_pos <= end_y; ++y_pos)
+        // Clamp the visible tile range to the grid, then walk it chunk by chunk
+        const int first_x = std::max(start_x, 0);
+        const int last_x = std::min(end_x, grid.get_width() - 1);
+        const int first_y = std::max(start_y, 0);
+        const int last_y = std::min(end_y, grid.get_height() - 1);
+        if (first_x > last_x || first_y > last_y)
         {
-            for (int x_pos = start_x; x_pos <= end_x; ++x_pos)
-            {
-                const Vector2i tile_pos(x_pos, y_pos);
-                if (!grid.is_valid_position(tile_pos))
-                {
-                    continue;
-                }
-
-                const Tile *tile = grid.get_tile(tile_pos);
-                if (tile == nullptr)
-                {
-                    continue;
-                }
+            return true;
+        }
 
-                const float world_x = static_cast<float>(x_pos) * tile_size;
-                const float world_y = static_cast<float>(y_pos) * tile_size;
+        const Vector2i first_chunk = Grid::chunk_of(Vector2i(first_x, first_y));
+        const Vector2i last_chunk = Grid::chunk_of(Vector2i(last_x, last_y));
+        const float screen_tile_size = tile_size * camera.get_zoom();
 
-                const Vector2f screen_pos = camera.world_to_screen({world_x, world_y});
+        // The camera transform is affine, so tile edges step by screen_tile_size from the
+        // top-left edge of tile (0, 0)
+        const Vector2f origin = camera.world_to_screen({0.0F, 0.0F}) -
+                                Vector2f(screen_tile_size * 0.5F, screen_tile_size * 0.5F);
+        const auto edge_x = [&](int x_pos) -> float
+        { return origin.x + (static_cast<float>(x_pos) * screen_tile_size); };
+        const auto edge_y = [&](int y_pos) -> float
+        { return origin.y + (static_cast<float>(y_pos) * screen_tile_size); };
 
-                const float screen_tile_size = tile_size * camera.get_zoom();
+        const auto visible_tiles = static_cast<std::size_t>(last_x - first_x + 1) *
+                                   static_cast<std::size_t>(last_y - first_y + 1);
+        m_tile_vertices.reserve(visible_tiles * VERTICES_PER_QUAD);
 
-                const Rectf screen_rect(screen_pos.x - (screen_tile_size * 0.5F),
-                                        screen_pos.y - (screen_tile_size * 0.5F), screen_tile_size,
-                                        screen_tile_size);
+        for (int chunk_y = first_chunk.y; chunk_y <= last_chunk.y; ++chunk_y)
+        {
+            for (int chunk_x = first_chunk.x; chunk_x <= last_chunk.x; ++chunk_x)
+            {
+                const ConstGridChunk chunk = grid.get_chunk(chunk_x, chunk_y);
+                const int chunk_last_x = std::min(last_x, chunk.bounds.right() - 1);
+                const int chunk_last_y = std::min(last_y, chunk.bounds.bottom() - 1);
 
-                if (screen_rect.right() < 0.0F ||
-                    screen_rect.left() > camera.get_viewport_width() ||
-                    screen_rect.bottom() < 0.0F || screen_rect.top() > camera.get_viewport_height())
+                for (int y_pos = std::max(first_y, chunk.bounds.top()); y_pos <= chunk_last_y;
+                     ++y_pos)
                 {
-                    continue;
+                    const float top = edge_y(y_pos);
+                    const float bottom = top + screen_tile_size;
+                    if (bottom < 0.0F || top > camera.get_viewport_height())
+                    {
+                        continue;
+                    }
+
+                    for (int x_pos = std::max(first_x, chunk.bounds.left()); x_pos <= chunk_last_x;
+                         ++x_pos)
+                    {
+                        const float left = edge_x(x_pos);
+                        const float right = left + screen_tile_size;
+                        if (right < 0.0F || left > camera.get_viewport_width())
+                        {
+                            continue;
+                        }
+
+                        const auto local_index = static_cast<size_t>(
+                            ((y_pos - chunk.bounds.top()) * Grid::CHUNK_SIZE) +
+                            (x_pos - chunk.bounds.left()));
+                        push_quad(m_tile_vertices, std::floor(left), std::floor(top),
+                                  std::ceil(right), std::ceil(bottom),
+                                  TILE_COLORS[chunk.tile_types[local_index]]);
+                    }
                 }
+            }
+        }
+
+        // Borders follow the grid lines: where two tile outlines meet they cover the pixels on
+        // both sides of the edge, as they did when each tile drew its own
+        const float lines_top = std::floor(edge_y(first_y));
+        const float lines_bottom = std::ceil(edge_y(last_y + 1));
+        const float lines_left = std::floor(edge_x(first_x));
+        const float lines_right = std::ceil(edge_x(last_x + 1));
+        m_border_vertices.reserve(static_cast<std::size_t>((last_x - first_x + 2) +
+                                                           (last_y - first_y + 2)) *
+                                  VERTICES_PER_QUAD);
+        for (int x_pos = first_x; x_pos <= last_x + 1; ++x_pos)
+        {
+            const float edge = edge_x(x_pos);
+            push_quad(m_border_vertices, std::ceil(edge) - 1.0F, lines_top, std::floor(edge) + 1.0F,
+                      lines_bottom, BORDER_COLOR);
+        }
+        for (int y_pos = first_y; y_pos <= last_y + 1; ++y_pos)
+        {
+            const float edge = edge_y(y_pos);
+            push_quad(m_border_vertices, lines_left, std::ceil(edge) - 1.0F, lines_right,
+                      std::floor(edge) + 1.0F, BORDER_COLOR);
+        }
 
-                const SDL_Color color = tile_type_to_color(tile->get_type());
+        grow_quad_indices(std::max(m_tile_vertices.size(), m_border_vertices.size()) /
+                             VERTICES_PER_QUAD);
 
-                SDL_SetRenderDrawColor(renderer, color.r, color.g, color.b, color.a);
-                const float aligned_left = std::floor(screen_rect.left());
-                const float aligned_top = std::floor(screen_rect.top());
-                const float aligned_right = std::ceil(screen_rect.right());
-                const float aligned_bottom = std::ceil(screen_rect.bottom());
-                SDL_FRect sdl_rect = {aligned_left, aligned_top, aligned_right - aligned_left,
-                                      aligned_bottom - aligned_top};
-                SDL_RenderFillRect(renderer, &sdl_rect);
+        return submit_quads(renderer, m_tile_vertices) &&
+               submit_quads(renderer, m_border_vertices);
+    }
 
-                SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_MAX_UINT8);
-                SDL_RenderRect(renderer, &sdl_rect);
+    void GridRenderer::grow_quad_indices(std::size_t quad_count)
+    {
+        for (std::size_t quad = m_quad_indices.size() / INDICES_PER_QUAD; quad < quad_count; ++quad)
+        {
+            const auto base = static_cast<int>(quad * VERTICES_PER_QUAD);
+            for (const int offset : QUAD_INDICES)
+            {
+                m_quad_indices.push_back(base + offset);
             }
         }
+    }
+
+    auto GridRenderer::submit_quads(SDL_Renderer *renderer,
+                                    const std::vector<SDL_Vertex> &vertices) const -> bool
+    {
+        if (vertices.empty())
+        {
+            return true;
+        }
 
-        return true;
+        const std::size_t index_count = (vertices.size() / VERTICES_PER_QUAD) * INDICES_PER_QUAD;
+        return SDL_RenderGeometry(renderer, nullptr, vertices.data(),
+                                  static_cast<int>(vertices.size()), m_quad_indices.data(),
+                                  static_cast<int>(index_count));
     }
 } // namespace Tactics
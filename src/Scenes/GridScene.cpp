@@ -3,16 +3,15 @@
 #include "Tactics/Core/Events.hpp"
 #include "Tactics/Core/InputManager.hpp"
 #include "Tactics/Core/Logger.hpp"
-#include "Tactics/Core/MapGenerator.hpp"
 #include "Tactics/Renderers/CursorRenderer.hpp"
-#include "Tactics/Renderers/GridRenderer.hpp"
+#include <algorithm>
 
 namespace Tactics
 {
     GridScene::GridScene(IGridRepository *repository, IUnitRepository *unit_repository,
-                         std::string map_name)
+                         PersistenceWorker *persistence, std::string map_name)
         : m_grid_repository(repository), m_unit_repository(unit_repository),
-          m_map_name(std::move(map_name)), m_running(true)
+          m_persistence(persistence), m_map_name(std::move(map_name)), m_running(true)
     {}
 
     namespace
@@ -34,14 +33,23 @@ namespace Tactics
             return false;
         }
 
-        // Load grid from repository
-        auto grid_opt = m_grid_repository->load_map(m_map_name);
-        if (!grid_opt.has_value())
+        // Only the map size is read here: chunks are fetched as they come into view, starting
+        // once the camera is placed
+        m_map_view.emplace(m_grid_repository, m_map_name);
+        if (!m_map_view->is_open())
         {
+            m_map_view.reset();
             log_error("Failed to load grid from repository: " + m_map_name);
             return false;
         }
-        m_grid = std::move(grid_opt.value());
+        m_grid.resize(m_map_view->get_width(), m_map_view->get_height());
+        // Only edits make a chunk dirty: chunks filled in from the view already match storage,
+        // and the ones never filled in are left as they are stored
+        m_grid.clear_dirty_chunks();
+        m_filled_chunks.assign(static_cast<std::size_t>(m_grid.get_chunk_count()), false);
+        m_unfilled_chunk_count = m_filled_chunks.size();
+        m_generator_config = m_grid_repository->load_generator_config(m_map_name)
+                                 .value_or(GeneratorConfig::default_config());
 
         const int grid_width = m_grid.get_width();
         const int grid_height = m_grid.get_height();
@@ -57,6 +65,9 @@ namespace Tactics
 
         std::vector<Unit> units = m_unit_repository->load_units(m_map_name);
         m_unit_controller.set_units(m_grid, std::move(units));
+        // Unit searches may reach chunks that were never in view
+        m_unit_controller.set_search_region_callback(
+            [this](const Recti &tiles) { return fill_region(tiles); });
 
         // Publish initial cursor position so camera has correct state before updates
         const Vector2i cursor_grid_pos = m_cursor.get_position();
@@ -74,6 +85,11 @@ namespace Tactics
                            .viewport_width = m_config.viewport_width,
                            .viewport_height = m_config.viewport_height});
 
+        if (!fill_in_view(0.0F))
+        {
+            return false;
+        }
+
         m_map_regenerated_subscription_id =
             subscribe<Events::MapRegenerated>(handle_map_regenerated);
 
@@ -90,14 +106,43 @@ namespace Tactics
 
     void GridScene::on_exit()
     {
-        if (m_grid_repository != nullptr && !m_grid_repository->save_map(m_map_name, m_grid))
+        // Chunks not filled in yet are clean, so a delta save skips them. FileGridRepository
+        // rewrites the whole map on any change though, which would store their placeholder tiles,
+        // so the rest is only read in when there are edits to save, and the edits are dropped
+        // if it cannot be
+        if (m_grid.has_dirty_chunks() &&
+            !fill_chunk_range(Recti(0, 0, m_grid.get_chunks_x(), m_grid.get_chunks_y())))
         {
-            log_error("Failed to save map");
+            log_error("Map edits not saved, the rest of the map could not be read: " +
+                      m_map_name);
+            m_grid.clear_dirty_chunks();
         }
 
-        if (m_unit_repository != nullptr)
+        // The worker writes these behind the frame loop and flushes them before it is destroyed.
+        // It keeps the chunks of a failed write for the next save of this map, so the dirty bits
+        // can be cleared without waiting for the result
+        if (m_persistence != nullptr)
+        {
+            static_cast<void>(
+                m_persistence->save_scene(m_map_name, m_grid, m_unit_controller.get_units()));
+            m_grid.clear_dirty_chunks();
+        }
+        else
         {
-            if (!m_unit_repository->save_units(m_map_name, m_unit_controller.get_units()))
+            if (m_grid_repository != nullptr)
+            {
+                if (m_grid_repository->save_map_changes(m_map_name, m_grid))
+                {
+                    m_grid.clear_dirty_chunks();
+                }
+                else
+                {
+                    log_error("Failed to save map");
+                }
+            }
+
+            if (m_unit_repository != nullptr &&
+                !m_unit_repository->save_units(m_map_name, m_unit_controller.get_units()))
             {
                 log_error("Failed to save units");
             }
@@ -128,37 +173,25 @@ namespace Tactics
         // NOTE: temporary to test map generation
         if (input.is_key_just_pressed(SDL_SCANCODE_G))
         {
-            log_info("Regenerating map with new seed");
-
-            auto config_opt = m_grid_repository->load_generator_config(m_map_name);
-            GeneratorConfig config = config_opt.value_or(GeneratorConfig::default_config());
+            GeneratorConfig config = m_generator_config;
             config.width = m_grid.get_width();
             config.height = m_grid.get_height();
             config.seed += 1;
 
-            MapGenerator generator(config);
-            m_grid = generator.generate();
-
-            if (!m_grid_repository->save_map(m_map_name, m_grid))
+            if (m_map_generator.start(config))
             {
-                log_error("Failed to save regenerated map");
+                log_info("Regenerating map with new seed");
             }
-            if (!m_grid_repository->save_generator_config(m_map_name, config))
+            else
             {
-                log_error("Failed to save generator config");
+                log_info("Map generation already in progress");
             }
+        }
 
-            const int new_grid_width = m_grid.get_width();
-            const int new_grid_height = m_grid.get_height();
-            m_cursor.set_position(Vector2i{new_grid_width / 2, new_grid_height / 2});
-
-            const Vector2i cursor_grid_pos = m_cursor.get_position();
-            const Vector2f cursor_world_pos = m_cursor.get_world_position();
-            publish(Events::CursorMoved{.grid_position = GridPos{cursor_grid_pos},
-                                        .world_position = WorldPos{cursor_world_pos}});
-            publish(Events::MapRegenerated{.map_name = m_map_name, .seed = config.seed});
-
-            m_unit_controller.on_grid_changed(m_grid);
+        // Keep playing on the old map until the new one is ready, then swap it in
+        if (auto generated = m_map_generator.take_result())
+        {
+            swap_in_map(std::move(*generated));
         }
 
         m_unit_controller.update(m_grid, m_cursor);
@@ -174,6 +207,199 @@ namespace Tactics
         {
             m_camera_controller.update(m_camera);
         }
+
+        // Whatever came into view is drawn this frame. A map that cannot be read ends the scene
+        static_cast<void>(fill_in_view(delta_time));
+    }
+
+    void GridScene::swap_in_map(GeneratedMap generated)
+    {
+        m_grid = std::move(generated.grid);
+        m_generator_config = generated.config;
+        // The generated grid is complete, so any fill-in of the stored map stops here
+        m_map_view.reset();
+        m_filled_chunks.clear();
+        m_unfilled_chunk_count = 0;
+
+        // As in on_exit, a failed background write keeps its chunks for the next save
+        if (m_persistence != nullptr)
+        {
+            static_cast<void>(m_persistence->save_scene(m_map_name, m_grid,
+                                                        m_unit_controller.get_units(),
+                                                        generated.config));
+            m_grid.clear_dirty_chunks();
+        }
+        else
+        {
+            if (m_grid_repository->save_map(m_map_name, m_grid))
+            {
+                m_grid.clear_dirty_chunks();
+            }
+            else
+            {
+                log_error("Failed to save regenerated map");
+            }
+            if (!m_grid_repository->save_generator_config(m_map_name, generated.config))
+            {
+                log_error("Failed to save generator config");
+            }
+        }
+
+        const int new_grid_width = m_grid.get_width();
+        const int new_grid_height = m_grid.get_height();
+        m_cursor.set_position(Vector2i{new_grid_width / 2, new_grid_height / 2});
+
+        const Vector2i cursor_grid_pos = m_cursor.get_position();
+        const Vector2f cursor_world_pos = m_cursor.get_world_position();
+        publish(Events::CursorMoved{.grid_position = GridPos{cursor_grid_pos},
+                                    .world_position = WorldPos{cursor_world_pos}});
+        publish(Events::MapRegenerated{.map_name = m_map_name, .seed = generated.config.seed});
+
+        m_unit_controller.on_grid_changed(m_grid);
+    }
+
+    auto GridScene::fill_in_view(float delta_time) -> bool
+    {
+        if (!m_map_view.has_value())
+        {
+            return true;
+        }
+
+        // Everything in view is needed this frame; a moving camera also reads a few chunks of
+        // the area it is heading into
+        m_map_view->track_camera(m_camera, delta_time);
+        const Recti prefetch_range = m_map_view->get_prefetch_range(m_camera, m_config.tile_size);
+        if (!fill_chunk_range(
+                m_map_view->get_chunk_range(m_camera.get_view_rect(), m_config.tile_size)))
+        {
+            return false;
+        }
+
+        return fill_chunk_range(prefetch_range, LazyMapView::DEFAULT_PREFETCH_BUDGET);
+    }
+
+    auto GridScene::fill_region(const Recti &tiles) -> bool
+    {
+        const int left = std::max(tiles.x, 0);
+        const int top = std::max(tiles.y, 0);
+        const int right = std::min(tiles.right(), m_grid.get_width());
+        const int bottom = std::min(tiles.bottom(), m_grid.get_height());
+        if (left >= right || top >= bottom)
+        {
+            return true;
+        }
+
+        const Vector2i first = Grid::chunk_of(Vector2i(left, top));
+        const Vector2i last = Grid::chunk_of(Vector2i(right - 1, bottom - 1));
+        return fill_chunk_range(Recti(first, last.x - first.x + 1, last.y - first.y + 1));
+    }
+
+    auto GridScene::fill_chunk_range(const Recti &chunks, std::size_t budget) -> bool
+    {
+        if (!m_map_view.has_value())
+        {
+            return true;
+        }
+
+        const std::size_t unfilled_before = m_unfilled_chunk_count;
+        const auto within_budget = [&]
+        { return unfilled_before - m_unfilled_chunk_count < budget; };
+
+        bool readable = true;
+        for (int chunk_y = chunks.y; readable && within_budget() && chunk_y < chunks.bottom();
+             ++chunk_y)
+        {
+            for (int chunk_x = chunks.x; readable && within_budget() && chunk_x < chunks.right();
+                 ++chunk_x)
+            {
+                readable = fill_chunk(chunk_x, chunk_y);
+            }
+        }
+
+        if (!readable && !load_whole_map())
+        {
+            // Play cannot go on over placeholder tiles standing in for terrain that never loaded
+            log_error("Map cannot be read, ending the scene: " + m_map_name);
+            m_running = false;
+            return false;
+        }
+
+        if (m_unfilled_chunk_count == 0)
+        {
+            finish_fill_in();
+        }
+        return true;
+    }
+
+    auto GridScene::fill_chunk(int chunk_x, int chunk_y) -> bool
+    {
+        const auto index = static_cast<std::size_t>((chunk_y * m_grid.get_chunks_x()) + chunk_x);
+        if (m_filled_chunks[index])
+        {
+            return true;
+        }
+
+        // Decoded straight into the grid's planes, so no second copy of the chunk is kept
+        const GridChunk chunk = m_grid.get_chunk(chunk_x, chunk_y);
+        if (!m_grid_repository->load_chunk(m_map_name, chunk))
+        {
+            return false;
+        }
+        // Unit searches only fill in the tiles within move_points of the unit, which holds as
+        // long as every move costs at least one point
+        std::ranges::replace(chunk.move_costs, std::int8_t{0}, std::int8_t{1});
+        m_grid.mark_chunk_loaded(chunk_x, chunk_y);
+
+        m_filled_chunks[index] = true;
+        --m_unfilled_chunk_count;
+        return true;
+    }
+
+    auto GridScene::load_whole_map() -> bool
+    {
+        // Maps stored before chunks could be read on their own (legacy tile rows) keep failing
+        // per-chunk reads, so they are loaded in one go instead
+        log_info("Map cannot be read chunk by chunk, loading it whole: " + m_map_name);
+        auto grid_opt = m_grid_repository->load_map(m_map_name);
+        if (!grid_opt.has_value() || grid_opt->get_width() != m_grid.get_width() ||
+            grid_opt->get_height() != m_grid.get_height())
+        {
+            log_error("Failed to load grid from repository: " + m_map_name);
+            return false;
+        }
+
+        // Only the chunks never filled in are taken from the load, so edits made since entering
+        // the scene are kept for the next save
+        const Grid &stored = grid_opt.value();
+        for (int chunk_y = 0; chunk_y < m_grid.get_chunks_y(); ++chunk_y)
+        {
+            for (int chunk_x = 0; chunk_x < m_grid.get_chunks_x(); ++chunk_x)
+            {
+                const auto index =
+                    static_cast<std::size_t>((chunk_y * m_grid.get_chunks_x()) + chunk_x);
+                if (m_filled_chunks[index] || m_grid.is_chunk_dirty(chunk_x, chunk_y))
+                {
+                    continue;
+                }
+
+                const ConstGridChunk source = stored.get_chunk(chunk_x, chunk_y);
+                const GridChunk target = m_grid.get_chunk(chunk_x, chunk_y);
+                std::ranges::copy(source.tile_types, target.tile_types.begin());
+                std::ranges::copy(source.move_costs, target.move_costs.begin());
+                m_grid.mark_chunk_loaded(chunk_x, chunk_y);
+                m_filled_chunks[index] = true;
+            }
+        }
+
+        m_unfilled_chunk_count = 0;
+        return true;
+    }
+
+    void GridScene::finish_fill_in()
+    {
+        m_map_view.reset();
+        m_filled_chunks.clear();
+        log_debug("Map filled in: " + m_map_name);
     }
 
     namespace
@@ -182,6 +408,12 @@ namespace Tactics
         constexpr uint8_t BACKGROUND_COLOR_G = 0x2E;
         constexpr uint8_t BACKGROUND_COLOR_B = 0x2E;
         constexpr uint8_t BACKGROUND_COLOR_A = 0xFF;
+
+        constexpr float PROGRESS_BAR_MARGIN = 16.0F;
+        constexpr float PROGRESS_BAR_HEIGHT = 8.0F;
+        constexpr uint8_t PROGRESS_TRACK_SHADE = 0x50;
+        constexpr uint8_t PROGRESS_FILL_SHADE = 0xE0;
+        constexpr uint8_t PROGRESS_ALPHA = 0xFF;
     } // namespace
     void GridScene::render(SDL_Renderer *renderer)
     {
@@ -197,7 +429,7 @@ namespace Tactics
 
         // Render grid
         const bool grid_rendered =
-            GridRenderer::render(renderer, m_grid, m_camera, m_config.tile_size);
+            m_grid_renderer.render(renderer, m_grid, m_camera, m_config.tile_size);
         (void)grid_rendered;
 
         m_unit_controller.render(renderer, m_camera, m_config.tile_size, m_grid);
@@ -206,6 +438,24 @@ namespace Tactics
         const bool cursor_rendered =
             CursorRenderer::render(renderer, m_cursor, m_camera, m_config.tile_size);
         (void)cursor_rendered;
+
+        // Loading indicator while a new map is generated in the background
+        if (m_map_generator.is_running())
+        {
+            const float track_width = m_config.viewport_width - (2.0F * PROGRESS_BAR_MARGIN);
+            const SDL_FRect track{PROGRESS_BAR_MARGIN, PROGRESS_BAR_MARGIN, track_width,
+                                  PROGRESS_BAR_HEIGHT};
+            const SDL_FRect fill{PROGRESS_BAR_MARGIN, PROGRESS_BAR_MARGIN,
+                                 track_width * m_map_generator.get_progress(),
+                                 PROGRESS_BAR_HEIGHT};
+
+            SDL_SetRenderDrawColor(renderer, PROGRESS_TRACK_SHADE, PROGRESS_TRACK_SHADE,
+                                   PROGRESS_TRACK_SHADE, PROGRESS_ALPHA);
+            SDL_RenderFillRect(renderer, &track);
+            SDL_SetRenderDrawColor(renderer, PROGRESS_FILL_SHADE, PROGRESS_FILL_SHADE,
+                                   PROGRESS_FILL_SHADE, PROGRESS_ALPHA);
+            SDL_RenderFillRect(renderer, &fill);
+        }
     }
 
     auto GridScene::should_exit() const -> bool
@@ -1,5 +1,7 @@
 #include "Tactics/Core/Engine.hpp"
 #include "Tactics/Core/Logger.hpp"
+#include "Tactics/Core/PersistenceWorker.hpp"
+#include "Tactics/Core/SQLiteDatabase.hpp"
 #include "Tactics/Core/SQLiteGridRepository.hpp"
 #include "Tactics/Core/SQLiteUnitRepository.hpp"
 #include "Tactics/Core/SceneManager.hpp"
@@ -18,9 +20,13 @@ auto main() -> int
 
     Tactics::log_info("=== Tactics Engine Starting ===");
 
-    // Database
-    Tactics::SQLiteGridRepository repository("maps.db");
-    Tactics::SQLiteUnitRepository unit_repository("maps.db");
+    // Database: the repositories share one connection on the main thread
+    auto database = std::make_shared<Tactics::SQLiteDatabase>("maps.db");
+    Tactics::SQLiteGridRepository repository(database);
+    Tactics::SQLiteUnitRepository unit_repository(database);
+
+    // Saves are written behind the frame loop; destroying the worker flushes them
+    Tactics::PersistenceWorker persistence("maps.db");
     const std::string_view default_map_name = "default";
 
     Tactics::Engine engine;
@@ -34,7 +40,7 @@ auto main() -> int
     // Scenes
     auto &scene_manager = Tactics::SceneManager::instance();
     auto grid_scene = std::make_unique<Tactics::GridScene>(&repository, &unit_repository,
-                                                           default_map_name.data());
+                                                           &persistence, default_map_name.data());
     scene_manager.change_scene(std::move(grid_scene));
 
     // Blocking main game loop
@@ -0,0 +1,163 @@
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <utility>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+TEST_CASE("Grid Tile Planes", "[Grid]")
+{
+    Grid grid;
+    grid.resize(4, 3);
+
+    SECTION("Resize fills in-bounds tiles with default grass")
+    {
+        REQUIRE(grid.get_tile_types().size() == Grid::CHUNK_TILE_COUNT);
+        REQUIRE(grid.get_move_costs().size() == Grid::CHUNK_TILE_COUNT);
+
+        for (int y = 0; y < 3; ++y)
+        {
+            for (int x = 0; x < 4; ++x)
+            {
+                const auto tile = grid.get_tile(Vector2i(x, y));
+                REQUIRE(tile.has_value());
+                REQUIRE(tile->get_type() == Tile::Type::Grass);
+                REQUIRE(tile->get_move_cost() == 1);
+            }
+        }
+    }
+
+    SECTION("set_tile writes through to the planes")
+    {
+        grid.set_tile(Vector2i(2, 1), Tile(Vector2i(0, 0), Tile::Type::Forest, 2));
+
+        const size_t index = grid.index_of(2, 1);
+        REQUIRE(index == static_cast<size_t>((1 * Grid::CHUNK_SIZE) + 2));
+        REQUIRE(grid.get_tile_types()[index] == static_cast<std::uint8_t>(Tile::Type::Forest));
+        REQUIRE(grid.get_move_costs()[index] == 2);
+    }
+
+    SECTION("get_tile materializes from the planes")
+    {
+        grid.get_tile_types()[grid.index_of(3, 2)] = static_cast<std::uint8_t>(Tile::Type::Water);
+        grid.get_move_costs()[grid.index_of(3, 2)] = -1;
+
+        const auto tile = grid.get_tile(Vector2i(3, 2));
+        REQUIRE(tile.has_value());
+        REQUIRE(tile->get_position() == Vector2i(3, 2));
+        REQUIRE(tile->get_type() == Tile::Type::Water);
+        REQUIRE(tile->get_move_cost() == -1);
+        REQUIRE_FALSE(tile->is_walkable());
+    }
+
+    SECTION("Out of bounds access")
+    {
+        REQUIRE_FALSE(grid.get_tile(Vector2i(4, 0)).has_value());
+        REQUIRE_FALSE(grid.get_tile(Vector2i(0, -1)).has_value());
+    }
+
+    SECTION("Move costs outside the int8 plane are rejected")
+    {
+        grid.set_tile(Vector2i(1, 1), Tile(Vector2i(1, 1), Tile::Type::Desert, 1000));
+
+        const auto tile = grid.get_tile(Vector2i(1, 1));
+        REQUIRE(tile.has_value());
+        REQUIRE(tile->get_type() == Tile::Type::Grass);
+        REQUIRE(tile->get_move_cost() == 1);
+    }
+}
+
+TEST_CASE("Grid Chunks", "[Grid]")
+{
+    Grid grid;
+    grid.resize(40, 33);
+
+    SECTION("Chunk layout covers the grid")
+    {
+        REQUIRE(grid.get_chunks_x() == 2);
+        REQUIRE(grid.get_chunks_y() == 2);
+        REQUIRE(grid.get_chunk_count() == 4);
+        REQUIRE(grid.get_tile_types().size() == 4 * Grid::CHUNK_TILE_COUNT);
+        REQUIRE(Grid::chunk_of(Vector2i(31, 32)) == Vector2i(0, 1));
+        REQUIRE(Grid::chunk_of(Vector2i(39, 0)) == Vector2i(1, 0));
+    }
+
+    SECTION("Edge chunks are clipped to the grid")
+    {
+        const ConstGridChunk full = std::as_const(grid).get_chunk(0, 0);
+        REQUIRE(full.bounds == Recti(0, 0, 32, 32));
+
+        const ConstGridChunk corner = std::as_const(grid).get_chunk(1, 1);
+        REQUIRE(corner.bounds == Recti(32, 32, 8, 1));
+        REQUIRE(corner.tile_types.size() == Grid::CHUNK_TILE_COUNT);
+    }
+
+    SECTION("Padding outside the grid is blocked")
+    {
+        const ConstGridChunk corner = std::as_const(grid).get_chunk(1, 1);
+        REQUIRE(corner.move_costs[7] == 1);
+        REQUIRE(corner.move_costs[8] == -1);
+        REQUIRE(corner.move_costs[Grid::CHUNK_SIZE] == -1);
+        REQUIRE(corner.tile_types[8] == static_cast<std::uint8_t>(Tile::Type::Wall));
+    }
+
+    SECTION("Chunks are contiguous in the planes")
+    {
+        grid.set_tile(Vector2i(33, 2), Tile(Vector2i(33, 2), Tile::Type::Road, 1));
+
+        const GridChunk chunk = grid.get_chunk(1, 0);
+        REQUIRE(chunk.tile_types.data() == grid.get_tile_types().data() + Grid::CHUNK_TILE_COUNT);
+        REQUIRE(chunk.tile_types[(2 * Grid::CHUNK_SIZE) + 1] ==
+                static_cast<std::uint8_t>(Tile::Type::Road));
+        REQUIRE(grid.index_of(33, 2) ==
+                static_cast<size_t>(Grid::CHUNK_TILE_COUNT + (2 * Grid::CHUNK_SIZE) + 1));
+    }
+
+    SECTION("Clones are independent deep copies")
+    {
+        grid.set_tile(Vector2i(3, 3), Tile(Vector2i(3, 3), Tile::Type::Forest, 2));
+
+        Grid copy = grid.clone();
+        REQUIRE(copy.get_width() == grid.get_width());
+        REQUIRE(copy.get_revision() == grid.get_revision());
+        REQUIRE(copy.get_chunk_revision(1, 1) == grid.get_chunk_revision(1, 1));
+        REQUIRE(copy.get_tile(Vector2i(3, 3))->get_type() == Tile::Type::Forest);
+
+        copy.set_tile(Vector2i(3, 3), Tile(Vector2i(3, 3), Tile::Type::Water, -1));
+        REQUIRE(grid.get_tile(Vector2i(3, 3))->get_type() == Tile::Type::Forest);
+    }
+
+    SECTION("Dirty chunks track changes until cleared")
+    {
+        REQUIRE(grid.get_dirty_chunk_count() == grid.get_chunk_count());
+
+        grid.clear_dirty_chunks();
+        REQUIRE_FALSE(grid.has_dirty_chunks());
+
+        grid.set_tile(Vector2i(35, 32), Tile(Vector2i(35, 32), Tile::Type::Desert, 1));
+        REQUIRE(grid.get_dirty_chunk_count() == 1);
+        REQUIRE(grid.is_chunk_dirty(1, 1));
+        REQUIRE_FALSE(grid.is_chunk_dirty(0, 0));
+
+        Grid copy = grid.clone();
+        REQUIRE(copy.is_chunk_dirty(1, 1));
+        copy.clear_dirty_chunks();
+        copy.mark_chunk_changed(0, 0);
+        copy.merge_dirty_chunks(grid);
+        REQUIRE(copy.get_dirty_chunk_count() == 2);
+    }
+
+    SECTION("Loaded chunks get a new revision but stay clean")
+    {
+        grid.clear_dirty_chunks();
+        const auto revision = grid.get_revision();
+        const auto chunk_revision = grid.get_chunk_revision(1, 0);
+
+        grid.mark_chunk_loaded(1, 0);
+        REQUIRE(grid.get_revision() != revision);
+        REQUIRE(grid.get_chunk_revision(1, 0) != chunk_revision);
+        REQUIRE_FALSE(grid.has_dirty_chunks());
+    }
+}
+// NOLINTEND
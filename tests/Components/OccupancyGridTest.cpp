@@ -0,0 +1,88 @@
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/OccupancyGrid.hpp"
+#include "Tactics/Components/Unit.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+TEST_CASE("OccupancyGrid", "[Components]")
+{
+    Grid grid;
+    grid.resize(40, 20);
+
+    std::vector<Unit> units;
+    units.emplace_back(Vector2i(1, 1), 5);
+    units.emplace_back(Vector2i(35, 10), 5);
+    units.emplace_back(Vector2i(1, 1), 5);
+
+    OccupancyGrid occupancy;
+    occupancy.reset(grid, units);
+
+    SECTION("Lookups return the unit index on its tile")
+    {
+        REQUIRE(occupancy.get_unit_at(grid, Vector2i(35, 10)) == 1);
+        REQUIRE(occupancy.is_occupied(grid, Vector2i(35, 10)));
+        REQUIRE_FALSE(occupancy.get_unit_at(grid, Vector2i(2, 2)).has_value());
+        REQUIRE_FALSE(occupancy.get_unit_at(grid, Vector2i(-1, 0)).has_value());
+    }
+
+    SECTION("Stacked units resolve to the first one")
+    {
+        REQUIRE(occupancy.get_unit_at(grid, Vector2i(1, 1)) == 0);
+    }
+
+    SECTION("Mask follows the grid plane layout")
+    {
+        const auto &occupied = occupancy.get_occupied_tiles();
+        REQUIRE(occupied.size() == grid.get_move_costs().size());
+        REQUIRE(occupied[grid.index_of(35, 10)]);
+        REQUIRE(occupied[grid.index_of(1, 1)]);
+        REQUIRE_FALSE(occupied[grid.index_of(34, 10)]);
+    }
+
+    SECTION("Moves update both tiles and the revision")
+    {
+        const auto revision = occupancy.get_revision();
+        occupancy.move_unit(grid, 1, Vector2i(35, 10), Vector2i(36, 11));
+        REQUIRE(occupancy.get_revision() != revision);
+        REQUIRE_FALSE(occupancy.is_occupied(grid, Vector2i(35, 10)));
+        REQUIRE_FALSE(occupancy.get_occupied_tiles()[grid.index_of(35, 10)]);
+        REQUIRE(occupancy.get_unit_at(grid, Vector2i(36, 11)) == 1);
+        REQUIRE(occupancy.get_occupied_tiles()[grid.index_of(36, 11)]);
+    }
+
+    SECTION("Moving off a tile held by another unit leaves it occupied")
+    {
+        occupancy.move_unit(grid, 2, Vector2i(1, 1), Vector2i(2, 1));
+        REQUIRE(occupancy.get_unit_at(grid, Vector2i(1, 1)) == 0);
+        REQUIRE(occupancy.get_unit_at(grid, Vector2i(2, 1)) == 2);
+    }
+
+    SECTION("The next unit in a stack is found when the top one leaves")
+    {
+        occupancy.move_unit(grid, 0, Vector2i(1, 1), Vector2i(2, 1));
+        REQUIRE(occupancy.get_unit_at(grid, Vector2i(1, 1)) == 2);
+        REQUIRE(occupancy.get_occupied_tiles()[grid.index_of(1, 1)]);
+
+        occupancy.move_unit(grid, 2, Vector2i(1, 1), Vector2i(2, 1));
+        REQUIRE_FALSE(occupancy.is_occupied(grid, Vector2i(1, 1)));
+        REQUIRE_FALSE(occupancy.get_occupied_tiles()[grid.index_of(1, 1)]);
+
+        // Both now share (2, 1), with the last to arrive on top
+        REQUIRE(occupancy.get_unit_at(grid, Vector2i(2, 1)) == 2);
+        occupancy.move_unit(grid, 2, Vector2i(2, 1), Vector2i(3, 1));
+        REQUIRE(occupancy.get_unit_at(grid, Vector2i(2, 1)) == 0);
+    }
+
+    SECTION("Reset rebuilds for a resized grid")
+    {
+        grid.resize(10, 10);
+        occupancy.reset(grid, units);
+        REQUIRE(occupancy.get_occupied_tiles().size() == grid.get_move_costs().size());
+        REQUIRE(occupancy.get_unit_at(grid, Vector2i(1, 1)) == 0);
+        REQUIRE_FALSE(occupancy.is_occupied(grid, Vector2i(9, 9)));
+    }
+}
+// NOLINTEND
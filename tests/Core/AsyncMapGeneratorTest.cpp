@@ -0,0 +1,81 @@
+#include "Tactics/Core/AsyncMapGenerator.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/MapGenerator.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <optional>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    auto wait_for_result(AsyncMapGenerator &generator) -> std::optional<GeneratedMap>
+    {
+        for (int attempt = 0; attempt < 5000; ++attempt)
+        {
+            if (auto result = generator.take_result())
+            {
+                return result;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return std::nullopt;
+    }
+} // namespace
+
+TEST_CASE("AsyncMapGenerator", "[Core]")
+{
+    GeneratorConfig config = GeneratorConfig::default_config();
+    config.width = 60;
+    config.height = 40;
+    config.seed = 11;
+
+    AsyncMapGenerator generator;
+    REQUIRE_FALSE(generator.is_running());
+    REQUIRE_FALSE(generator.take_result().has_value());
+
+    SECTION("Results match synchronous generation")
+    {
+        REQUIRE(generator.start(config));
+        auto result = wait_for_result(generator);
+        REQUIRE(result.has_value());
+        REQUIRE(result->config.seed == 11);
+        REQUIRE(generator.get_progress() == 1.0F);
+        REQUIRE_FALSE(generator.take_result().has_value());
+
+        MapGenerator sync_generator(config);
+        const Grid expected = sync_generator.generate();
+        REQUIRE(std::ranges::equal(result->grid.get_tile_types(), expected.get_tile_types()));
+    }
+
+    SECTION("Jobs can run back to back")
+    {
+        REQUIRE(generator.start(config));
+        REQUIRE(wait_for_result(generator).has_value());
+
+        // A different thread count restarts the shared pool
+        config.seed = 12;
+        config.thread_count = 1;
+        REQUIRE(generator.start(config));
+        const auto second = wait_for_result(generator);
+        REQUIRE(second.has_value());
+        REQUIRE(second->config.seed == 12);
+    }
+
+    SECTION("Progress is reported per stage")
+    {
+        std::vector<float> reported;
+        MapGenerator sync_generator(config);
+        sync_generator.set_progress_callback([&](float progress) { reported.push_back(progress); });
+        static_cast<void>(sync_generator.generate());
+
+        REQUIRE(reported.size() >= 2);
+        REQUIRE(std::ranges::is_sorted(reported));
+        REQUIRE(reported.back() == 1.0F);
+    }
+}
+// NOLINTEND
@@ -0,0 +1,129 @@
+#include "Tactics/Core/CellularAutomaton.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    // Direct per-cell neighbour scan with the generator's original priority rules
+    auto reference_step(const std::vector<Tile::Type> &tiles, int width, int height)
+        -> std::vector<Tile::Type>
+    {
+        std::vector<Tile::Type> result = tiles;
+        for (int y = 0; y < height; ++y)
+        {
+            for (int x = 0; x < width; ++x)
+            {
+                auto count = [&](Tile::Type type)
+                {
+                    int total = 0;
+                    for (int dy = -1; dy <= 1; ++dy)
+                    {
+                        for (int dx = -1; dx <= 1; ++dx)
+                        {
+                            const int nx = x + dx;
+                            const int ny = y + dy;
+                            if ((dx != 0 || dy != 0) && nx >= 0 && nx < width && ny >= 0 &&
+                                ny < height && tiles[(ny * width) + nx] == type)
+                            {
+                                ++total;
+                            }
+                        }
+                    }
+                    return total;
+                };
+
+                for (const auto type : {Tile::Type::Water, Tile::Type::Mountain,
+                                        Tile::Type::Forest, Tile::Type::Grass, Tile::Type::Desert})
+                {
+                    if (count(type) >= 5)
+                    {
+                        result[(y * width) + x] = type;
+                        break;
+                    }
+                }
+            }
+        }
+        return result;
+    }
+} // namespace
+
+TEST_CASE("CellularAutomaton", "[Core]")
+{
+    SECTION("Count masks")
+    {
+        REQUIRE(CellularAutomaton::at_least(0) == 0x1FF);
+        REQUIRE(CellularAutomaton::at_least(5) == 0x1E0);
+        REQUIRE(CellularAutomaton::at_least(8) == 0x100);
+        REQUIRE(CellularAutomaton::at_least(9) == 0);
+    }
+
+    SECTION("Majority rules match a direct neighbour scan")
+    {
+        const int width = 37;
+        const int height = 23;
+        std::mt19937 rng(5);
+        std::uniform_int_distribution<int> type_dist(0, 4);
+
+        std::vector<Tile::Type> tiles(static_cast<size_t>(width * height));
+        for (auto &tile : tiles)
+        {
+            tile = static_cast<Tile::Type>(type_dist(rng));
+        }
+
+        const CellularAutomaton automaton(CellularAutomaton::majority_rules());
+        std::vector<Tile::Type> next(tiles.size());
+        for (int iteration = 0; iteration < 4; ++iteration)
+        {
+            automaton.step_rows(tiles, next, width, height, 0, height);
+            REQUIRE(next == reference_step(tiles, width, height));
+            tiles.swap(next);
+        }
+    }
+
+    SECTION("Row ranges can be stepped separately")
+    {
+        const int width = 9;
+        const int height = 11;
+        std::vector<Tile::Type> tiles(static_cast<size_t>(width * height), Tile::Type::Grass);
+        for (int i = 0; i < width * height; i += 3)
+        {
+            tiles[static_cast<size_t>(i)] = Tile::Type::Water;
+        }
+
+        const CellularAutomaton automaton(CellularAutomaton::majority_rules());
+        std::vector<Tile::Type> whole(tiles.size());
+        std::vector<Tile::Type> banded(tiles.size());
+        automaton.step_rows(tiles, whole, width, height, 0, height);
+        automaton.step_rows(tiles, banded, width, height, 0, 4);
+        automaton.step_rows(tiles, banded, width, height, 4, height);
+        REQUIRE(banded == whole);
+    }
+
+    SECTION("Custom rule tables")
+    {
+        // Grass with exactly one water neighbour turns to desert
+        const CellularAutomaton automaton({{.counted = Tile::Type::Water,
+                                            .neighbor_counts = 1U << 1,
+                                            .result = Tile::Type::Desert}});
+
+        const std::vector<Tile::Type> tiles = {
+            Tile::Type::Water, Tile::Type::Grass, Tile::Type::Grass,
+            Tile::Type::Grass, Tile::Type::Grass, Tile::Type::Grass,
+        };
+        std::vector<Tile::Type> next(tiles.size());
+        automaton.step_rows(tiles, next, 3, 2, 0, 2);
+
+        REQUIRE(next[0] == Tile::Type::Water);
+        REQUIRE(next[1] == Tile::Type::Desert);
+        REQUIRE(next[2] == Tile::Type::Grass);
+        REQUIRE(next[3] == Tile::Type::Desert);
+        REQUIRE(next[4] == Tile::Type::Desert);
+        REQUIRE(next[5] == Tile::Type::Grass);
+    }
+}
+// NOLINTEND
@@ -0,0 +1,87 @@
+#include "Tactics/Core/ChunkStreamer.hpp"
+#include "Tactics/Components/Camera.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/MapGenerator.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    auto make_config(int width, int height) -> GeneratorConfig
+    {
+        GeneratorConfig config = GeneratorConfig::default_config();
+        config.width = width;
+        config.height = height;
+        config.seed = 99;
+        config.thread_count = 1;
+        return config;
+    }
+} // namespace
+
+TEST_CASE("ChunkStreamer", "[Core]")
+{
+    SECTION("Chunks hold the region terrain with wall padding")
+    {
+        const GeneratorConfig config = make_config(70, 40);
+        ChunkStreamer streamer(config, 4);
+        const auto whole = MapGenerator(config).generate_region(Recti(0, 0, 70, 40));
+
+        REQUIRE(streamer.get_chunks_x() == 3);
+        REQUIRE(streamer.get_chunks_y() == 2);
+        REQUIRE(streamer.get_chunk(3, 0) == nullptr);
+
+        const StreamedChunk *chunk = streamer.get_chunk(2, 1);
+        REQUIRE(chunk != nullptr);
+        REQUIRE(chunk->bounds == Recti(64, 32, 6, 8));
+        REQUIRE(chunk->tile_types[(7 * Grid::CHUNK_SIZE) + 5] ==
+                static_cast<std::uint8_t>(whole[(39 * 70) + 69]));
+        REQUIRE(chunk->tile_types[(7 * Grid::CHUNK_SIZE) + 6] ==
+                static_cast<std::uint8_t>(Tile::Type::Wall));
+        REQUIRE(chunk->move_costs[(8 * Grid::CHUNK_SIZE)] < 0);
+
+        REQUIRE(streamer.get_tile_type(Vector2i(69, 39)) == whole[(39 * 70) + 69]);
+        REQUIRE_FALSE(streamer.get_tile_type(Vector2i(0, 0)).has_value());
+    }
+
+    SECTION("Least recently used chunks are evicted")
+    {
+        ChunkStreamer streamer(make_config(200, 40), 2);
+        REQUIRE(streamer.get_chunk(0, 0) != nullptr);
+        REQUIRE(streamer.get_chunk(1, 0) != nullptr);
+        REQUIRE(streamer.get_chunk(0, 0) != nullptr);
+        REQUIRE(streamer.get_generated_count() == 2);
+
+        REQUIRE(streamer.get_chunk(2, 0) != nullptr);
+        REQUIRE(streamer.get_cached_chunk_count() == 2);
+        REQUIRE(streamer.find_chunk(0, 0) != nullptr);
+        REQUIRE(streamer.find_chunk(1, 0) == nullptr);
+        REQUIRE(streamer.get_generated_count() == 3);
+    }
+
+    SECTION("Only chunks near the camera are generated in huge maps")
+    {
+        ChunkStreamer streamer(make_config(100000, 100000));
+        const float tile_size = 32.0F;
+
+        // 640x320 view centred on tile (5000, 5000): tiles 4990-5010 by 4995-5005
+        const Camera camera(CameraSettings{.position = Vector2f(5000.0F * tile_size,
+                                                                5000.0F * tile_size),
+                                           .zoom = 1.0F,
+                                           .viewport_width = 640.0F,
+                                           .viewport_height = 320.0F});
+
+        const Recti range = streamer.get_chunk_range(camera, tile_size, 0);
+        REQUIRE(range == Recti(155, 156, 2, 1));
+
+        REQUIRE(streamer.update(camera, tile_size) == 12);
+        REQUIRE(streamer.get_cached_chunk_count() == 12);
+        REQUIRE(streamer.find_chunk(156, 156) != nullptr);
+        REQUIRE(streamer.update(camera, tile_size) == 0);
+    }
+}
+// NOLINTEND
@@ -0,0 +1,91 @@
+#include "Tactics/Core/ConnectedComponents.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/MapGenerator.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    void set_wall(Grid &grid, int x, int y)
+    {
+        grid.set_tile(Vector2i(x, y), Tile(Vector2i(x, y), Tile::Type::Wall, -1));
+    }
+} // namespace
+
+TEST_CASE("ConnectedComponents", "[Core]")
+{
+    Grid grid;
+    grid.resize(40, 6);
+
+    ConnectedComponents components;
+
+    SECTION("Open grid is one component")
+    {
+        REQUIRE(components.label(grid) == 1);
+        REQUIRE(components.get_component_sizes()[0] == 240);
+        REQUIRE(components.get_largest_component() == 0);
+    }
+
+    SECTION("Walls split regions and blocked tiles have no component")
+    {
+        // Full-height wall at x = 10, and a wall box isolating (30, 2)
+        for (int y = 0; y < 6; ++y)
+        {
+            set_wall(grid, 10, y);
+        }
+        set_wall(grid, 29, 2);
+        set_wall(grid, 31, 2);
+        set_wall(grid, 30, 1);
+        set_wall(grid, 30, 3);
+
+        REQUIRE(components.label(grid) == 3);
+        REQUIRE_FALSE(components.get_component_at(Vector2i(10, 3)).has_value());
+        REQUIRE_FALSE(components.get_component_at(Vector2i(-1, 0)).has_value());
+
+        const auto left = components.get_component_at(Vector2i(0, 0));
+        const auto right = components.get_component_at(Vector2i(39, 5));
+        const auto pocket = components.get_component_at(Vector2i(30, 2));
+        REQUIRE(left.has_value());
+        REQUIRE(right.has_value());
+        REQUIRE(pocket.has_value());
+        REQUIRE(left != right);
+        REQUIRE(pocket != right);
+
+        REQUIRE(components.get_component_sizes()[*left] == 60);
+        REQUIRE(components.get_component_sizes()[*pocket] == 1);
+        REQUIRE(components.get_component_sizes()[*right] == 240 - 60 - 6 - 4 - 1);
+        REQUIRE(components.get_largest_component() == right);
+    }
+
+    SECTION("U-shaped regions merge into one label")
+    {
+        // Walls form a U; both arms join only along the bottom row
+        for (int y = 0; y < 5; ++y)
+        {
+            set_wall(grid, 5, y);
+        }
+        REQUIRE(components.label(grid) == 1);
+        REQUIRE(components.get_component_at(Vector2i(4, 0)) ==
+                components.get_component_at(Vector2i(6, 0)));
+    }
+
+    SECTION("Generated maps are fully connected")
+    {
+        for (const int seed : {1, 42, 777, 2024})
+        {
+            GeneratorConfig config = GeneratorConfig::default_config();
+            config.width = 70;
+            config.height = 45;
+            config.seed = seed;
+
+            MapGenerator generator(config);
+            const Grid generated = generator.generate();
+            REQUIRE(components.label(generated) == 1);
+        }
+    }
+}
+// NOLINTEND
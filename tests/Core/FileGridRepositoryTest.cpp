@@ -0,0 +1,174 @@
+#include "Tactics/Core/FileGridRepository.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/MapGenerator.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+TEST_CASE("FileGridRepository", "[GridRepository]")
+{
+    const std::string test_dir = "test_file_maps";
+    std::filesystem::remove_all(test_dir);
+
+    FileGridRepository repository(test_dir);
+
+    // Spans a partial chunk on both axes
+    GeneratorConfig config = GeneratorConfig::default_config();
+    config.width = 70;
+    config.height = 45;
+    config.seed = 11;
+    MapGenerator generator(config);
+    const Grid grid = generator.generate();
+
+    SECTION("Maps round-trip through page-aligned files")
+    {
+        REQUIRE(repository.save_map("island", grid));
+
+        auto loaded = repository.load_map("island");
+        REQUIRE(loaded.has_value());
+        REQUIRE(loaded->get_width() == 70);
+        REQUIRE(loaded->get_height() == 45);
+        REQUIRE(std::ranges::equal(loaded->get_tile_types(), grid.get_tile_types()));
+        REQUIRE(std::ranges::equal(loaded->get_move_costs(), grid.get_move_costs()));
+        REQUIRE_FALSE(loaded->has_dirty_chunks());
+        REQUIRE(loaded->get_tile(Vector2i(69, 44))->get_type() ==
+                grid.get_tile(Vector2i(69, 44))->get_type());
+    }
+
+    SECTION("Maps are listed, found and deleted")
+    {
+        Grid small;
+        small.resize(5, 6);
+        REQUIRE(repository.save_map("beta", small));
+        REQUIRE(repository.save_map("alpha", grid));
+
+        const auto maps = repository.list_maps();
+        REQUIRE(maps.size() == 2);
+        REQUIRE(maps[0].name == "alpha");
+        REQUIRE(maps[0].width == 70);
+        REQUIRE(maps[1].name == "beta");
+        REQUIRE(maps[1].height == 6);
+        REQUIRE(maps[0].created_at.size() == 19);
+
+        REQUIRE(repository.map_exists("alpha"));
+        REQUIRE(repository.delete_map("alpha"));
+        REQUIRE_FALSE(repository.map_exists("alpha"));
+        REQUIRE_FALSE(repository.delete_map("alpha"));
+        REQUIRE_FALSE(repository.load_map("alpha").has_value());
+    }
+
+    SECTION("Names that are not plain file names are rejected")
+    {
+        REQUIRE_FALSE(repository.save_map("../escape", grid));
+        REQUIRE_FALSE(repository.save_map(".hidden", grid));
+        REQUIRE_FALSE(repository.save_map("", grid));
+    }
+
+    SECTION("Generator configs are stored beside the map")
+    {
+        REQUIRE(repository.save_map("generated", grid));
+        REQUIRE_FALSE(repository.load_generator_config("generated").has_value());
+        REQUIRE(repository.save_generator_config("generated", config));
+
+        const auto loaded = repository.load_generator_config("generated");
+        REQUIRE(loaded.has_value());
+        REQUIRE(loaded->width == 70);
+        REQUIRE(loaded->height == 45);
+        REQUIRE(loaded->seed == 11);
+        REQUIRE(loaded->forest_threshold == config.forest_threshold);
+
+        REQUIRE(repository.delete_map("generated"));
+        REQUIRE_FALSE(repository.load_generator_config("generated").has_value());
+    }
+
+    SECTION("Truncated or foreign files are rejected")
+    {
+        REQUIRE(repository.save_map("damaged", grid));
+        std::filesystem::resize_file(repository.path_for("damaged"),
+                                     FileGridRepository::PAGE_SIZE + 100);
+        REQUIRE_FALSE(repository.load_map("damaged").has_value());
+
+        {
+            std::ofstream stream(repository.path_for("foreign"), std::ios::binary);
+            stream << "not a map";
+        }
+        REQUIRE_FALSE(repository.load_map("foreign").has_value());
+        REQUIRE_FALSE(repository.map_exists("foreign"));
+    }
+
+    SECTION("Unchanged grids are not rewritten")
+    {
+        REQUIRE(repository.save_map("steady", grid));
+        auto loaded = repository.load_map("steady");
+        REQUIRE(loaded.has_value());
+
+        // Removing the file shows whether a save wrote anything
+        std::filesystem::remove(repository.path_for("steady"));
+        REQUIRE(repository.save_map_changes("steady", *loaded));
+        REQUIRE_FALSE(std::filesystem::exists(repository.path_for("steady")));
+
+        loaded->set_tile(Vector2i(3, 3), Tile(Vector2i(3, 3), Tile::Type::Mountain, 3));
+        REQUIRE(repository.save_map_changes("steady", *loaded));
+        REQUIRE(std::filesystem::exists(repository.path_for("steady")));
+
+        const auto reloaded = repository.load_map("steady");
+        REQUIRE(reloaded.has_value());
+        REQUIRE(reloaded->get_tile(Vector2i(3, 3))->get_type() == Tile::Type::Mountain);
+    }
+
+    SECTION("The chunk index holds per-chunk content hashes")
+    {
+        Grid uniform;
+        uniform.resize(96, 32);
+        REQUIRE(repository.save_map("uniform", uniform));
+
+        const auto hashes = repository.load_chunk_hashes("uniform");
+        REQUIRE(hashes.size() == 3);
+        REQUIRE(hashes[0] == hashes[1]);
+        REQUIRE(hashes[0] == FileGridRepository::hash_chunk(uniform, 0, 0));
+
+        uniform.set_tile(Vector2i(40, 5), Tile(Vector2i(40, 5), Tile::Type::Water, -1));
+        REQUIRE(repository.save_map("uniform", uniform));
+        const auto changed = repository.load_chunk_hashes("uniform");
+        REQUIRE(changed[0] == hashes[0]);
+        REQUIRE(changed[1] != hashes[1]);
+
+        FileGridRepository without_index(test_dir, false);
+        REQUIRE(without_index.save_map("plain", uniform));
+        REQUIRE(without_index.load_chunk_hashes("plain").empty());
+        REQUIRE(without_index.load_map("plain").has_value());
+    }
+
+    SECTION("Encoded chunks are smaller than raw planes and load the same")
+    {
+        FileGridRepository planes(test_dir, true, FileGridRepository::TileLayout::Planes);
+        REQUIRE(planes.save_map("planes", grid));
+        REQUIRE(repository.save_map("encoded", grid));
+        REQUIRE(std::filesystem::file_size(repository.path_for("encoded")) <
+                std::filesystem::file_size(planes.path_for("planes")));
+
+        // Either layout is readable whichever way the repository writes
+        for (const std::string name : {"planes", "encoded"})
+        {
+            auto loaded = repository.load_map(name);
+            REQUIRE(loaded.has_value());
+            REQUIRE(std::ranges::equal(loaded->get_tile_types(), grid.get_tile_types()));
+            REQUIRE(std::ranges::equal(loaded->get_move_costs(), grid.get_move_costs()));
+        }
+
+        Grid chunk_grid;
+        chunk_grid.resize(70, 45);
+        REQUIRE(planes.load_chunk("encoded", chunk_grid.get_chunk(2, 1)));
+        REQUIRE(std::ranges::equal(chunk_grid.get_chunk(2, 1).tile_types,
+                                   grid.get_chunk(2, 1).tile_types));
+    }
+
+    std::filesystem::remove_all(test_dir);
+}
+// NOLINTEND
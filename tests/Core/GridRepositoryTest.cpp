@@ -1,8 +1,12 @@
 #include "Tactics/Components/Grid.hpp"
+#include "Tactics/Core/SQLiteDatabase.hpp"
 #include "Tactics/Core/SQLiteGridRepository.hpp"
 #include "Tactics/Components/Tile.hpp"
+#include "SQLiteTestDatabase.hpp"
+#include <algorithm>
 #include <catch2/catch_test_macros.hpp>
-#include <filesystem>
+#include <memory>
+#include <vector>
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-do-while,cppcoreguidelines-avoid-magic-numbers,readability-function-cognitive-complexity,readability-identifier-length,readability-magic-numbers)
 // NOLINTNEXTLINE(readability-function-cognitive-complexity)
@@ -10,7 +14,7 @@ TEST_CASE("SQLiteGridRepository - Save and Load Map", "[GridRepository]")
 {
     // Use a temporary database for testing
     const std::string test_db = "test_maps.db";
-    std::filesystem::remove(test_db); // Clean up any existing test DB
+    Tactics::Testing::remove_database(test_db); // Clean up any existing test DB
 
     Tactics::SQLiteGridRepository repository(test_db);
 
@@ -47,11 +51,11 @@ TEST_CASE("SQLiteGridRepository - Save and Load Map", "[GridRepository]")
             for (int x = 0; x < 10; ++x)
             {
                 Tactics::Vector2i pos(x, y);
-                const Tactics::Tile *original = grid.get_tile(pos);
-                const Tactics::Tile *loaded = loaded_grid.get_tile(pos);
+                const auto original = grid.get_tile(pos);
+                const auto loaded = loaded_grid.get_tile(pos);
 
-                REQUIRE(original != nullptr);
-                REQUIRE(loaded != nullptr);
+                REQUIRE(original.has_value());
+                REQUIRE(loaded.has_value());
                 REQUIRE(original->get_type() == loaded->get_type());
                 REQUIRE(original->get_move_cost() == loaded->get_move_cost());
             }
@@ -123,10 +127,102 @@ TEST_CASE("SQLiteGridRepository - Save and Load Map", "[GridRepository]")
         grid.resize(4, 4);
 
         REQUIRE(repository.save_map("delete_test", grid));
+        REQUIRE(repository.save_generator_config("delete_test",
+                                                 Tactics::GeneratorConfig::default_config()));
         REQUIRE(repository.map_exists("delete_test"));
 
         REQUIRE(repository.delete_map("delete_test"));
         REQUIRE_FALSE(repository.map_exists("delete_test"));
+        REQUIRE_FALSE(repository.load_generator_config("delete_test").has_value());
+    }
+
+    SECTION("Legacy tile rows are migrated on first load")
+    {
+        sqlite3 *db = nullptr;
+        REQUIRE(sqlite3_open(test_db.c_str(), &db) == SQLITE_OK);
+        REQUIRE(sqlite3_exec(db, "INSERT INTO maps (name, width, height) VALUES ('legacy', 3, 2)",
+                             nullptr, nullptr, nullptr) == SQLITE_OK);
+        const auto legacy_id = sqlite3_last_insert_rowid(db);
+
+        for (int y = 0; y < 2; ++y)
+        {
+            for (int x = 0; x < 3; ++x)
+            {
+                const std::string insert_sql =
+                    "INSERT INTO tiles (map_id, x, y, tile_type, move_cost) VALUES (" +
+                    std::to_string(legacy_id) + ", " + std::to_string(x) + ", " +
+                    std::to_string(y) + ", " + std::to_string(x + y) + ", " +
+                    std::to_string(x - y) + ")";
+                REQUIRE(sqlite3_exec(db, insert_sql.c_str(), nullptr, nullptr, nullptr) ==
+                        SQLITE_OK);
+            }
+        }
+
+        auto loaded_opt = repository.load_map("legacy");
+        REQUIRE(loaded_opt.has_value());
+
+        for (int y = 0; y < 2; ++y)
+        {
+            for (int x = 0; x < 3; ++x)
+            {
+                const auto tile = loaded_opt->get_tile(Tactics::Vector2i(x, y));
+                REQUIRE(tile.has_value());
+                REQUIRE(tile->get_type() == static_cast<Tactics::Tile::Type>(x + y));
+                REQUIRE(tile->get_move_cost() == x - y);
+            }
+        }
+
+        sqlite3_stmt *stmt = nullptr;
+        REQUIRE(sqlite3_prepare_v2(db, "SELECT COUNT(*) FROM tiles", -1, &stmt, nullptr) ==
+                SQLITE_OK);
+        REQUIRE(sqlite3_step(stmt) == SQLITE_ROW);
+        REQUIRE(sqlite3_column_int(stmt, 0) == 0);
+        sqlite3_finalize(stmt);
+        sqlite3_close(db);
+
+        auto reloaded_opt = repository.load_map("legacy");
+        REQUIRE(reloaded_opt.has_value());
+        REQUIRE(reloaded_opt->get_tile(Tactics::Vector2i(2, 0))->get_move_cost() == 2);
+    }
+
+    SECTION("Legacy tile rows with invalid types are left in place")
+    {
+        sqlite3 *db = nullptr;
+        REQUIRE(sqlite3_open(test_db.c_str(), &db) == SQLITE_OK);
+        REQUIRE(sqlite3_exec(db, "INSERT INTO maps (name, width, height) VALUES ('bad', 2, 1)",
+                             nullptr, nullptr, nullptr) == SQLITE_OK);
+        const std::string bad_id = std::to_string(sqlite3_last_insert_rowid(db));
+        const std::string insert_sql =
+            "INSERT INTO tiles (map_id, x, y, tile_type, move_cost) VALUES (" + bad_id +
+            ", 0, 0, 0, 1), (" + bad_id + ", 1, 0, 200, 1)";
+        REQUIRE(sqlite3_exec(db, insert_sql.c_str(), nullptr, nullptr, nullptr) == SQLITE_OK);
+
+        REQUIRE_FALSE(repository.load_map("bad").has_value());
+
+        sqlite3_stmt *stmt = nullptr;
+        REQUIRE(sqlite3_prepare_v2(db, "SELECT COUNT(*) FROM tiles", -1, &stmt, nullptr) ==
+                SQLITE_OK);
+        REQUIRE(sqlite3_step(stmt) == SQLITE_ROW);
+        REQUIRE(sqlite3_column_int(stmt, 0) == 2);
+        sqlite3_finalize(stmt);
+        sqlite3_close(db);
+    }
+
+    SECTION("Single chunks are read on their own")
+    {
+        Tactics::Grid grid;
+        grid.resize(40, 34);
+        grid.set_tile(Tactics::Vector2i(35, 33),
+                      Tactics::Tile(Tactics::Vector2i(35, 33), Tactics::Tile::Type::Road, 1));
+        REQUIRE(repository.save_map("chunked", grid));
+        REQUIRE(repository.get_map_size("chunked") == Tactics::Vector2i(40, 34));
+
+        Tactics::Grid target;
+        target.resize(40, 34);
+        REQUIRE(repository.load_chunk("chunked", target.get_chunk(1, 1)));
+        REQUIRE(target.get_tile(Tactics::Vector2i(35, 33))->get_type() ==
+                Tactics::Tile::Type::Road);
+        REQUIRE_FALSE(repository.load_chunk("nonexistent_map", target.get_chunk(0, 0)));
     }
 
     SECTION("Load non-existent map")
@@ -136,7 +232,7 @@ TEST_CASE("SQLiteGridRepository - Save and Load Map", "[GridRepository]")
     }
 
     // Cleanup
-    std::filesystem::remove(test_db);
+    Tactics::Testing::remove_database(test_db);
 }
 
 // NOLINTEND(cppcoreguidelines-avoid-do-while,cppcoreguidelines-avoid-magic-numbers,readability-function-cognitive-complexity,readability-identifier-length,readability-magic-numbers)
@@ -144,7 +240,7 @@ TEST_CASE("SQLiteGridRepository - Save and Load Map", "[GridRepository]")
 TEST_CASE("SQLiteGridRepository - Large Map Performance", "[GridRepository][Performance]")
 {
     const std::string test_db = "test_large_maps.db";
-    std::filesystem::remove(test_db);
+    Tactics::Testing::remove_database(test_db);
 
     Tactics::SQLiteGridRepository repository(test_db);
 
@@ -180,16 +276,207 @@ TEST_CASE("SQLiteGridRepository - Large Map Performance", "[GridRepository][Perf
             int x = i % 256;
             int y = i / 256;
             Tactics::Vector2i pos(x, y);
-            const Tactics::Tile *original = grid.get_tile(pos);
-            const Tactics::Tile *loaded_tile = loaded.get_tile(pos);
+            const auto original = grid.get_tile(pos);
+            const auto loaded_tile = loaded.get_tile(pos);
 
-            REQUIRE(original != nullptr);
-            REQUIRE(loaded_tile != nullptr);
+            REQUIRE(original.has_value());
+            REQUIRE(loaded_tile.has_value());
             REQUIRE(original->get_type() == loaded_tile->get_type());
             REQUIRE(original->get_move_cost() == loaded_tile->get_move_cost());
         }
     }
 
     // Cleanup
-    std::filesystem::remove(test_db);
+    Tactics::Testing::remove_database(test_db);
+}
+
+TEST_CASE("SQLiteGridRepository - Delta Saves", "[GridRepository]")
+{
+    const std::string test_db = "test_delta_maps.db";
+    Tactics::Testing::remove_database(test_db);
+
+    {
+        auto database = std::make_shared<Tactics::SQLiteDatabase>(test_db);
+        Tactics::SQLiteGridRepository repository(database);
+        const auto total_changes = [&] { return sqlite3_total_changes(database->get_handle()); };
+
+        Tactics::Grid grid;
+        grid.resize(100, 70);
+        REQUIRE(repository.save_map_changes("delta", grid));
+
+        auto loaded_opt = repository.load_map("delta");
+        REQUIRE(loaded_opt.has_value());
+        Tactics::Grid &loaded = loaded_opt.value();
+        REQUIRE_FALSE(loaded.has_dirty_chunks());
+
+        SECTION("Unchanged grids are not written")
+        {
+            const int before = total_changes();
+            REQUIRE(repository.save_map_changes("delta", loaded));
+            REQUIRE(total_changes() == before);
+        }
+
+        SECTION("Only dirty chunks are written")
+        {
+            const Tactics::Vector2i position(70, 40);
+            loaded.set_tile(position, Tactics::Tile(position, Tactics::Tile::Type::Mountain, 3));
+            REQUIRE(loaded.get_dirty_chunk_count() == 1);
+
+            const int before = total_changes();
+            REQUIRE(repository.save_map_changes("delta", loaded));
+
+            // One metadata row and one chunk row
+            REQUIRE(total_changes() - before == 2);
+
+            const auto reloaded = repository.load_map("delta");
+            REQUIRE(reloaded.has_value());
+            REQUIRE(reloaded->get_tile(position)->get_type() == Tactics::Tile::Type::Mountain);
+            REQUIRE(reloaded->get_tile(Tactics::Vector2i(0, 0))->get_type() ==
+                    Tactics::Tile::Type::Grass);
+        }
+
+        SECTION("Size changes fall back to a full save")
+        {
+            Tactics::Grid resized;
+            resized.resize(40, 40);
+            resized.clear_dirty_chunks();
+            resized.mark_chunk_changed(0, 0);
+            REQUIRE(repository.save_map_changes("delta", resized));
+
+            const auto reloaded = repository.load_map("delta");
+            REQUIRE(reloaded.has_value());
+            REQUIRE(reloaded->get_width() == 40);
+        }
+    }
+
+    Tactics::Testing::remove_database(test_db);
+}
+
+TEST_CASE("SQLiteGridRepository - Versions", "[GridRepository]")
+{
+    const std::string test_db = "test_version_maps.db";
+    Tactics::Testing::remove_database(test_db);
+
+    {
+        auto database = std::make_shared<Tactics::SQLiteDatabase>(test_db);
+        Tactics::SQLiteGridRepository repository(database);
+        const auto content_count = [&]
+        {
+            sqlite3_stmt *stmt = nullptr;
+            REQUIRE(sqlite3_prepare_v2(database->get_handle(),
+                                       "SELECT COUNT(*) FROM chunk_contents", -1, &stmt,
+                                       nullptr) == SQLITE_OK);
+            REQUIRE(sqlite3_step(stmt) == SQLITE_ROW);
+            const int count = sqlite3_column_int(stmt, 0);
+            sqlite3_finalize(stmt);
+            return count;
+        };
+
+        // Four by three chunks
+        Tactics::Grid grid;
+        grid.resize(100, 70);
+        REQUIRE(repository.save_map("history", grid));
+        REQUIRE_FALSE(repository.create_version("missing", grid).has_value());
+        REQUIRE(repository.create_version("history", grid, "base") == 1);
+
+        const Tactics::Vector2i edit(70, 40);
+        Tactics::Grid edited;
+        edited.resize(100, 70);
+        edited.set_tile(edit, Tactics::Tile(edit, Tactics::Tile::Type::Mountain, 3));
+
+        // Only the edited chunk is new; an unchanged snapshot stores nothing
+        const int contents_before = content_count();
+        REQUIRE(repository.create_version("history", edited, "mountain") == 2);
+        REQUIRE(content_count() == contents_before + 1);
+        REQUIRE(repository.create_version("history", edited) == 3);
+        REQUIRE(content_count() == contents_before + 1);
+
+        SECTION("Versions are listed with the chunks they stored")
+        {
+            const auto versions = repository.list_versions("history");
+            REQUIRE(versions.size() == 3);
+            REQUIRE(versions[0].label == "base");
+            REQUIRE(versions[0].stored_chunk_count == 12);
+            REQUIRE(versions[1].label == "mountain");
+            REQUIRE(versions[1].stored_chunk_count == 1);
+            REQUIRE(versions[2].stored_chunk_count == 0);
+            REQUIRE(versions[2].width == 100);
+            REQUIRE_FALSE(versions[2].created_at.empty());
+        }
+
+        SECTION("Each version loads as it was recorded")
+        {
+            const auto base = repository.load_version("history", 1);
+            REQUIRE(base.has_value());
+            REQUIRE(base->get_tile(edit)->get_type() == Tactics::Tile::Type::Grass);
+
+            const auto latest = repository.load_version("history", 3);
+            REQUIRE(latest.has_value());
+            REQUIRE(latest->get_tile(edit)->get_type() == Tactics::Tile::Type::Mountain);
+            REQUIRE(latest->get_move_costs().size() == edited.get_move_costs().size());
+            REQUIRE(std::equal(latest->get_tile_types().begin(), latest->get_tile_types().end(),
+                               edited.get_tile_types().begin()));
+
+            REQUIRE_FALSE(repository.load_version("history", 4).has_value());
+        }
+
+        SECTION("Edits already saved are still recorded by the next version")
+        {
+            const Tactics::Vector2i saved_edit(10, 10);
+            edited.set_tile(saved_edit, Tactics::Tile(saved_edit, Tactics::Tile::Type::Water, 0));
+            REQUIRE(repository.save_map_changes("history", edited));
+            edited.clear_dirty_chunks();
+
+            REQUIRE(repository.create_version("history", edited) == 4);
+            REQUIRE(repository.list_versions("history").back().stored_chunk_count == 1);
+
+            const auto loaded = repository.load_version("history", 4);
+            REQUIRE(loaded.has_value());
+            REQUIRE(loaded->get_tile(saved_edit)->get_type() == Tactics::Tile::Type::Water);
+            REQUIRE(loaded->get_tile(edit)->get_type() == Tactics::Tile::Type::Mountain);
+        }
+
+        SECTION("Diffs list the chunks that changed")
+        {
+            const auto diff = repository.diff_versions("history", 1, 3);
+            REQUIRE(diff.has_value());
+            REQUIRE(diff->changed_chunks == std::vector<Tactics::Vector2i>{{2, 1}});
+            REQUIRE(repository.diff_versions("history", 2, 3)->changed_chunks.empty());
+
+            Tactics::Grid shrunk;
+            shrunk.resize(40, 40);
+            REQUIRE(repository.create_version("history", shrunk) == 4);
+            REQUIRE(repository.list_versions("history").back().stored_chunk_count == 4);
+
+            const auto resized = repository.diff_versions("history", 3, 4);
+            REQUIRE(resized.has_value());
+            REQUIRE(resized->from_size == Tactics::Vector2i(100, 70));
+            REQUIRE(resized->to_size == Tactics::Vector2i(40, 40));
+            REQUIRE(resized->changed_chunks.size() >= 8);
+
+            const auto reloaded = repository.load_version("history", 4);
+            REQUIRE(reloaded.has_value());
+            REQUIRE(reloaded->get_width() == 40);
+        }
+
+        SECTION("Restoring a version overwrites the current map")
+        {
+            REQUIRE(repository.save_map("history", edited));
+            REQUIRE(repository.restore_version("history", 1));
+
+            const auto restored = repository.load_map("history");
+            REQUIRE(restored.has_value());
+            REQUIRE(restored->get_tile(edit)->get_type() == Tactics::Tile::Type::Grass);
+            REQUIRE(repository.list_versions("history").size() == 3);
+        }
+
+        SECTION("Deleting the map drops its history")
+        {
+            REQUIRE(repository.delete_map("history"));
+            REQUIRE(repository.list_versions("history").empty());
+            REQUIRE(content_count() == 0);
+        }
+    }
+
+    Tactics::Testing::remove_database(test_db);
 }
@@ -0,0 +1,92 @@
+#include "Tactics/Core/LazyMapView.hpp"
+#include "Tactics/Components/Camera.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Core/FileGridRepository.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    // Ten by ten chunks with a tile pattern that differs between chunks
+    auto make_grid() -> Grid
+    {
+        Grid grid;
+        grid.resize(320, 310);
+        for (int y = 0; y < 310; ++y)
+        {
+            for (int x = 0; x < 320; ++x)
+            {
+                const bool water = ((x / 7) + (y / 5)) % 3 == 0;
+                grid.set_tile(Vector2i(x, y), Tile(Vector2i(x, y),
+                                                   water ? Tile::Type::Water : Tile::Type::Grass,
+                                                   water ? -1 : 1));
+            }
+        }
+        return grid;
+    }
+
+    auto make_camera(Vector2f position) -> Camera
+    {
+        return Camera(CameraSettings{
+            .position = position, .zoom = 1.0F, .viewport_width = 10.0F, .viewport_height = 10.0F});
+    }
+} // namespace
+
+TEST_CASE("LazyMapView", "[Core]")
+{
+    const std::string test_dir = "test_lazy_maps";
+    std::filesystem::remove_all(test_dir);
+
+    const Grid grid = make_grid();
+    FileGridRepository repository(test_dir);
+    REQUIRE(repository.save_map("huge", grid));
+
+    LazyMapView view(&repository, "huge");
+
+    SECTION("Opening reads only the map size")
+    {
+        REQUIRE(view.is_open());
+        REQUIRE(view.get_width() == 320);
+        REQUIRE(view.get_height() == 310);
+        REQUIRE(view.get_chunks_x() == 10);
+        REQUIRE(view.get_chunks_y() == 10);
+
+        LazyMapView missing(&repository, "missing");
+        REQUIRE_FALSE(missing.is_open());
+        REQUIRE(missing.get_chunks_x() == 0);
+    }
+
+    SECTION("The camera view maps to the chunks under it")
+    {
+        const Camera camera = make_camera(Vector2f(48.0F, 48.0F));
+        REQUIRE(view.get_chunk_range(camera.get_view_rect(), 1.0F) == Recti(1, 1, 1, 1));
+
+        // Clamped to the map at its far edge
+        const Camera corner = make_camera(Vector2f(318.0F, 308.0F));
+        REQUIRE(view.get_chunk_range(corner.get_view_rect(), 1.0F) == Recti(9, 9, 1, 1));
+    }
+
+    SECTION("Motion extends the prefetch range ahead of the camera")
+    {
+        Camera camera = make_camera(Vector2f(48.0F, 48.0F));
+        view.track_camera(camera, 0.1F);
+        REQUIRE(view.get_prefetch_range(camera, 1.0F) == Recti(1, 1, 1, 1));
+
+        // Standing still adds nothing to the view
+        view.track_camera(camera, 0.1F);
+        REQUIRE(view.get_prefetch_range(camera, 1.0F) == Recti(1, 1, 1, 1));
+
+        camera.set_position(Vector2f(56.0F, 48.0F));
+        view.track_camera(camera, 0.1F);
+        REQUIRE(view.get_camera_velocity().x > 0.0F);
+        REQUIRE(view.get_prefetch_range(camera, 1.0F) == Recti(1, 1, 2, 1));
+        REQUIRE(view.get_prefetch_range(camera, 1.0F, 0.0F) == Recti(1, 1, 1, 1));
+    }
+
+    std::filesystem::remove_all(test_dir);
+}
+// NOLINTEND
@@ -0,0 +1,109 @@
+#include "Tactics/Core/MapCache.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Core/GeneratorConfig.hpp"
+#include "Tactics/Core/MapGenerator.hpp"
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+TEST_CASE("MapCache", "[Core]")
+{
+    const std::string test_dir = "test_map_cache";
+    std::filesystem::remove_all(test_dir);
+
+    GeneratorConfig config = GeneratorConfig::default_config();
+    config.width = 45;
+    config.height = 38;
+    config.seed = 7;
+
+    MapCache cache(test_dir);
+
+    SECTION("Keys cover output-affecting fields only")
+    {
+        const auto key = MapCache::key_of(config);
+
+        GeneratorConfig threads = config;
+        threads.thread_count = 3;
+        REQUIRE(MapCache::key_of(threads) == key);
+
+        GeneratorConfig seed = config;
+        seed.seed += 1;
+        REQUIRE(MapCache::key_of(seed) != key);
+
+        GeneratorConfig threshold = config;
+        threshold.forest_threshold += 0.01F;
+        REQUIRE(MapCache::key_of(threshold) != key);
+    }
+
+    SECTION("Misses generate and store, hits load the same map")
+    {
+        REQUIRE_FALSE(cache.load(config).has_value());
+
+        const Grid generated = cache.get_or_generate(config);
+        REQUIRE(cache.get_miss_count() == 1);
+        REQUIRE(std::filesystem::exists(cache.path_for(MapCache::key_of(config))));
+
+        const Grid cached = cache.get_or_generate(config);
+        REQUIRE(cache.get_hit_count() == 1);
+        REQUIRE(cached.get_width() == 45);
+        REQUIRE(cached.get_height() == 38);
+        REQUIRE(std::ranges::equal(cached.get_tile_types(), generated.get_tile_types()));
+        REQUIRE(std::ranges::equal(cached.get_move_costs(), generated.get_move_costs()));
+
+        MapGenerator generator(config);
+        const Grid fresh = generator.generate();
+        REQUIRE(std::ranges::equal(cached.get_tile_types(), fresh.get_tile_types()));
+    }
+
+    SECTION("Concurrent stores of one key leave a whole entry")
+    {
+        MapGenerator generator(config);
+        const Grid grid = generator.generate();
+        std::atomic<int> failed_stores{0};
+        {
+            std::vector<std::jthread> writers;
+            for (int writer = 0; writer < 4; ++writer)
+            {
+                writers.emplace_back(
+                    [&]
+                    {
+                        for (int store = 0; store < 10; ++store)
+                        {
+                            if (!cache.store(config, grid))
+                            {
+                                ++failed_stores;
+                            }
+                        }
+                    });
+            }
+        }
+
+        REQUIRE(failed_stores.load() == 0);
+        const auto loaded = cache.load(config);
+        REQUIRE(loaded.has_value());
+        REQUIRE(std::ranges::equal(loaded->get_tile_types(), grid.get_tile_types()));
+        REQUIRE(std::distance(std::filesystem::directory_iterator(test_dir),
+                              std::filesystem::directory_iterator()) == 1);
+    }
+
+    SECTION("Corrupt entries are ignored")
+    {
+        REQUIRE(cache.store(config, cache.get_or_generate(config)));
+        {
+            std::ofstream stream(cache.path_for(MapCache::key_of(config)),
+                                 std::ios::binary | std::ios::trunc);
+            stream << "TMAP";
+        }
+        REQUIRE_FALSE(cache.load(config).has_value());
+    }
+
+    std::filesystem::remove_all(test_dir);
+}
+// NOLINTEND
@@ -1,8 +1,10 @@
 #include "Tactics/Core/MapGenerator.hpp"
 #include "Tactics/Components/Grid.hpp"
 #include "Tactics/Components/Tile.hpp"
+#include "Tactics/Core/ThreadPool.hpp"
 #include "Tactics/Core/Vector2.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
 #include <array>
 #include <queue>
 #include <unordered_set>
@@ -48,8 +50,8 @@ namespace
                     continue;
                 }
 
-                const Tactics::Tile *tile = grid.get_tile(neighbor);
-                if (tile != nullptr && tile->is_walkable())
+                const auto tile = grid.get_tile(neighbor);
+                if (tile.has_value() && tile->is_walkable())
                 {
                     visited.insert(hash);
                     to_visit.push(neighbor);
@@ -91,9 +93,9 @@ TEST_CASE("MapGenerator - Basic Generation", "[MapGenerator]")
             for (int x = 0; x < config.width; ++x)
             {
                 const Tactics::Vector2i pos(x, y);
-                const Tactics::Tile *tile = grid.get_tile(pos);
+                const auto tile = grid.get_tile(pos);
 
-                REQUIRE(tile != nullptr);
+                REQUIRE(tile.has_value());
 
                 const auto type = tile->get_type();
                 REQUIRE((type == Tactics::Tile::Type::Grass || type == Tactics::Tile::Type::Water ||
@@ -119,8 +121,8 @@ TEST_CASE("MapGenerator - Basic Generation", "[MapGenerator]")
             for (int x = 0; x < config.width; ++x)
             {
                 const Tactics::Vector2i pos(x, y);
-                const Tactics::Tile *tile = grid.get_tile(pos);
-                if (tile != nullptr && tile->is_walkable())
+                const auto tile = grid.get_tile(pos);
+                if (tile.has_value() && tile->is_walkable())
                 {
                     ++walkable_count;
                 }
@@ -153,11 +155,11 @@ TEST_CASE("MapGenerator - Determinism", "[MapGenerator]")
             for (int x = 0; x < config.width; ++x)
             {
                 const Tactics::Vector2i pos(x, y);
-                const Tactics::Tile *tile1 = grid1.get_tile(pos);
-                const Tactics::Tile *tile2 = grid2.get_tile(pos);
+                const auto tile1 = grid1.get_tile(pos);
+                const auto tile2 = grid2.get_tile(pos);
 
-                REQUIRE(tile1 != nullptr);
-                REQUIRE(tile2 != nullptr);
+                REQUIRE(tile1.has_value());
+                REQUIRE(tile2.has_value());
                 REQUIRE(tile1->get_type() == tile2->get_type());
                 REQUIRE(tile1->get_move_cost() == tile2->get_move_cost());
             }
@@ -186,10 +188,10 @@ TEST_CASE("MapGenerator - Determinism", "[MapGenerator]")
             for (int x = 0; x < config1.width; ++x)
             {
                 const Tactics::Vector2i pos(x, y);
-                const Tactics::Tile *tile1 = grid1.get_tile(pos);
-                const Tactics::Tile *tile2 = grid2.get_tile(pos);
+                const auto tile1 = grid1.get_tile(pos);
+                const auto tile2 = grid2.get_tile(pos);
 
-                if (tile1 != nullptr && tile2 != nullptr &&
+                if (tile1.has_value() && tile2.has_value() &&
                     tile1->get_type() != tile2->get_type())
                 {
                     ++different_tiles;
@@ -199,6 +201,39 @@ TEST_CASE("MapGenerator - Determinism", "[MapGenerator]")
 
         REQUIRE(different_tiles >= (config1.width * config1.height) / 5);
     }
+
+    SECTION("Thread count does not change the result")
+    {
+        Tactics::GeneratorConfig config = Tactics::GeneratorConfig::default_config();
+        config.width = 150;
+        config.height = 110;
+        config.seed = 777;
+        config.thread_count = 1;
+
+        Tactics::MapGenerator serial_generator(config);
+        Tactics::Grid serial_grid = serial_generator.generate();
+
+        for (const int thread_count : {2, 5, 0})
+        {
+            config.thread_count = thread_count;
+            Tactics::MapGenerator parallel_generator(config);
+            Tactics::Grid parallel_grid = parallel_generator.generate();
+
+            REQUIRE(std::ranges::equal(serial_grid.get_tile_types(),
+                                       parallel_grid.get_tile_types()));
+            REQUIRE(std::ranges::equal(serial_grid.get_move_costs(),
+                                       parallel_grid.get_move_costs()));
+        }
+
+        // Generators sharing one pool, one after the other
+        Tactics::ThreadPool pool(3);
+        for (int run = 0; run < 2; ++run)
+        {
+            Tactics::MapGenerator shared_generator(config, &pool);
+            REQUIRE(std::ranges::equal(serial_grid.get_tile_types(),
+                                       shared_generator.generate().get_tile_types()));
+        }
+    }
 }
 
 TEST_CASE("MapGenerator - Connectivity", "[MapGenerator]")
@@ -214,13 +249,13 @@ TEST_CASE("MapGenerator - Connectivity", "[MapGenerator]")
     Tactics::Vector2i first_walkable(-1, -1);
     int total_walkable = 0;
 
-    for (int y = 0; y < config.height && first_walkable.x == -1; ++y)
+    for (int y = 0; y < config.height; ++y)
     {
         for (int x = 0; x < config.width; ++x)
         {
             const Tactics::Vector2i pos(x, y);
-            const Tactics::Tile *tile = grid.get_tile(pos);
-            if (tile != nullptr && tile->is_walkable())
+            const auto tile = grid.get_tile(pos);
+            if (tile.has_value() && tile->is_walkable())
             {
                 if (first_walkable.x == -1)
                 {
@@ -237,4 +272,69 @@ TEST_CASE("MapGenerator - Connectivity", "[MapGenerator]")
     REQUIRE(connected_count == total_walkable);
 }
 
+TEST_CASE("MapGenerator - Regions", "[MapGenerator]")
+{
+    Tactics::GeneratorConfig config = Tactics::GeneratorConfig::default_config();
+    config.width = 90;
+    config.height = 70;
+    config.seed = 99;
+    config.thread_count = 1;
+
+    const Tactics::MapGenerator generator(config);
+    const auto whole = generator.generate_region(Tactics::Recti(0, 0, 90, 70));
+    REQUIRE(whole.size() == 90U * 70U);
+
+    SECTION("Sub-regions match the whole-map terrain")
+    {
+        const std::array<Tactics::Recti, 5> regions = {
+            Tactics::Recti(0, 0, 32, 32), Tactics::Recti(32, 32, 32, 32),
+            Tactics::Recti(64, 64, 26, 6), Tactics::Recti(5, 41, 17, 3),
+            Tactics::Recti(89, 0, 1, 70)};
+        for (const Tactics::Recti region : regions)
+        {
+            const auto tiles = generator.generate_region(region);
+            REQUIRE(tiles.size() == static_cast<size_t>(region.width * region.height));
+            for (int y = 0; y < region.height; ++y)
+            {
+                for (int x = 0; x < region.width; ++x)
+                {
+                    REQUIRE(tiles[static_cast<size_t>((y * region.width) + x)] ==
+                            whole[static_cast<size_t>(((region.y + y) * 90) + region.x + x)]);
+                }
+            }
+        }
+    }
+
+    SECTION("Whole-map terrain agrees with generate() before tactical features")
+    {
+        Tactics::MapGenerator full_generator(config);
+        const Tactics::Grid grid = full_generator.generate();
+        for (int y = 0; y < 70; ++y)
+        {
+            for (int x = 0; x < 90; ++x)
+            {
+                const auto type = grid.get_tile(Tactics::Vector2i(x, y))->get_type();
+                const auto terrain = whole[static_cast<size_t>((y * 90) + x)];
+
+                // Stage 4 only carves blocked tiles to grass and turns grass into roads
+                if (type == Tactics::Tile::Type::Grass || type == Tactics::Tile::Type::Road)
+                {
+                    REQUIRE((terrain == Tactics::Tile::Type::Grass ||
+                             Tactics::MapGenerator::move_cost_for(terrain) < 0));
+                }
+                else
+                {
+                    REQUIRE(type == terrain);
+                }
+            }
+        }
+    }
+
+    SECTION("Regions outside the map are rejected")
+    {
+        REQUIRE(generator.generate_region(Tactics::Recti(80, 0, 20, 5)).empty());
+        REQUIRE(generator.generate_region(Tactics::Recti(-1, 0, 5, 5)).empty());
+    }
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-do-while,cppcoreguidelines-avoid-magic-numbers,readability-function-cognitive-complexity,readability-identifier-length,readability-magic-numbers)
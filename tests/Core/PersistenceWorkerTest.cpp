@@ -0,0 +1,210 @@
+#include "Tactics/Core/PersistenceWorker.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Components/Unit.hpp"
+#include "Tactics/Core/SQLiteDatabase.hpp"
+#include "Tactics/Core/SQLiteGridRepository.hpp"
+#include "Tactics/Core/SQLiteUnitRepository.hpp"
+#include "SQLiteTestDatabase.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <future>
+#include <sqlite3.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    auto make_grid(Tile::Type type) -> Grid
+    {
+        Grid grid;
+        grid.resize(12, 9);
+        for (int y = 0; y < 9; ++y)
+        {
+            for (int x = 0; x < 12; ++x)
+            {
+                grid.set_tile(Vector2i(x, y), Tile(Vector2i(x, y), type, 1));
+            }
+        }
+        return grid;
+    }
+
+    // Wait until the worker has taken every queued job
+    void wait_until_taken(const PersistenceWorker &worker)
+    {
+        while (worker.get_pending_count() != 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+} // namespace
+
+TEST_CASE("PersistenceWorker", "[Core]")
+{
+    const std::string test_db = "test_persistence.db";
+    Testing::remove_database(test_db);
+
+    SECTION("Saves complete through futures")
+    {
+        PersistenceWorker worker(test_db);
+        auto map_saved = worker.save_map("async", make_grid(Tile::Type::Desert));
+        std::vector<Unit> saved_units;
+        saved_units.emplace_back(Vector2i(3, 4), 5);
+        auto units_saved = worker.save_units("async", saved_units);
+        REQUIRE(map_saved.get());
+        REQUIRE(units_saved.get());
+
+        SQLiteGridRepository repository(test_db);
+        const auto loaded = repository.load_map("async");
+        REQUIRE(loaded.has_value());
+        REQUIRE(loaded->get_tile(Vector2i(11, 8))->get_type() == Tile::Type::Desert);
+
+        SQLiteUnitRepository unit_repository(test_db);
+        const auto units = unit_repository.load_units("async");
+        REQUIRE(units.size() == 1);
+        REQUIRE(units[0].get_position() == Vector2i(3, 4));
+    }
+
+    SECTION("Snapshots are taken at call time")
+    {
+        PersistenceWorker worker(test_db);
+        Grid grid = make_grid(Tile::Type::Grass);
+        auto saved = worker.save_map("snapshot", grid);
+        grid.set_tile(Vector2i(0, 0), Tile(Vector2i(0, 0), Tile::Type::Water, -1));
+        REQUIRE(saved.get());
+
+        SQLiteGridRepository repository(test_db);
+        REQUIRE(repository.load_map("snapshot")->get_tile(Vector2i(0, 0))->get_type() ==
+                Tile::Type::Grass);
+    }
+
+    SECTION("Repeated saves coalesce to the latest snapshot")
+    {
+        PersistenceWorker worker(test_db);
+        std::vector<std::shared_future<bool>> futures;
+        {
+            // Hold the write lock so the first save stalls in the worker while the rest queue
+            SQLiteDatabase blocker(test_db);
+            SQLiteTransaction lock(blocker);
+            REQUIRE(lock.is_active());
+
+            futures.push_back(worker.save_map("busy", make_grid(Tile::Type::Grass)));
+            wait_until_taken(worker);
+            for (const auto type : {Tile::Type::Forest, Tile::Type::Water, Tile::Type::Desert,
+                                    Tile::Type::Mountain})
+            {
+                futures.push_back(worker.save_map("busy", make_grid(type)));
+            }
+            REQUIRE(worker.get_pending_count() == 1);
+            REQUIRE(worker.get_coalesced_count() == 3);
+        }
+        worker.flush();
+
+        REQUIRE(worker.get_pending_count() == 0);
+        for (const auto &future : futures)
+        {
+            REQUIRE(future.get());
+        }
+
+        SQLiteGridRepository repository(test_db);
+        REQUIRE(repository.load_map("busy")->get_tile(Vector2i(5, 5))->get_type() ==
+                Tile::Type::Mountain);
+    }
+
+    SECTION("Scenes are written as one unit of work")
+    {
+        PersistenceWorker worker(test_db);
+        std::vector<Unit> units;
+        units.emplace_back(Vector2i(2, 2), 3);
+        units.emplace_back(Vector2i(7, 1), 4);
+        auto saved = worker.save_scene("scene", make_grid(Tile::Type::Water), units,
+                                       GeneratorConfig::default_config());
+        REQUIRE(saved.get());
+
+        SQLiteGridRepository repository(test_db);
+        REQUIRE(repository.load_map("scene")->get_tile(Vector2i(3, 3))->get_type() ==
+                Tile::Type::Water);
+        REQUIRE(repository.load_generator_config("scene").has_value());
+        SQLiteUnitRepository unit_repository(test_db);
+        REQUIRE(unit_repository.load_units("scene").size() == 2);
+    }
+
+    SECTION("Saves of different kinds for one map keep their order")
+    {
+        PersistenceWorker worker(test_db);
+        GeneratorConfig first = GeneratorConfig::default_config();
+        first.seed = 1;
+        GeneratorConfig second = first;
+        second.seed = 2;
+
+        std::vector<Unit> units;
+        units.emplace_back(Vector2i(1, 1), 3);
+        {
+            SQLiteDatabase blocker(test_db);
+            SQLiteTransaction lock(blocker);
+            REQUIRE(lock.is_active());
+
+            static_cast<void>(worker.save_units("ordered", units));
+            wait_until_taken(worker);
+
+            // Both merge into one queued job, which keeps the newest config
+            static_cast<void>(worker.save_scene("ordered", make_grid(Tile::Type::Road), units,
+                                                first));
+            static_cast<void>(worker.save_generator_config("ordered", second));
+            REQUIRE(worker.get_pending_count() == 1);
+        }
+        worker.flush();
+
+        SQLiteGridRepository repository(test_db);
+        REQUIRE(repository.load_generator_config("ordered")->seed == 2);
+        REQUIRE(repository.load_map("ordered")->get_tile(Vector2i(4, 4))->get_type() ==
+                Tile::Type::Road);
+    }
+
+    SECTION("Chunks of a failed scene write go out with the next one")
+    {
+        PersistenceWorker worker(test_db);
+        Grid grid = make_grid(Tile::Type::Grass);
+        const std::vector<Unit> units;
+        REQUIRE(worker.save_scene("retry", grid, units).get());
+        grid.clear_dirty_chunks();
+
+        sqlite3 *db = nullptr;
+        REQUIRE(sqlite3_open(test_db.c_str(), &db) == SQLITE_OK);
+        REQUIRE(sqlite3_exec(db, "DROP TABLE map_chunks", nullptr, nullptr, nullptr) ==
+                SQLITE_OK);
+        REQUIRE(sqlite3_close(db) == SQLITE_OK);
+
+        grid.set_tile(Vector2i(0, 0), Tile(Vector2i(0, 0), Tile::Type::Water, -1));
+        REQUIRE_FALSE(worker.save_scene("retry", grid, units).get());
+        grid.clear_dirty_chunks();
+
+        // Opening a repository recreates the table; the scene itself has nothing dirty now
+        SQLiteGridRepository repository(test_db);
+        REQUIRE(worker.save_scene("retry", grid, units).get());
+
+        const auto loaded = repository.load_map("retry");
+        REQUIRE(loaded.has_value());
+        REQUIRE(loaded->get_tile(Vector2i(0, 0))->get_type() == Tile::Type::Water);
+    }
+
+    SECTION("Destruction writes queued saves")
+    {
+        {
+            PersistenceWorker worker(test_db);
+            static_cast<void>(worker.save_map("shutdown", make_grid(Tile::Type::Forest)));
+            static_cast<void>(worker.save_generator_config("shutdown",
+                                                           GeneratorConfig::default_config()));
+        }
+
+        SQLiteGridRepository repository(test_db);
+        REQUIRE(repository.map_exists("shutdown"));
+        REQUIRE(repository.load_generator_config("shutdown").has_value());
+    }
+
+    Testing::remove_database(test_db);
+}
+// NOLINTEND
@@ -0,0 +1,111 @@
+#include "Tactics/Core/SQLiteDatabase.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Unit.hpp"
+#include "Tactics/Core/SQLiteGridRepository.hpp"
+#include "Tactics/Core/SQLiteUnitRepository.hpp"
+#include "SQLiteTestDatabase.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    auto make_grid() -> Grid
+    {
+        Grid grid;
+        grid.resize(8, 6);
+        for (int y = 0; y < 6; ++y)
+        {
+            for (int x = 0; x < 8; ++x)
+            {
+                grid.set_tile(Vector2i(x, y), Tile(Vector2i(x, y), Tile::Type::Forest, 2));
+            }
+        }
+        return grid;
+    }
+
+    auto make_units() -> std::vector<Unit>
+    {
+        std::vector<Unit> units;
+        units.emplace_back(Vector2i(1, 2), 4);
+        units.emplace_back(Vector2i(5, 3), 6);
+        return units;
+    }
+} // namespace
+
+TEST_CASE("SQLiteDatabase", "[Core]")
+{
+    const std::string test_db = "test_database.db";
+    Testing::remove_database(test_db);
+
+    {
+        auto database = std::make_shared<SQLiteDatabase>(test_db);
+        REQUIRE(database->is_open());
+
+        SQLiteGridRepository grid_repository(database);
+        SQLiteUnitRepository unit_repository(database);
+
+        SECTION("A unit of work commits map and units once")
+        {
+            const std::size_t commits_before = database->get_commit_count();
+            {
+                SQLiteTransaction transaction(*database);
+                REQUIRE(transaction.is_active());
+                REQUIRE(grid_repository.save_map("scene", make_grid()));
+                REQUIRE(unit_repository.save_units("scene", make_units()));
+                REQUIRE(database->get_transaction_depth() == 1);
+                REQUIRE(transaction.commit());
+            }
+
+            REQUIRE(database->get_commit_count() == commits_before + 1);
+            REQUIRE(database->get_transaction_depth() == 0);
+            REQUIRE(grid_repository.map_exists("scene"));
+            REQUIRE(unit_repository.load_units("scene").size() == 2);
+        }
+
+        SECTION("An abandoned unit of work leaves nothing behind")
+        {
+            {
+                SQLiteTransaction transaction(*database);
+                REQUIRE(grid_repository.save_map("discarded", make_grid()));
+                REQUIRE(unit_repository.save_units("discarded", make_units()));
+            }
+
+            REQUIRE(database->get_transaction_depth() == 0);
+            REQUIRE_FALSE(grid_repository.map_exists("discarded"));
+            REQUIRE(unit_repository.load_units("discarded").empty());
+        }
+
+        SECTION("Inner rollbacks only undo their savepoint")
+        {
+            SQLiteTransaction outer(*database);
+            REQUIRE(grid_repository.save_map("kept", make_grid()));
+            {
+                SQLiteTransaction inner(*database);
+                REQUIRE(database->get_transaction_depth() == 2);
+                REQUIRE(unit_repository.save_units("kept", make_units()));
+                inner.rollback();
+            }
+            REQUIRE(outer.commit());
+
+            REQUIRE(grid_repository.map_exists("kept"));
+            REQUIRE(unit_repository.load_units("kept").empty());
+        }
+
+        SECTION("Repositories share the connection's statement cache")
+        {
+            static_cast<void>(grid_repository.map_exists("a"));
+            const std::size_t prepared = database->get_statement_cache().get_prepare_count();
+            static_cast<void>(grid_repository.map_exists("b"));
+            static_cast<void>(grid_repository.map_exists("c"));
+            REQUIRE(database->get_statement_cache().get_prepare_count() == prepared);
+        }
+    }
+
+    Testing::remove_database(test_db);
+}
+// NOLINTEND
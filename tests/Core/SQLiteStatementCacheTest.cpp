@@ -0,0 +1,108 @@
+#include "Tactics/Core/SQLiteStatementCache.hpp"
+#include "Tactics/Core/SQLiteGridRepository.hpp"
+#include "SQLiteTestDatabase.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <sqlite3.h>
+#include <string>
+#include <utility>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+TEST_CASE("SQLiteStatementCache", "[Core]")
+{
+    sqlite3 *db = nullptr;
+    REQUIRE(sqlite3_open(":memory:", &db) == SQLITE_OK);
+
+    {
+        SQLiteStatementCache cache(db);
+
+        SECTION("Statements are prepared once and reused")
+        {
+            sqlite3_stmt *first = nullptr;
+            {
+                const CachedStatement stmt = cache.acquire("SELECT ?");
+                REQUIRE(stmt);
+                first = stmt.get();
+            }
+
+            const CachedStatement again = cache.acquire("SELECT ?");
+            REQUIRE(again.get() == first);
+            REQUIRE(cache.get_prepare_count() == 1);
+            REQUIRE(cache.get_statement_count() == 1);
+        }
+
+        SECTION("Released statements are reset with bindings cleared")
+        {
+            {
+                const CachedStatement stmt = cache.acquire("SELECT ?");
+                sqlite3_bind_int(stmt.get(), 1, 42);
+                REQUIRE(sqlite3_step(stmt.get()) == SQLITE_ROW);
+                REQUIRE(sqlite3_column_int(stmt.get(), 0) == 42);
+            }
+
+            const CachedStatement stmt = cache.acquire("SELECT ?");
+            REQUIRE(sqlite3_stmt_busy(stmt.get()) == 0);
+            REQUIRE(sqlite3_step(stmt.get()) == SQLITE_ROW);
+            REQUIRE(sqlite3_column_type(stmt.get(), 0) == SQLITE_NULL);
+        }
+
+        SECTION("A statement cannot be checked out twice")
+        {
+            CachedStatement first = cache.acquire("SELECT 1");
+            REQUIRE(first);
+            REQUIRE_FALSE(cache.acquire("SELECT 1"));
+
+            // Moving the handle keeps it checked out; releasing it returns it to the cache
+            CachedStatement moved = std::move(first);
+            REQUIRE_FALSE(cache.acquire("SELECT 1"));
+            moved = CachedStatement();
+            REQUIRE(cache.acquire("SELECT 1"));
+            REQUIRE(cache.get_prepare_count() == 1);
+        }
+
+        SECTION("Invalid SQL yields an empty handle")
+        {
+            const CachedStatement stmt = cache.acquire("SELEC nothing");
+            REQUIRE_FALSE(stmt);
+            REQUIRE(cache.get_statement_count() == 0);
+        }
+
+        SECTION("Clearing finalizes every statement")
+        {
+            static_cast<void>(cache.acquire("SELECT 1"));
+            static_cast<void>(cache.acquire("SELECT 2"));
+            REQUIRE(cache.get_statement_count() == 2);
+
+            cache.clear();
+            REQUIRE(cache.get_statement_count() == 0);
+            REQUIRE(sqlite3_next_stmt(db, nullptr) == nullptr);
+        }
+    }
+
+    REQUIRE(sqlite3_close(db) == SQLITE_OK);
+}
+
+TEST_CASE("SQLite repositories open in WAL mode", "[Core]")
+{
+    const std::string test_db = "test_statement_cache.db";
+    Testing::remove_database(test_db);
+
+    {
+        SQLiteGridRepository repository(test_db);
+        REQUIRE_FALSE(repository.map_exists("missing"));
+
+        sqlite3 *db = nullptr;
+        REQUIRE(sqlite3_open(test_db.c_str(), &db) == SQLITE_OK);
+        sqlite3_stmt *stmt = nullptr;
+        REQUIRE(sqlite3_prepare_v2(db, "PRAGMA journal_mode", -1, &stmt, nullptr) == SQLITE_OK);
+        REQUIRE(sqlite3_step(stmt) == SQLITE_ROW);
+        const std::string mode = reinterpret_cast<const char *>(sqlite3_column_text(stmt, 0));
+        REQUIRE(mode == "wal");
+        sqlite3_finalize(stmt);
+        sqlite3_close(db);
+    }
+
+    Testing::remove_database(test_db);
+}
+// NOLINTEND
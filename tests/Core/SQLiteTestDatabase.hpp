@@ -0,0 +1,17 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+namespace Tactics::Testing
+{
+    // Delete a test database together with the -wal and -shm files WAL mode keeps beside it, so
+    // a run that aborted never replays its log onto the next run's fresh database
+    inline void remove_database(const std::string &path)
+    {
+        for (const char *suffix : {"", "-wal", "-shm"})
+        {
+            std::filesystem::remove(path + suffix);
+        }
+    }
+} // namespace Tactics::Testing
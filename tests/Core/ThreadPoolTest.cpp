@@ -0,0 +1,55 @@
+#include "Tactics/Core/ThreadPool.hpp"
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+TEST_CASE("ThreadPool", "[Core]")
+{
+    ThreadPool pool(3);
+    REQUIRE(pool.get_worker_count() == 3);
+
+    SECTION("Every item runs exactly once")
+    {
+        std::vector<std::atomic<int>> hits(1000);
+        pool.parallel_for(hits.size(), [&hits](std::size_t item, std::size_t) { ++hits[item]; });
+
+        for (const auto &hit : hits)
+        {
+            REQUIRE(hit.load() == 1);
+        }
+    }
+
+    SECTION("Worker indices stay in range across repeated jobs")
+    {
+        std::atomic<bool> in_range{true};
+        for (int job = 0; job < 20; ++job)
+        {
+            pool.parallel_for(17,
+                              [&](std::size_t, std::size_t worker)
+                              {
+                                  if (worker >= pool.get_worker_count())
+                                  {
+                                      in_range = false;
+                                  }
+                              });
+        }
+        REQUIRE(in_range.load());
+    }
+
+    SECTION("Empty jobs return immediately")
+    {
+        bool called = false;
+        pool.parallel_for(0, [&called](std::size_t, std::size_t) { called = true; });
+        REQUIRE_FALSE(called);
+    }
+
+    SECTION("Zero workers picks a default")
+    {
+        ThreadPool default_pool;
+        REQUIRE(default_pool.get_worker_count() >= 1);
+    }
+}
+// NOLINTEND
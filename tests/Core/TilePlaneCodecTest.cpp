@@ -0,0 +1,219 @@
+#include "Tactics/Core/TilePlaneCodec.hpp"
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    auto round_trips(const ITilePlaneCodec &codec, const std::vector<std::uint8_t> &plane) -> bool
+    {
+        std::vector<std::uint8_t> encoded;
+        if (!codec.encode(plane, encoded))
+        {
+            return false;
+        }
+
+        std::vector<std::uint8_t> decoded(plane.size(), 0xAB);
+        return codec.decode(encoded, decoded) && decoded == plane;
+    }
+
+    // Cycles through value_count distinct values, with an odd length so packing leaves a tail
+    auto make_plane(std::size_t size, int value_count) -> std::vector<std::uint8_t>
+    {
+        std::vector<std::uint8_t> plane(size);
+        for (std::size_t index = 0; index < size; ++index)
+        {
+            plane[index] = static_cast<std::uint8_t>(((index / 3) % value_count) * 7);
+        }
+        return plane;
+    }
+} // namespace
+
+TEST_CASE("TilePlaneCodec", "[Core]")
+{
+    const RawCodec raw;
+    const RunLengthCodec run_length;
+    const PaletteCodec palette;
+
+    SECTION("Every codec round-trips planes it accepts")
+    {
+        const std::vector<std::vector<std::uint8_t>> planes = {
+            std::vector<std::uint8_t>(Grid::CHUNK_TILE_COUNT, 4),
+            std::vector<std::uint8_t>(70000, 9),
+            make_plane(1021, 2),
+            make_plane(1021, 3),
+            make_plane(1021, 16),
+            make_plane(13, 5),
+            {}};
+
+        for (const auto &plane : planes)
+        {
+            REQUIRE(round_trips(raw, plane));
+            REQUIRE(round_trips(run_length, plane));
+            REQUIRE(round_trips(palette, plane));
+        }
+    }
+
+    SECTION("Every supported backend matches scalar")
+    {
+        RunLengthCodec scalar_run_length;
+        PaletteCodec scalar_palette;
+        scalar_run_length.set_backend(TileCodecBackend::Scalar);
+        scalar_palette.set_backend(TileCodecBackend::Scalar);
+        REQUIRE(scalar_run_length.get_backend() == TileCodecBackend::Scalar);
+
+        // Runs of every length up to 40, so run ends land at every offset within a vector
+        std::vector<std::uint8_t> runs;
+        for (std::size_t length = 1; length <= 40; ++length)
+        {
+            runs.insert(runs.end(), length, static_cast<std::uint8_t>(length % 3));
+        }
+
+        const std::vector<std::vector<std::uint8_t>> planes = {
+            runs, std::vector<std::uint8_t>(Grid::CHUNK_TILE_COUNT, 6), make_plane(1021, 16),
+            make_plane(1024, 9), make_plane(45, 5), make_plane(1024, 3)};
+
+        for (const auto backend : {TileCodecBackend::SSE41, TileCodecBackend::AVX2})
+        {
+            RunLengthCodec vector_run_length;
+            PaletteCodec vector_palette;
+            vector_run_length.set_backend(backend);
+            vector_palette.set_backend(backend);
+            REQUIRE(vector_palette.get_backend() <= detect_tile_codec_backend());
+
+            for (const auto &plane : planes)
+            {
+                std::vector<std::uint8_t> expected;
+                std::vector<std::uint8_t> actual;
+                REQUIRE(scalar_run_length.encode(plane, expected));
+                REQUIRE(vector_run_length.encode(plane, actual));
+                REQUIRE(actual == expected);
+                REQUIRE(round_trips(vector_run_length, plane));
+
+                expected.clear();
+                REQUIRE(scalar_palette.encode(make_plane(plane.size(), 11), expected));
+                std::vector<std::uint8_t> scalar_plane(plane.size());
+                std::vector<std::uint8_t> vector_plane(plane.size());
+                REQUIRE(scalar_palette.decode(expected, scalar_plane));
+                REQUIRE(vector_palette.decode(expected, vector_plane));
+                REQUIRE(vector_plane == scalar_plane);
+            }
+
+            // Five values use 4-bit indices, so 15 in the middle of a long plane is invalid
+            std::vector<std::uint8_t> encoded;
+            REQUIRE(vector_palette.encode(make_plane(1024, 5), encoded));
+            encoded[300] = 0xF0;
+            std::vector<std::uint8_t> plane(1024);
+            REQUIRE_FALSE(vector_palette.decode(encoded, plane));
+        }
+    }
+
+    SECTION("Palettes hold at most sixteen values")
+    {
+        std::vector<std::uint8_t> encoded;
+        REQUIRE_FALSE(palette.encode(make_plane(1024, 17), encoded));
+        REQUIRE(encoded.empty());
+
+        // A uniform plane stores only its single palette entry
+        REQUIRE(palette.encode(std::vector<std::uint8_t>(1024, 2), encoded));
+        REQUIRE(encoded == std::vector<std::uint8_t>{1, 2});
+    }
+
+    SECTION("Malformed encodings are rejected")
+    {
+        std::vector<std::uint8_t> plane(8);
+
+        REQUIRE_FALSE(raw.decode(std::vector<std::uint8_t>(7), plane));
+
+        // Runs must be whole, non-empty and fill the plane exactly
+        REQUIRE_FALSE(run_length.decode(std::vector<std::uint8_t>{1, 8}, plane));
+        REQUIRE_FALSE(run_length.decode(std::vector<std::uint8_t>{1, 0, 0, 1, 8, 0}, plane));
+        REQUIRE_FALSE(run_length.decode(std::vector<std::uint8_t>{1, 7, 0}, plane));
+        REQUIRE_FALSE(run_length.decode(std::vector<std::uint8_t>{1, 9, 0}, plane));
+        REQUIRE(run_length.decode(std::vector<std::uint8_t>{1, 3, 0, 2, 5, 0}, plane));
+        REQUIRE(plane == std::vector<std::uint8_t>{1, 1, 1, 2, 2, 2, 2, 2});
+
+        // Three values use 2-bit indices, so index 3 is out of range
+        REQUIRE_FALSE(palette.decode(std::vector<std::uint8_t>{}, plane));
+        REQUIRE_FALSE(palette.decode(std::vector<std::uint8_t>{17}, plane));
+        REQUIRE_FALSE(palette.decode(std::vector<std::uint8_t>{3, 1, 2, 3, 0x00}, plane));
+        REQUIRE_FALSE(palette.decode(std::vector<std::uint8_t>{3, 1, 2, 3, 0x00, 0xC0}, plane));
+        REQUIRE(palette.decode(std::vector<std::uint8_t>{3, 1, 2, 3, 0x24, 0x00}, plane));
+        REQUIRE(plane == std::vector<std::uint8_t>{1, 2, 3, 1, 1, 1, 1, 1});
+    }
+
+    SECTION("The smallest encoding is chosen")
+    {
+        std::vector<std::uint8_t> encoded;
+        REQUIRE(encode_tile_plane(std::vector<std::uint8_t>(1024, 1), encoded) ==
+                TileCodecId::Palette);
+        REQUIRE(encoded.size() == 2);
+
+        std::vector<std::uint8_t> halves(1024, 1);
+        std::fill(halves.begin() + 512, halves.end(), 5);
+        encoded.clear();
+        REQUIRE(encode_tile_plane(halves, encoded) == TileCodecId::RunLength);
+        REQUIRE(encoded.size() == 6);
+
+        encoded.clear();
+        REQUIRE(encode_tile_plane(make_plane(1024, 4), encoded) == TileCodecId::Palette);
+
+        std::vector<std::uint8_t> noise(1024);
+        for (std::size_t index = 0; index < noise.size(); ++index)
+        {
+            noise[index] = static_cast<std::uint8_t>((index * 131) % 251);
+        }
+        encoded.clear();
+        REQUIRE(encode_tile_plane(noise, encoded) == TileCodecId::Raw);
+        REQUIRE(encoded == noise);
+
+        REQUIRE(find_tile_codec(TileCodecId::RunLength) != nullptr);
+        REQUIRE(find_tile_codec(static_cast<TileCodecId>(9)) == nullptr);
+    }
+
+    SECTION("Chunk blobs round-trip both planes")
+    {
+        Grid grid;
+        grid.resize(40, 40);
+        for (int y = 0; y < 40; ++y)
+        {
+            for (int x = 0; x < 40; ++x)
+            {
+                const bool water = x < y;
+                grid.set_tile(Vector2i(x, y),
+                              Tile(Vector2i(x, y), water ? Tile::Type::Water : Tile::Type::Forest,
+                                   water ? -1 : 2));
+            }
+        }
+
+        const Grid &source = grid;
+        std::vector<std::uint8_t> blob;
+        encode_chunk_blob(source.get_chunk(0, 0), blob);
+        REQUIRE(blob.size() < Grid::CHUNK_TILE_COUNT * 2);
+
+        Grid copy;
+        copy.resize(40, 40);
+        REQUIRE(decode_chunk_blob(blob, copy.get_chunk(0, 0)));
+        REQUIRE(std::ranges::equal(copy.get_chunk(0, 0).tile_types,
+                                   grid.get_chunk(0, 0).tile_types));
+        REQUIRE(std::ranges::equal(copy.get_chunk(0, 0).move_costs,
+                                   grid.get_chunk(0, 0).move_costs));
+
+        // Tile types past Tile::Type::Wall are rejected
+        std::vector<std::uint8_t> bad_types;
+        grid.get_chunk(0, 0).tile_types[5] = static_cast<std::uint8_t>(Tile::Type::Wall) + 1;
+        encode_chunk_blob(source.get_chunk(0, 0), bad_types);
+        REQUIRE_FALSE(decode_chunk_blob(bad_types, copy.get_chunk(0, 0)));
+
+        blob[0] = 9;
+        REQUIRE_FALSE(decode_chunk_blob(blob, copy.get_chunk(0, 0)));
+        REQUIRE_FALSE(decode_chunk_blob(std::vector<std::uint8_t>(4), copy.get_chunk(0, 0)));
+    }
+}
+// NOLINTEND
@@ -0,0 +1,119 @@
+#include "Tactics/Core/ValueNoise.hpp"
+#include <bit>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    auto row_bits(const ValueNoise &noise, int y_pos, int x_begin, size_t length, float frequency,
+                  int octaves) -> std::vector<std::uint32_t>
+    {
+        std::vector<float> row(length);
+        noise.fractal_row(y_pos, x_begin, row, frequency, octaves);
+
+        std::vector<std::uint32_t> bits;
+        bits.reserve(length);
+        for (const float value : row)
+        {
+            bits.push_back(std::bit_cast<std::uint32_t>(value));
+        }
+        return bits;
+    }
+} // namespace
+
+TEST_CASE("ValueNoise", "[Core]")
+{
+    SECTION("Lattice values are deterministic and in range")
+    {
+        const ValueNoise noise(42);
+        const ValueNoise same_seed(42);
+        const ValueNoise other_seed(43);
+
+        bool differs = false;
+        for (int y = -20; y < 20; ++y)
+        {
+            for (int x = -20; x < 20; ++x)
+            {
+                const float value = noise.hash(x, y);
+                REQUIRE(value >= 0.0F);
+                REQUIRE(value <= 1.0F);
+                REQUIRE(value == same_seed.hash(x, y));
+                differs = differs || value != other_seed.hash(x, y);
+            }
+        }
+        REQUIRE(differs);
+    }
+
+    SECTION("Samples interpolate lattice values")
+    {
+        const ValueNoise noise(7);
+        REQUIRE(noise.sample(3.0F, 5.0F) == noise.hash(3, 5));
+        REQUIRE(noise.sample(-4.0F, 2.0F) == noise.hash(-4, 2));
+    }
+
+    SECTION("Fractal rows match per-tile scalar sums")
+    {
+        ValueNoise noise(99);
+        noise.set_backend(ValueNoise::Backend::Scalar);
+        std::vector<float> row(5);
+        noise.fractal_row(3, 10, row, 0.05F, 4);
+
+        for (int index = 0; index < 5; ++index)
+        {
+            float frequency = 0.05F;
+            float amplitude = 1.0F;
+            float value = 0.0F;
+            float max_amplitude = 0.0F;
+            for (int octave = 0; octave < 4; ++octave)
+            {
+                value += noise.sample(static_cast<float>(10 + index) * frequency,
+                                      3.0F * frequency) *
+                         amplitude;
+                max_amplitude += amplitude;
+                amplitude *= 0.5F;
+                frequency *= 2.0F;
+            }
+            REQUIRE(row[static_cast<size_t>(index)] == value / max_amplitude);
+        }
+    }
+
+    SECTION("Every supported backend is bit-identical to scalar")
+    {
+        ValueNoise scalar(1234);
+        scalar.set_backend(ValueNoise::Backend::Scalar);
+        REQUIRE(scalar.get_backend() == ValueNoise::Backend::Scalar);
+
+        for (const auto backend : {ValueNoise::Backend::SSE41, ValueNoise::Backend::AVX2})
+        {
+            ValueNoise vectorized(1234);
+            vectorized.set_backend(backend);
+            REQUIRE(vectorized.get_backend() <= ValueNoise::detect_backend());
+
+            for (const int y : {0, 1, 17, 255, -3})
+            {
+                for (const int octaves : {1, 4, 6})
+                {
+                    for (const float frequency : {0.05F, 0.013F, 0.37F})
+                    {
+                        REQUIRE(row_bits(vectorized, y, -9, 77, frequency, octaves) ==
+                                row_bits(scalar, y, -9, 77, frequency, octaves));
+                        REQUIRE(row_bits(vectorized, y, 1000, 3, frequency, octaves) ==
+                                row_bits(scalar, y, 1000, 3, frequency, octaves));
+                    }
+                }
+            }
+        }
+    }
+
+    SECTION("Unsupported backends fall back")
+    {
+        ValueNoise noise(1);
+        noise.set_backend(ValueNoise::Backend::AVX2);
+        REQUIRE(noise.get_backend() == ValueNoise::detect_backend());
+    }
+}
+// NOLINTEND
@@ -0,0 +1,96 @@
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Pathfinding/BatchReachability.hpp"
+#include "Tactics/Pathfinding/ReachabilitySearch.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+TEST_CASE("TileBitset", "[Pathfinding]")
+{
+    TileBitset bits;
+    bits.reset(130);
+    REQUIRE(bits.size() == 130);
+    REQUIRE(bits.count() == 0);
+
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(129);
+    REQUIRE(bits.test(0));
+    REQUIRE(bits.test(63));
+    REQUIRE(bits.test(64));
+    REQUIRE(bits.test(129));
+    REQUIRE_FALSE(bits.test(1));
+    REQUIRE(bits.count() == 4);
+
+    bits.reset(10);
+    REQUIRE(bits.count() == 0);
+}
+
+TEST_CASE("BatchReachability", "[Pathfinding]")
+{
+    Grid grid;
+    grid.resize(40, 40);
+    for (int y = 0; y < 30; ++y)
+    {
+        grid.set_tile(Vector2i(20, y), Tile(Vector2i(20, y), Tile::Type::Wall, -1));
+    }
+    for (int x = 0; x < 40; x += 3)
+    {
+        grid.set_tile(Vector2i(x, 10), Tile(Vector2i(x, 10), Tile::Type::Forest, 2));
+    }
+
+    std::vector<ReachabilityQuery> queries;
+    std::vector<bool> blocked(grid.get_move_costs().size(), false);
+    for (int index = 0; index < 50; ++index)
+    {
+        const Vector2i start((index * 7) % 40, (index * 13) % 40);
+        if (grid.get_tile(start)->get_move_cost() < 0)
+        {
+            continue;
+        }
+        queries.push_back(ReachabilityQuery{.start = start, .move_points = 3 + (index % 6)});
+        blocked[grid.index_of(start.x, start.y)] = true;
+    }
+
+    BatchReachability batch(4);
+    batch.compute(grid, queries, blocked);
+    REQUIRE(batch.get_results().size() == queries.size());
+
+    SECTION("Matches serial searches")
+    {
+        ReachabilitySearch search;
+        for (size_t query = 0; query < queries.size(); ++query)
+        {
+            search.compute(grid, queries[query].start, queries[query].move_points, blocked);
+            const auto remaining = search.get_remaining_move_points();
+            const TileBitset &bits = batch.get_results()[query];
+            REQUIRE(bits.size() == remaining.size());
+
+            size_t reachable = 0;
+            for (size_t index = 0; index < remaining.size(); ++index)
+            {
+                REQUIRE(bits.test(index) == (remaining[index] >= 0));
+                reachable += remaining[index] >= 0 ? 1 : 0;
+            }
+            REQUIRE(bits.count() == reachable);
+            REQUIRE(batch.is_reachable(grid, query, queries[query].start));
+        }
+    }
+
+    SECTION("Out of range lookups are unreachable")
+    {
+        REQUIRE_FALSE(batch.is_reachable(grid, queries.size(), Vector2i(0, 0)));
+        REQUIRE_FALSE(batch.is_reachable(grid, 0, Vector2i(-1, 0)));
+    }
+
+    SECTION("Empty batch")
+    {
+        batch.compute(grid, {}, blocked);
+        REQUIRE(batch.get_results().empty());
+    }
+}
+// NOLINTEND
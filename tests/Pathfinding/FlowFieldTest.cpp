@@ -0,0 +1,108 @@
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Pathfinding/FlowField.hpp"
+#include "Tactics/Pathfinding/Pathfinder.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <vector>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+TEST_CASE("FlowField", "[Pathfinding]")
+{
+    Grid grid;
+    grid.resize(12, 10);
+    FlowField field;
+    const std::vector<Vector2i> goal = {Vector2i(9, 7)};
+
+    SECTION("Distances match single-source path costs")
+    {
+        grid.set_tile(Vector2i(5, 7), Tile(Vector2i(5, 7), Tile::Type::Forest, 3));
+        for (int y = 0; y < 6; ++y)
+        {
+            grid.set_tile(Vector2i(7, y), Tile(Vector2i(7, y), Tile::Type::Wall, -1));
+        }
+
+        field.compute(grid, goal, {});
+        Pathfinder pathfinder;
+        for (const auto &start : {Vector2i(0, 0), Vector2i(2, 7), Vector2i(11, 0), Vector2i(6, 2)})
+        {
+            const auto path = pathfinder.find_path(grid, start, goal[0], {});
+            REQUIRE(path.has_value());
+            REQUIRE(field.get_distance(grid, start) == path->cost);
+        }
+
+        REQUIRE(field.get_distance(grid, goal[0]) == 0);
+        REQUIRE(field.get_distance(grid, Vector2i(7, 0)) == -1);
+    }
+
+    SECTION("Following next steps reaches the goal at the reported cost")
+    {
+        grid.set_tile(Vector2i(4, 4), Tile(Vector2i(4, 4), Tile::Type::Water, 4));
+        field.compute(grid, goal, {});
+
+        Vector2i position(0, 0);
+        int cost = 0;
+        while (const auto step = field.get_next_step(grid, position))
+        {
+            cost += grid.get_tile(*step)->get_move_cost();
+            position = *step;
+        }
+
+        REQUIRE(position == goal[0]);
+        REQUIRE(cost == field.get_distance(grid, Vector2i(0, 0)));
+    }
+
+    SECTION("Multiple goals lead to the nearest one")
+    {
+        const std::vector<Vector2i> goals = {Vector2i(0, 0), Vector2i(11, 9)};
+        field.compute(grid, goals, {});
+        REQUIRE(field.get_distance(grid, Vector2i(1, 1)) == 2);
+        REQUIRE(field.get_distance(grid, Vector2i(10, 8)) == 2);
+        REQUIRE(field.get_next_step(grid, Vector2i(0, 0)) == std::nullopt);
+    }
+
+    SECTION("Blocked tiles are left but not passed through")
+    {
+        std::vector<bool> blocked(grid.get_move_costs().size(), false);
+        for (int y = 0; y < grid.get_height(); ++y)
+        {
+            blocked[grid.index_of(5, y)] = true;
+        }
+
+        field.compute(grid, goal, blocked);
+        REQUIRE(field.get_distance(grid, Vector2i(5, 3)) >= 0);
+        REQUIRE(field.get_next_step(grid, Vector2i(5, 3)).has_value());
+        REQUIRE(field.get_distance(grid, Vector2i(2, 3)) == -1);
+    }
+
+    SECTION("An empty mask blocks nothing")
+    {
+        field.compute(grid, goal, {});
+        REQUIRE(field.get_distance(grid, Vector2i(0, 0)) == 16);
+
+        Pathfinder pathfinder;
+        const auto path = pathfinder.find_path(grid, Vector2i(0, 0), goal[0], {});
+        REQUIRE(path.has_value());
+        REQUIRE(path->cost == 16);
+    }
+
+    SECTION("Results are cached until the grid or occupancy changes")
+    {
+        const std::vector<bool> blocked(grid.get_move_costs().size(), false);
+        REQUIRE(field.update(grid, goal, blocked, 1));
+        REQUIRE_FALSE(field.update(grid, goal, blocked, 1));
+        REQUIRE(field.update(grid, goal, blocked, 2));
+
+        grid.set_tile(Vector2i(3, 3), Tile(Vector2i(3, 3), Tile::Type::Forest, 2));
+        REQUIRE(field.update(grid, goal, blocked, 2));
+        REQUIRE_FALSE(field.update(grid, goal, blocked, 2));
+
+        const std::vector<Vector2i> other_goal = {Vector2i(1, 1)};
+        REQUIRE(field.update(grid, other_goal, blocked, 2));
+
+        field.invalidate();
+        REQUIRE(field.update(grid, other_goal, blocked, 2));
+    }
+}
+// NOLINTEND
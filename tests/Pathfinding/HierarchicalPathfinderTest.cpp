@@ -0,0 +1,148 @@
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Pathfinding/HierarchicalPathfinder.hpp"
+#include "Tactics/Pathfinding/Pathfinder.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    void set_wall(Grid &grid, int x, int y)
+    {
+        grid.set_tile(Vector2i(x, y), Tile(Vector2i(x, y), Tile::Type::Wall, -1));
+    }
+
+    auto path_is_walkable(const Grid &grid, const Vector2i &start, const Path &path) -> bool
+    {
+        Vector2i previous = start;
+        int cost = 0;
+        for (const auto &step : path.steps)
+        {
+            if (std::abs(step.x - previous.x) + std::abs(step.y - previous.y) != 1)
+            {
+                return false;
+            }
+
+            const auto tile = grid.get_tile(step);
+            if (!tile.has_value() || tile->get_move_cost() < 0)
+            {
+                return false;
+            }
+
+            cost += tile->get_move_cost();
+            previous = step;
+        }
+        return cost == path.cost;
+    }
+
+    auto optimal_cost(const Grid &grid, const Vector2i &start, const Vector2i &goal) -> int
+    {
+        Pathfinder pathfinder;
+        const auto path = pathfinder.find_path(
+            grid, start, goal, std::vector<bool>(grid.get_move_costs().size(), false));
+        return path.has_value() ? path->cost : -1;
+    }
+} // namespace
+
+TEST_CASE("HierarchicalPathfinder", "[Pathfinding]")
+{
+    Grid grid;
+    grid.resize(100, 70);
+    HierarchicalPathfinder pathfinder;
+
+    SECTION("Open ground across clusters matches the optimal cost")
+    {
+        const Vector2i start(2, 3);
+        const Vector2i goal(95, 66);
+        const auto path = pathfinder.find_path(grid, start, goal);
+        REQUIRE(path.has_value());
+        REQUIRE(path->steps.back() == goal);
+        REQUIRE(path_is_walkable(grid, start, *path));
+        REQUIRE(path->cost == optimal_cost(grid, start, goal));
+        REQUIRE(pathfinder.get_abstract_node_count() > 0);
+    }
+
+    SECTION("Walls force a detour through a gap")
+    {
+        // Wall across the whole map at x = 40 with a single gap near the bottom
+        for (int y = 0; y < grid.get_height(); ++y)
+        {
+            if (y != 60)
+            {
+                set_wall(grid, 40, y);
+            }
+        }
+
+        const Vector2i start(5, 5);
+        const Vector2i goal(80, 5);
+        const auto path = pathfinder.find_path(grid, start, goal);
+        REQUIRE(path.has_value());
+        REQUIRE(path_is_walkable(grid, start, *path));
+        REQUIRE(path->cost >= optimal_cost(grid, start, goal));
+        REQUIRE(std::ranges::find(path->steps, Vector2i(40, 60)) != path->steps.end());
+    }
+
+    SECTION("Start and goal in the same cluster")
+    {
+        const auto path = pathfinder.find_path(grid, Vector2i(1, 1), Vector2i(6, 1));
+        REQUIRE(path.has_value());
+        REQUIRE(path->cost == 5);
+        REQUIRE(path->steps.size() == 5);
+    }
+
+    SECTION("Start equals goal")
+    {
+        const auto path = pathfinder.find_path(grid, Vector2i(3, 3), Vector2i(3, 3));
+        REQUIRE(path.has_value());
+        REQUIRE(path->steps.empty());
+        REQUIRE(path->cost == 0);
+    }
+
+    SECTION("Unreachable and invalid goals")
+    {
+        for (int y = 0; y < grid.get_height(); ++y)
+        {
+            set_wall(grid, 50, y);
+        }
+
+        REQUIRE_FALSE(pathfinder.find_path(grid, Vector2i(5, 5), Vector2i(80, 5)).has_value());
+        REQUIRE_FALSE(pathfinder.find_path(grid, Vector2i(5, 5), Vector2i(50, 5)).has_value());
+        REQUIRE_FALSE(pathfinder.find_path(grid, Vector2i(5, 5), Vector2i(200, 5)).has_value());
+    }
+
+    SECTION("Abstract path starts and ends at the query tiles")
+    {
+        const auto waypoints =
+            pathfinder.find_abstract_path(grid, Vector2i(2, 3), Vector2i(95, 66));
+        REQUIRE(waypoints.has_value());
+        REQUIRE(waypoints->size() > 2);
+        REQUIRE(waypoints->front() == Vector2i(2, 3));
+        REQUIRE(waypoints->back() == Vector2i(95, 66));
+    }
+
+    SECTION("Changing a tile only rebuilds nearby clusters")
+    {
+        pathfinder.update(grid);
+        REQUIRE(pathfinder.get_rebuilt_cluster_count() == grid.get_chunk_count());
+
+        pathfinder.update(grid);
+        REQUIRE(pathfinder.get_rebuilt_cluster_count() == 0);
+
+        // Centre cluster of a 4x3 cluster grid: itself plus four neighbours
+        set_wall(grid, 40, 40);
+        pathfinder.update(grid);
+        REQUIRE(pathfinder.get_rebuilt_cluster_count() == 5);
+
+        // A corner cluster only has two neighbours
+        set_wall(grid, 1, 1);
+        const auto path = pathfinder.find_path(grid, Vector2i(0, 0), Vector2i(90, 60));
+        REQUIRE(pathfinder.get_rebuilt_cluster_count() == 3);
+        REQUIRE(path.has_value());
+        REQUIRE(path_is_walkable(grid, Vector2i(0, 0), *path));
+    }
+}
+// NOLINTEND
@@ -0,0 +1,108 @@
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Pathfinding/Pathfinder.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdlib>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+namespace
+{
+    auto path_is_contiguous(const Vector2i &start, const Path &path) -> bool
+    {
+        Vector2i previous = start;
+        for (const auto &step : path.steps)
+        {
+            if (std::abs(step.x - previous.x) + std::abs(step.y - previous.y) != 1)
+            {
+                return false;
+            }
+            previous = step;
+        }
+        return true;
+    }
+} // namespace
+
+TEST_CASE("Pathfinder", "[Pathfinding]")
+{
+    Grid grid;
+    grid.resize(10, 8);
+    Pathfinder pathfinder;
+
+    SECTION("Straight path on open ground")
+    {
+        const auto path = pathfinder.find_path(grid, Vector2i(1, 1), Vector2i(6, 1), {});
+        REQUIRE(path.has_value());
+        REQUIRE(path->cost == 5);
+        REQUIRE(path->steps.size() == 5);
+        REQUIRE(path->steps.back() == Vector2i(6, 1));
+        REQUIRE(path_is_contiguous(Vector2i(1, 1), *path));
+        REQUIRE(pathfinder.get_expanded_count() == 6);
+    }
+
+    SECTION("Start equals goal")
+    {
+        const auto path = pathfinder.find_path(grid, Vector2i(3, 3), Vector2i(3, 3), {});
+        REQUIRE(path.has_value());
+        REQUIRE(path->steps.empty());
+        REQUIRE(path->cost == 0);
+    }
+
+    SECTION("Routes around walls and prefers cheaper terrain")
+    {
+        // Wall on column 4 with a gap at row 7; forest shortcut gap at row 0
+        for (int y = 1; y < 7; ++y)
+        {
+            grid.set_tile(Vector2i(4, y), Tile(Vector2i(4, y), Tile::Type::Wall, -1));
+        }
+        grid.set_tile(Vector2i(4, 0), Tile(Vector2i(4, 0), Tile::Type::Forest, 9));
+
+        const auto path = pathfinder.find_path(grid, Vector2i(2, 3), Vector2i(6, 3), {});
+        REQUIRE(path.has_value());
+        REQUIRE(path_is_contiguous(Vector2i(2, 3), *path));
+        // Around the bottom gap: 4 down + 4 across + 4 up = 12, the forest gap route costs 18
+        REQUIRE(path->cost == 12);
+        REQUIRE(std::find(path->steps.begin(), path->steps.end(), Vector2i(4, 7)) !=
+                path->steps.end());
+    }
+
+    SECTION("Occupied and unwalkable goals are unreachable")
+    {
+        std::vector<bool> blocked(grid.get_move_costs().size(), false);
+        blocked[grid.index_of(5, 5)] = true;
+        grid.set_tile(Vector2i(6, 6), Tile(Vector2i(6, 6), Tile::Type::Water, -1));
+
+        REQUIRE_FALSE(
+            pathfinder.find_path(grid, Vector2i(0, 0), Vector2i(5, 5), blocked).has_value());
+        REQUIRE_FALSE(
+            pathfinder.find_path(grid, Vector2i(0, 0), Vector2i(6, 6), blocked).has_value());
+        REQUIRE_FALSE(
+            pathfinder.find_path(grid, Vector2i(0, 0), Vector2i(10, 0), blocked).has_value());
+    }
+
+    SECTION("Enclosed goal exhausts the open set")
+    {
+        grid.set_tile(Vector2i(7, 6), Tile(Vector2i(7, 6), Tile::Type::Wall, -1));
+        grid.set_tile(Vector2i(8, 7), Tile(Vector2i(8, 7), Tile::Type::Wall, -1));
+        grid.set_tile(Vector2i(9, 6), Tile(Vector2i(9, 6), Tile::Type::Wall, -1));
+
+        REQUIRE(pathfinder.find_path(grid, Vector2i(0, 0), Vector2i(8, 6), {}).has_value());
+
+        grid.set_tile(Vector2i(8, 5), Tile(Vector2i(8, 5), Tile::Type::Wall, -1));
+        REQUIRE_FALSE(pathfinder.find_path(grid, Vector2i(0, 0), Vector2i(8, 6), {}).has_value());
+    }
+
+    SECTION("Repeated queries reuse buffers without leaking state")
+    {
+        const auto first = pathfinder.find_path(grid, Vector2i(0, 0), Vector2i(9, 7), {});
+        const auto second = pathfinder.find_path(grid, Vector2i(9, 7), Vector2i(0, 0), {});
+        REQUIRE(first.has_value());
+        REQUIRE(second.has_value());
+        REQUIRE(first->cost == 16);
+        REQUIRE(second->cost == 16);
+        REQUIRE(path_is_contiguous(Vector2i(9, 7), *second));
+    }
+}
+// NOLINTEND
@@ -0,0 +1,129 @@
+#include "Tactics/Components/Grid.hpp"
+#include "Tactics/Components/Tile.hpp"
+#include "Tactics/Pathfinding/BucketQueue.hpp"
+#include "Tactics/Pathfinding/ReachabilitySearch.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+// NOLINTBEGIN
+using namespace Tactics;
+
+TEST_CASE("BucketQueue", "[Pathfinding]")
+{
+    BucketQueue<int> queue;
+    queue.reset(4);
+
+    SECTION("Pops in priority order")
+    {
+        queue.push(30, 3);
+        queue.push(10, 1);
+        queue.push(40, 4);
+        queue.push(0, 0);
+        REQUIRE(queue.size() == 4);
+
+        REQUIRE(queue.pop()->value == 0);
+        REQUIRE(queue.pop()->value == 10);
+        REQUIRE(queue.pop()->value == 30);
+        REQUIRE(queue.pop()->priority == 4);
+        REQUIRE(queue.empty());
+        REQUIRE_FALSE(queue.pop().has_value());
+    }
+
+    SECTION("Accepts lower priorities after a pop and grows past the reset range")
+    {
+        queue.push(20, 2);
+        REQUIRE(queue.pop()->value == 20);
+
+        queue.push(90, 9);
+        queue.push(10, 1);
+        REQUIRE(queue.pop()->value == 10);
+        REQUIRE(queue.pop()->priority == 9);
+    }
+
+    SECTION("Reset empties the queue")
+    {
+        queue.push(1, 1);
+        queue.reset(2);
+        REQUIRE(queue.empty());
+        REQUIRE_FALSE(queue.pop().has_value());
+    }
+}
+
+TEST_CASE("ReachabilitySearch", "[Pathfinding]")
+{
+    Grid grid;
+    grid.resize(7, 5);
+    ReachabilitySearch search;
+
+    SECTION("Uniform costs give a diamond")
+    {
+        search.compute(grid, Vector2i(3, 2), 2, {});
+
+        REQUIRE(search.is_reachable(grid, Vector2i(3, 2)));
+        REQUIRE(search.is_reachable(grid, Vector2i(5, 2)));
+        REQUIRE(search.is_reachable(grid, Vector2i(4, 3)));
+        REQUIRE_FALSE(search.is_reachable(grid, Vector2i(5, 3)));
+        REQUIRE_FALSE(search.is_reachable(grid, Vector2i(6, 2)));
+        REQUIRE(search.get_remaining_move_points()[grid.index_of(4, 2)] == 1);
+        REQUIRE(search.get_expanded_count() == 13);
+    }
+
+    SECTION("Mixed costs keep the cheapest route and expand each tile once")
+    {
+        // A forest wall on column 2 with a road gap at the bottom row
+        for (int y = 0; y < 5; ++y)
+        {
+            grid.set_tile(Vector2i(2, y), Tile(Vector2i(2, y), Tile::Type::Forest, 2));
+        }
+        grid.set_tile(Vector2i(2, 4), Tile(Vector2i(2, 4), Tile::Type::Road, 1));
+
+        search.compute(grid, Vector2i(0, 0), 6, {});
+
+        const auto remaining = search.get_remaining_move_points();
+        // Through the forest: 1 + 2 = 3 spent
+        REQUIRE(remaining[grid.index_of(2, 0)] == 3);
+        REQUIRE(remaining[grid.index_of(3, 0)] == 2);
+        // Through the road gap: 4 down + 2 across = 6 spent
+        REQUIRE(remaining[grid.index_of(2, 4)] == 0);
+
+        int reachable = 0;
+        for (const int value : remaining)
+        {
+            reachable += value >= 0 ? 1 : 0;
+        }
+        REQUIRE(search.get_expanded_count() == reachable);
+    }
+
+    SECTION("Blocked and unwalkable tiles are never entered")
+    {
+        grid.set_tile(Vector2i(4, 2), Tile(Vector2i(4, 2), Tile::Type::Water, -1));
+        std::vector<bool> blocked(grid.get_move_costs().size(), false);
+        blocked[grid.index_of(2, 2)] = true;
+
+        search.compute(grid, Vector2i(3, 2), 1, blocked);
+
+        REQUIRE_FALSE(search.is_reachable(grid, Vector2i(4, 2)));
+        REQUIRE_FALSE(search.is_reachable(grid, Vector2i(2, 2)));
+        REQUIRE(search.is_reachable(grid, Vector2i(3, 1)));
+        REQUIRE(search.is_reachable(grid, Vector2i(3, 3)));
+    }
+
+    SECTION("A mask that does not cover the grid blocks nothing")
+    {
+        search.compute(grid, Vector2i(3, 2), 2, {});
+        REQUIRE(search.get_expanded_count() == 13);
+
+        search.compute(grid, Vector2i(3, 2), 2, std::vector<bool>(3, true));
+        REQUIRE(search.is_reachable(grid, Vector2i(5, 2)));
+    }
+
+    SECTION("Clear forgets the result")
+    {
+        search.compute(grid, Vector2i(0, 0), 3, {});
+        REQUIRE(search.has_result());
+
+        search.clear();
+        REQUIRE_FALSE(search.has_result());
+        REQUIRE_FALSE(search.is_reachable(grid, Vector2i(0, 0)));
+    }
+}
+// NOLINTEND